@@ -22,16 +22,28 @@ class Add<
 public:
     using BinaryExpression::BinaryExpression;
 
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> final;
-    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
-
-    [[nodiscard]] auto ToString() const -> std::string final;
-    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression> final;
+    /**
+     * Combines like terms in a list of simplified terms, such as `2x` and `3x` into `5x`.
+     *
+     * Real terms are summed into a single leading term. The other terms follow in the canonical
+     * order of their non-coefficient parts, so the result does not depend on the order of the
+     * terms. Combining n terms takes O(n log n) time.
+     *
+     * @param terms The terms to combine.
+     * @return The combined terms.
+     */
+    static auto CombineLikeTerms(const std::vector<std::unique_ptr<Expression>>& terms) -> std::vector<std::unique_ptr<Expression>>;
 
     DECL_SPECIALIZE(Add)
 
     EXPRESSION_TYPE(Add)
     EXPRESSION_CATEGORY(Associative | Commutative | BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression> final;
 };
 /// @endcond
 
@@ -55,9 +67,9 @@ public:
     {
     }
 
-    [[nodiscard]] auto ToString() const -> std::string final
+    Add(std::unique_ptr<AugendT>&& addend1, std::unique_ptr<AddendT>&& addend2)
+        : BinaryExpression<Add, AugendT, AddendT>(std::move(addend1), std::move(addend2))
     {
-        return fmt::format("({} + {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
     }
 
     IMPL_SPECIALIZE(Add, AugendT, AddendT)
@@ -66,6 +78,12 @@ public:
 
     EXPRESSION_TYPE(Add)
     EXPRESSION_CATEGORY(Associative | Commutative | BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final
+    {
+        return fmt::format("({} + {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
+    }
 };
 
 } // namespace Oasis
@@ -0,0 +1,131 @@
+#ifndef OASIS_BIGINT_HPP
+#define OASIS_BIGINT_HPP
+
+#include <compare>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Oasis {
+
+/**
+ * An arbitrary-precision signed integer.
+ *
+ * A BigInt stores its sign and the magnitude of its value as 32-bit limbs, from the least
+ * significant to the most significant, without leading zero limbs. Zero has no limbs and is never
+ * negative, so that equal values have equal representations.
+ */
+class BigInt {
+public:
+    /**
+     * Creates zero.
+     */
+    BigInt() = default;
+
+    /**
+     * Creates an integer from a built-in integer.
+     *
+     * @param value The value of the integer.
+     */
+    BigInt(std::int64_t value);
+
+    /**
+     * Parses an integer from decimal digits, optionally preceded by a minus sign.
+     *
+     * @param digits The digits.
+     * @return The integer.
+     * @throws std::invalid_argument If the string is not a decimal integer.
+     */
+    static auto FromString(std::string_view digits) -> BigInt;
+
+    /**
+     * Divides two integers, rounding the quotient toward zero.
+     *
+     * @param dividend The dividend.
+     * @param divisor The divisor.
+     * @return The quotient and the remainder, which has the sign of the dividend.
+     * @throws std::domain_error If the divisor is zero.
+     */
+    static auto DivRem(const BigInt& dividend, const BigInt& divisor) -> std::pair<BigInt, BigInt>;
+
+    /**
+     * Computes the greatest common divisor of two integers.
+     *
+     * @return The nonnegative greatest common divisor, which is zero only if both integers are.
+     */
+    static auto Gcd(BigInt lhs, BigInt rhs) -> BigInt;
+
+    [[nodiscard]] auto Abs() const -> BigInt;
+
+    /**
+     * Checks whether this integer fits in a `std::int64_t`.
+     */
+    [[nodiscard]] auto FitsInt64() const -> bool;
+
+    /**
+     * Gets the number of bits in the magnitude of this integer.
+     *
+     * @return The number of bits, which is zero for zero.
+     */
+    [[nodiscard]] auto GetBitLength() const -> std::size_t;
+
+    [[nodiscard]] auto Hash() const -> std::size_t;
+    [[nodiscard]] auto IsNegative() const -> bool;
+    [[nodiscard]] auto IsZero() const -> bool;
+
+    /**
+     * Raises this integer to a power by repeated squaring.
+     *
+     * @param exponent The power.
+     * @return This integer raised to the power.
+     */
+    [[nodiscard]] auto Pow(std::uint64_t exponent) const -> BigInt;
+
+    /**
+     * Converts this integer to the nearest double, or to infinity if it is out of range.
+     */
+    [[nodiscard]] auto ToDouble() const -> double;
+
+    /**
+     * Converts this integer to a `std::int64_t`. This integer must fit, as checked by `FitsInt64`.
+     */
+    [[nodiscard]] auto ToInt64() const -> std::int64_t;
+
+    /**
+     * Formats this integer as decimal digits.
+     */
+    [[nodiscard]] auto ToString() const -> std::string;
+
+    auto operator+(const BigInt& other) const -> BigInt;
+    auto operator-(const BigInt& other) const -> BigInt;
+    auto operator-() const -> BigInt;
+    auto operator*(const BigInt& other) const -> BigInt;
+    auto operator/(const BigInt& other) const -> BigInt;
+    auto operator%(const BigInt& other) const -> BigInt;
+
+    auto operator==(const BigInt& other) const -> bool = default;
+    auto operator<=>(const BigInt& other) const -> std::strong_ordering;
+
+private:
+    using Limbs = std::vector<std::uint32_t>;
+
+    static auto AddMagnitudes(const Limbs& lhs, const Limbs& rhs) -> Limbs;
+    static auto CompareMagnitudes(const Limbs& lhs, const Limbs& rhs) -> std::strong_ordering;
+    static auto DivideMagnitudes(const Limbs& dividend, const Limbs& divisor) -> std::pair<Limbs, Limbs>;
+    static auto MultiplyMagnitudes(const Limbs& lhs, const Limbs& rhs) -> Limbs;
+
+    // Subtracts a magnitude from a magnitude that is at least as large.
+    static auto SubtractMagnitudes(const Limbs& lhs, const Limbs& rhs) -> Limbs;
+
+    // Removes leading zero limbs, and the sign of zero.
+    auto Trim() -> void;
+
+    bool negative = false;
+    Limbs limbs;
+};
+
+} // Oasis
+
+#endif // OASIS_BIGINT_HPP
@@ -5,12 +5,16 @@
 #ifndef OASIS_BINARYEXPRESSION_HPP
 #define OASIS_BINARYEXPRESSION_HPP
 
+#include <algorithm>
+#include <cassert>
 #include <functional>
+#include <iterator>
 #include <list>
 
 #include "taskflow/taskflow.hpp"
 
 #include "Expression.hpp"
+#include "ExpressionArena.hpp"
 
 namespace Oasis {
 /**
@@ -30,13 +34,16 @@ concept IsAnyOf = (std::same_as<T, U> || ...);
 
 /**
  * Builds a reasonably balanced binary expression from a vector of operands.
+ *
+ * The operands are moved into the expression, and the vector is left with null operands.
+ *
  * @tparam T The type of the binary expression, e.g. Add or Multiply.
  * @param ops The vector of operands. Must have a minimum of 2 operands.
  * @return A binary expression with the operands in the vector, or a nullptr if ops.size() <=1.
  */
 template <template <typename, typename> typename T>
     requires IAssociativeAndCommutative<T>
-auto BuildFromVector(const std::vector<std::unique_ptr<Expression>>& ops) -> std::unique_ptr<T<Expression, Expression>>
+auto BuildFromVector(std::vector<std::unique_ptr<Expression>>&& ops) -> std::unique_ptr<T<Expression, Expression>>
 {
     if (ops.size() <= 1) {
         return nullptr;
@@ -44,14 +51,11 @@ auto BuildFromVector(const std::vector<std::unique_ptr<Expression>>& ops) -> std
 
     using GeneralizedT = T<Expression, Expression>;
 
-    std::list<std::unique_ptr<Expression>> opsList;
-    opsList.resize(ops.size());
-
-    std::transform(ops.begin(), ops.end(), opsList.begin(), [](const auto& op) { return op->Copy(); });
+    std::list<std::unique_ptr<Expression>> opsList { std::make_move_iterator(ops.begin()), std::make_move_iterator(ops.end()) };
 
     while (std::next(opsList.begin()) != opsList.end()) {
         for (auto i = opsList.begin(); i != opsList.end() && std::next(i) != opsList.end();) {
-            auto node = std::make_unique<GeneralizedT>(**i, **std::next(i));
+            auto node = std::make_unique<GeneralizedT>(std::move(*i), std::move(*std::next(i)));
             opsList.insert(i, std::move(node));
             i = opsList.erase(i, std::next(i, 2));
         }
@@ -61,6 +65,24 @@ auto BuildFromVector(const std::vector<std::unique_ptr<Expression>>& ops) -> std
     return std::unique_ptr<GeneralizedT>(result);
 }
 
+/**
+ * Builds a reasonably balanced binary expression from copies of a vector of operands.
+ * @tparam T The type of the binary expression, e.g. Add or Multiply.
+ * @param ops The vector of operands. Must have a minimum of 2 operands.
+ * @return A binary expression with the operands in the vector, or a nullptr if ops.size() <=1.
+ */
+template <template <typename, typename> typename T>
+    requires IAssociativeAndCommutative<T>
+auto BuildFromVector(const std::vector<std::unique_ptr<Expression>>& ops) -> std::unique_ptr<T<Expression, Expression>>
+{
+    std::vector<std::unique_ptr<Expression>> copies;
+    copies.reserve(ops.size());
+
+    std::transform(ops.begin(), ops.end(), std::back_inserter(copies), [](const auto& op) { return op->Copy(); });
+
+    return BuildFromVector<T>(std::move(copies));
+}
+
 /**
  * A binary expression.
  *
@@ -82,17 +104,25 @@ class BinaryExpression : public Expression {
     using DerivedSpecialized = DerivedT<MostSigOpT, LeastSigOpT>;
     using DerivedGeneralized = DerivedT<Expression, Expression>;
 
+    template <template <IExpression, IExpression> class, IExpression, IExpression>
+    friend class BinaryExpression;
+
 public:
     BinaryExpression() = default;
+
+    /**
+     * Copies a binary expression.
+     *
+     * Expressions are immutable, so the copy shares its operands with the original instead of
+     * copying them, making copies constant time regardless of the size of the expression.
+     *
+     * @param other The binary expression to copy.
+     */
     BinaryExpression(const BinaryExpression& other)
+        : Expression(other)
+        , mostSigOp(other.mostSigOp)
+        , leastSigOp(other.leastSigOp)
     {
-        if (other.HasMostSigOp()) {
-            SetMostSigOp(other.GetMostSigOp());
-        }
-
-        if (other.HasLeastSigOp()) {
-            SetLeastSigOp(other.GetLeastSigOp());
-        }
     }
 
     BinaryExpression(const MostSigOpT& mostSigOp, const LeastSigOpT& leastSigOp)
@@ -101,6 +131,23 @@ public:
         SetLeastSigOp(leastSigOp);
     }
 
+    /**
+     * Creates a binary expression that takes ownership of its operands.
+     *
+     * Operands that are only needed to build this expression, such as the results of `Simplify`,
+     * are moved into place instead of being copied.
+     *
+     * @param mostSigOp The most significant operand.
+     * @param leastSigOp The least significant operand.
+     */
+    template <typename Op1T, typename Op2T>
+        requires(std::derived_from<Op1T, MostSigOpT> || std::same_as<Op1T, Expression>) && (std::derived_from<Op2T, LeastSigOpT> || std::same_as<Op2T, Expression>)
+    BinaryExpression(std::unique_ptr<Op1T>&& mostSigOp, std::unique_ptr<Op2T>&& leastSigOp)
+    {
+        SetMostSigOp(std::move(mostSigOp));
+        SetLeastSigOp(std::move(leastSigOp));
+    }
+
     template <IExpression Op1T, IExpression Op2T, IExpression... OpsT>
     BinaryExpression(const Op1T& op1, const Op2T& op2, const OpsT&... ops)
     {
@@ -115,151 +162,106 @@ public:
         }
 
         // build expression from vector
-        auto generalized = BuildFromVector<DerivedT>(opsVec);
+        auto generalized = BuildFromVector<DerivedT>(std::move(opsVec));
 
-        SetLeastSigOp(generalized->GetLeastSigOp());
-        SetMostSigOp(generalized->GetMostSigOp());
+        this->mostSigOp = std::move(generalized->mostSigOp);
+        this->leastSigOp = std::move(generalized->leastSigOp);
     }
 
-    [[nodiscard]] auto Copy() const -> std::unique_ptr<Expression> final
+    ~BinaryExpression() override
     {
-        return std::make_unique<DerivedSpecialized>(*static_cast<const DerivedSpecialized*>(this));
+        ReleaseOperand(std::move(mostSigOp));
+        ReleaseOperand(std::move(leastSigOp));
     }
 
-    auto Copy(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final
+    [[nodiscard]] auto Copy() const -> std::unique_ptr<Expression> final
     {
-        DerivedSpecialized copy;
-
-        if (this->mostSigOp) {
-            subflow.emplace([this, &copy](tf::Subflow& sbf) {
-                copy.SetMostSigOp(mostSigOp->Copy(sbf), sbf);
-            });
-        }
-
-        if (this->leastSigOp) {
-            subflow.emplace([this, &copy](tf::Subflow& sbf) {
-                copy.SetLeastSigOp(leastSigOp->Copy(sbf), sbf);
-            });
-        }
-
-        subflow.join();
-
-        return std::make_unique<DerivedSpecialized>(copy);
+        return std::make_unique<DerivedSpecialized>(*static_cast<const DerivedSpecialized*>(this));
     }
-    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression> override
+
+    auto Copy(tf::Subflow&) const -> std::unique_ptr<Expression> final
     {
-        return Generalize()->Differentiate(differentiationVariable);
+        return Copy();
     }
     [[nodiscard]] auto Equals(const Expression& other) const -> bool final
     {
-        if (this->GetType() != other.GetType()) {
+        if (this == &other) {
+            return true;
+        }
+
+        if (this->GetType() != other.GetType() || this->Hash() != other.Hash()) {
             return false;
         }
 
         const auto otherGeneralized = other.Generalize();
         const auto& otherBinaryGeneralized = static_cast<const DerivedGeneralized&>(*otherGeneralized);
 
-        bool mostSigOpMismatch = false, leastSigOpMismatch = false;
-
-        if (this->HasMostSigOp() == otherBinaryGeneralized.HasMostSigOp()) {
-            if (mostSigOp && otherBinaryGeneralized.HasMostSigOp()) {
-                mostSigOpMismatch = !mostSigOp->Equals(otherBinaryGeneralized.GetMostSigOp());
-            }
-        } else {
-            mostSigOpMismatch = true;
+        if (this->HasMostSigOp() != otherBinaryGeneralized.HasMostSigOp() || this->HasLeastSigOp() != otherBinaryGeneralized.HasLeastSigOp()) {
+            return false;
         }
 
-        if (this->HasLeastSigOp() == otherBinaryGeneralized.HasLeastSigOp()) {
-            if (this->HasLeastSigOp() && otherBinaryGeneralized.HasLeastSigOp()) {
-                leastSigOpMismatch = !leastSigOp->Equals(otherBinaryGeneralized.GetLeastSigOp());
-            }
-        } else {
-            mostSigOpMismatch = true;
+        // Copies share their operands, so they are equal without visiting the operands.
+        if (mostSigOp.get() == otherBinaryGeneralized.mostSigOp.get() && leastSigOp.get() == otherBinaryGeneralized.leastSigOp.get()) {
+            return true;
         }
 
-        if (!mostSigOpMismatch && !leastSigOpMismatch) {
-            return true;
+        // An expression that is missing an operand cannot be traversed, so its operands are
+        // compared directly.
+        if (!this->HasMostSigOp() || !this->HasLeastSigOp()) {
+            return (!mostSigOp || mostSigOp->Equals(otherBinaryGeneralized.GetMostSigOp()))
+                && (!leastSigOp || leastSigOp->Equals(otherBinaryGeneralized.GetLeastSigOp()));
         }
 
         if (!(this->GetCategory() & Associative)) {
-            return false;
+            return OperandsEqual(*this, other);
         }
 
-        auto thisFlattened = std::vector<std::unique_ptr<Expression>> {};
-        auto otherFlattened = std::vector<std::unique_ptr<Expression>> {};
-
-        this->Flatten(thisFlattened);
-        otherBinaryGeneralized.Flatten(otherFlattened);
+        std::vector<const Expression*> thisTerms, otherTerms;
+        CollectTerms(*this, other, thisTerms, otherTerms);
 
-        for (const auto& thisOperand : thisFlattened) {
-            if (std::find_if(otherFlattened.begin(), otherFlattened.end(), [&thisOperand](const auto& otherOperand) {
-                    return thisOperand->Equals(*otherOperand);
-                })
-                == otherFlattened.end()) {
-                return false;
-            }
-        }
-
-        return true;
+        return TermsEqual(thisTerms, otherTerms, this->GetCategory() & Commutative);
     }
 
     [[nodiscard]] auto Generalize() const -> std::unique_ptr<Expression> final
     {
-        DerivedGeneralized generalized;
-
-        if (this->mostSigOp) {
-            generalized.SetMostSigOp(*this->mostSigOp->Copy());
-        }
+        auto generalized = std::make_unique<DerivedGeneralized>();
+        generalized->mostSigOp = this->mostSigOp;
+        generalized->leastSigOp = this->leastSigOp;
 
-        if (this->leastSigOp) {
-            generalized.SetLeastSigOp(*this->leastSigOp->Copy());
-        }
-
-        return std::make_unique<DerivedGeneralized>(generalized);
+        return generalized;
     }
 
-    auto Generalize(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final
+    auto Generalize(tf::Subflow&) const -> std::unique_ptr<Expression> final
     {
-        DerivedGeneralized generalized;
-
-        if (this->mostSigOp) {
-            subflow.emplace([this, &generalized](tf::Subflow& sbf) {
-                generalized.SetMostSigOp(*this->mostSigOp->Copy(sbf));
-            });
-        }
-
-        if (this->leastSigOp) {
-            subflow.emplace([this, &generalized](tf::Subflow& sbf) {
-                generalized.SetLeastSigOp(*this->leastSigOp->Copy(sbf));
-            });
-        }
-
-        subflow.join();
-
-        return std::make_unique<DerivedGeneralized>(generalized);
+        return Generalize();
     }
 
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> override
+    [[nodiscard]] auto GetOperandCount() const -> std::size_t final
     {
-        return Generalize()->Simplify();
+        return 2;
     }
 
-    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> override
+    [[nodiscard]] auto GetOperandAt(std::size_t index) const -> const Expression& final
     {
-        std::unique_ptr<Expression> generalized, simplified;
+        assert(index < 2);
+        return index == 0 ? static_cast<const Expression&>(GetMostSigOp()) : static_cast<const Expression&>(GetLeastSigOp());
+    }
 
-        tf::Task generalizeTask = subflow.emplace([this, &generalized](tf::Subflow& sbf) {
-            generalized = Generalize(sbf);
-        });
+    [[nodiscard]] auto GetSharedOperandAt(std::size_t index) const -> std::shared_ptr<Expression> final
+    {
+        assert(index < 2);
+        return index == 0 ? std::shared_ptr<Expression> { mostSigOp } : std::shared_ptr<Expression> { leastSigOp };
+    }
 
-        tf::Task simplifyTask = subflow.emplace([&generalized, &simplified](tf::Subflow& sbf) {
-            simplified = generalized->Simplify(sbf);
-        });
+    [[nodiscard]] auto WithOperands(std::span<const std::shared_ptr<Expression>> operands) const -> std::unique_ptr<Expression> final
+    {
+        assert(operands.size() == 2);
 
-        simplifyTask.succeed(generalizeTask);
-        subflow.join();
+        auto generalized = std::make_unique<DerivedGeneralized>();
+        generalized->mostSigOp = operands[0];
+        generalized->leastSigOp = operands[1];
 
-        return simplified;
+        return generalized;
     }
 
     [[nodiscard]] auto StructurallyEquivalent(const Expression& other) const -> bool override
@@ -342,20 +344,11 @@ public:
      */
     auto Flatten(std::vector<std::unique_ptr<Expression>>& out) const -> void
     {
-        if (this->mostSigOp->template Is<DerivedT>()) {
-            auto generalizedMostSigOp = this->mostSigOp->Generalize();
-            const auto& mostSigOp = static_cast<const DerivedGeneralized&>(*generalizedMostSigOp);
-            mostSigOp.Flatten(out);
-        } else {
-            out.push_back(this->mostSigOp->Copy());
-        }
+        std::vector<const Expression*> terms;
+        CollectTerms(*this, terms);
 
-        if (this->leastSigOp->template Is<DerivedT>()) {
-            auto generalizedLeastSigOp = this->leastSigOp->Generalize();
-            const auto& leastSigOp = static_cast<const DerivedGeneralized&>(*generalizedLeastSigOp);
-            leastSigOp.Flatten(out);
-        } else {
-            out.push_back(this->leastSigOp->Copy());
+        for (const Expression* term : terms) {
+            out.push_back(term->Copy());
         }
     }
 
@@ -404,10 +397,12 @@ public:
     auto SetMostSigOp(const MostSigOpT& op) -> void
     {
         if constexpr (std::same_as<MostSigOpT, Expression>) {
-            this->mostSigOp = op.Copy();
+            this->mostSigOp = ExpressionArena::Share(op.Copy());
         } else {
-            this->mostSigOp = std::make_unique<MostSigOpT>(op);
+            this->mostSigOp = ExpressionArena::Share(std::make_unique<MostSigOpT>(op));
         }
+
+        this->Invalidate();
     }
 
     /**
@@ -417,70 +412,90 @@ public:
     auto SetLeastSigOp(const LeastSigOpT& op) -> void
     {
         if constexpr (std::same_as<LeastSigOpT, Expression>) {
-            this->leastSigOp = op.Copy();
+            this->leastSigOp = ExpressionArena::Share(op.Copy());
         } else {
-            this->leastSigOp = std::make_unique<LeastSigOpT>(op);
+            this->leastSigOp = ExpressionArena::Share(std::make_unique<LeastSigOpT>(op));
         }
+
+        this->Invalidate();
     }
 
+    /**
+     * Sets the most significant operand of this expression, taking ownership of it.
+     *
+     * The operand is only copied if it needs to be specialized to the operand type.
+     *
+     * @param op The operand to set.
+     */
     template <typename T>
-        requires IsAnyOf<T, MostSigOpT, Expression>
+        requires std::derived_from<T, MostSigOpT> || std::same_as<T, Expression>
     auto SetMostSigOp(std::unique_ptr<T>&& op) -> void
     {
-        if constexpr (std::same_as<T, Expression>) {
+        if constexpr (!std::derived_from<T, MostSigOpT>) {
             auto specializedOp = MostSigOpT::Specialize(*op);
             assert(specializedOp);
-            this->mostSigOp = std::move(specializedOp);
+            this->mostSigOp = ExpressionArena::Share(std::move(specializedOp));
         } else {
-            this->mostSigOp = std::move(op);
+            this->mostSigOp = ExpressionArena::Share(std::move(op));
         }
+
+        this->Invalidate();
     }
 
+    /**
+     * Sets the least significant operand of this expression, taking ownership of it.
+     *
+     * The operand is only copied if it needs to be specialized to the operand type.
+     *
+     * @param op The operand to set.
+     */
     template <typename T>
-        requires IsAnyOf<T, LeastSigOpT, Expression>
+        requires std::derived_from<T, LeastSigOpT> || std::same_as<T, Expression>
     auto SetLeastSigOp(std::unique_ptr<T>&& op) -> void
     {
-        if constexpr (std::same_as<T, Expression>) {
+        if constexpr (!std::derived_from<T, LeastSigOpT>) {
             auto specializedOp = LeastSigOpT::Specialize(*op);
             assert(specializedOp);
-            this->leastSigOp = std::move(specializedOp);
+            this->leastSigOp = ExpressionArena::Share(std::move(specializedOp));
         } else {
-            this->leastSigOp = std::move(op);
+            this->leastSigOp = ExpressionArena::Share(std::move(op));
         }
+
+        this->Invalidate();
     }
 
     template <typename T>
-        requires IsAnyOf<T, MostSigOpT, Expression>
+        requires std::derived_from<T, MostSigOpT> || std::same_as<T, Expression>
     auto SetMostSigOp(std::unique_ptr<T>&& op, tf::Subflow& subflow) -> void
     {
-        if constexpr (std::same_as<T, Expression>) {
+        if constexpr (!std::derived_from<T, MostSigOpT>) {
             auto specializedOp = MostSigOpT::Specialize(*op, subflow);
             assert(specializedOp);
-            this->mostSigOp = std::move(specializedOp);
+            this->mostSigOp = ExpressionArena::Share(std::move(specializedOp));
         } else {
-            this->mostSigOp = std::move(op);
+            this->mostSigOp = ExpressionArena::Share(std::move(op));
         }
+
+        this->Invalidate();
     }
 
     template <typename T>
-        requires IsAnyOf<T, LeastSigOpT, Expression>
+        requires std::derived_from<T, LeastSigOpT> || std::same_as<T, Expression>
     auto SetLeastSigOp(std::unique_ptr<T>&& op, tf::Subflow& subflow) -> void
     {
-        if constexpr (std::same_as<T, Expression>) {
+        if constexpr (!std::derived_from<T, LeastSigOpT>) {
             auto specializedOp = LeastSigOpT::Specialize(*op, subflow);
             assert(specializedOp);
-            this->leastSigOp = std::move(specializedOp);
+            this->leastSigOp = ExpressionArena::Share(std::move(specializedOp));
         } else {
-            this->leastSigOp = std::move(op);
+            this->leastSigOp = ExpressionArena::Share(std::move(op));
         }
+
+        this->Invalidate();
     }
     auto Substitute(const Expression& var, const Expression& val) -> std::unique_ptr<Expression> override
     {
-        std::unique_ptr<Expression> left = ((GetMostSigOp()).Copy())->Substitute(var, val);
-        std::unique_ptr<Expression> right = ((GetLeastSigOp().Copy())->Substitute(var, val));
-        DerivedT<Expression, Expression> comb = DerivedT<Expression, Expression> { *left, *right };
-        auto ret = comb.Simplify();
-        return ret;
+        return SubstituteAll(*this, var, val);
     }
     /**
      * Swaps the operands of this expression.
@@ -494,98 +509,229 @@ public:
     auto operator=(const BinaryExpression& other) -> BinaryExpression& = default;
 
 protected:
-    std::unique_ptr<MostSigOpT> mostSigOp;
-    std::unique_ptr<LeastSigOpT> leastSigOp;
+    [[nodiscard]] auto ComputeHash() const -> std::size_t override
+    {
+        const auto seed = Expression::ComputeHash();
+        const auto mostSigOpHash = mostSigOp ? mostSigOp->Hash() : 0;
+        const auto leastSigOpHash = leastSigOp ? leastSigOp->Hash() : 0;
+
+        if (!(this->GetCategory() & Associative)) {
+            return CombineHash(CombineHash(seed, mostSigOpHash), leastSigOpHash);
+        }
+
+        // The hash of an associative expression is the seed plus the mixed hashes of its flattened
+        // operands. Addition does not depend on grouping or order, and an operand of the same type
+        // contributes its own sum without being flattened.
+        const auto contribution = [seed](const auto& op, std::size_t opHash) -> std::size_t {
+            return op && op->template Is<DerivedT>() ? opHash - seed : MixHash(opHash);
+        };
+
+        return seed + contribution(mostSigOp, mostSigOpHash) + contribution(leastSigOp, leastSigOpHash);
+    }
+
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> override
+    {
+        return Generalize()->Simplify();
+    }
+
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression> override
+    {
+        // A generalized expression without rules of its own is left as it is.
+        if constexpr (std::is_same_v<DerivedGeneralized, DerivedSpecialized>) {
+            return this->Copy();
+        } else {
+            return DifferentiateNode(*Generalize(), differentiationVariable, derivatives);
+        }
+    }
+
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> override
+    {
+        std::unique_ptr<Expression> generalized, simplified;
+
+        tf::Task generalizeTask = subflow.emplace([this, &generalized](tf::Subflow& sbf) {
+            generalized = Generalize(sbf);
+        });
+
+        tf::Task simplifyTask = subflow.emplace([&generalized, &simplified](tf::Subflow& sbf) {
+            simplified = generalized->Simplify(sbf);
+        });
+
+        simplifyTask.succeed(generalizeTask);
+        subflow.join();
+
+        return simplified;
+    }
+
+    std::shared_ptr<MostSigOpT> mostSigOp;
+    std::shared_ptr<LeastSigOpT> leastSigOp;
+
+private:
+    // Collects the operands of an expression of this type, expanding nested operands of the same
+    // type with an explicit stack, since chains built by BuildFromVector or by repeated operations
+    // can be arbitrarily deep.
+    static auto CollectTerms(const Expression& expression, std::vector<const Expression*>& out) -> void
+    {
+        std::vector<const Expression*> stack;
+
+        for (std::size_t i = expression.GetOperandCount(); i-- > 0;) {
+            stack.push_back(&expression.GetOperandAt(i));
+        }
+
+        while (!stack.empty()) {
+            const Expression* operand = stack.back();
+            stack.pop_back();
+
+            if (!operand->template Is<DerivedT>()) {
+                out.push_back(operand);
+                continue;
+            }
+
+            for (std::size_t i = operand->GetOperandCount(); i-- > 0;) {
+                stack.push_back(&operand->GetOperandAt(i));
+            }
+        }
+    }
+
+    // Collects the terms of two expressions of this type side by side. An operand that both share
+    // in the same position is collected as a single term of each instead of being flattened, since
+    // its terms are the same on both sides.
+    static auto CollectTerms(const Expression& lhs, const Expression& rhs, std::vector<const Expression*>& lhsOut, std::vector<const Expression*>& rhsOut) -> void
+    {
+        const auto collect = [](const Expression& operand, std::vector<const Expression*>& out) {
+            if (operand.template Is<DerivedT>()) {
+                CollectTerms(operand, out);
+            } else {
+                out.push_back(&operand);
+            }
+        };
+
+        std::vector<std::pair<const Expression*, const Expression*>> stack { { &lhs, &rhs } };
+
+        while (!stack.empty()) {
+            const auto [left, right] = stack.back();
+            stack.pop_back();
+
+            if (left == right) {
+                lhsOut.push_back(left);
+                rhsOut.push_back(right);
+                continue;
+            }
+
+            if (!left->template Is<DerivedT>() || !right->template Is<DerivedT>() || left->GetOperandCount() != right->GetOperandCount()) {
+                collect(*left, lhsOut);
+                collect(*right, rhsOut);
+                continue;
+            }
+
+            for (std::size_t i = left->GetOperandCount(); i-- > 0;) {
+                stack.emplace_back(&left->GetOperandAt(i), &right->GetOperandAt(i));
+            }
+        }
+    }
 };
 
-#define IMPL_SPECIALIZE(Derived, FirstOp, SecondOp)                                                                      \
-    static auto Specialize(const Expression& other) -> std::unique_ptr<Derived<FirstOp, SecondOp>>                       \
-    {                                                                                                                    \
-        if (!other.Is<Oasis::Derived>()) {                                                                               \
-            return nullptr;                                                                                              \
-        }                                                                                                                \
-        auto specialized = std::make_unique<Derived<FirstOp, SecondOp>>();                                               \
-                                                                                                                         \
-        std::unique_ptr<Expression> otherGeneralized = other.Generalize();                                               \
-        const auto& otherBinaryExpression = static_cast<const Derived<Expression>&>(*otherGeneralized);                  \
-                                                                                                                         \
-        bool leftOperandSpecialized = true, rightOperandSpecialized = true;                                              \
-                                                                                                                         \
-        if (otherBinaryExpression.HasMostSigOp()) {                                                                      \
-            specialized->SetMostSigOp(FirstOp::Specialize(otherBinaryExpression.GetMostSigOp()));                        \
-            leftOperandSpecialized = specialized->HasMostSigOp();                                                        \
-        }                                                                                                                \
-                                                                                                                         \
-        if (otherBinaryExpression.HasLeastSigOp()) {                                                                     \
-            specialized->SetLeastSigOp(SecondOp::Specialize(otherBinaryExpression.GetLeastSigOp()));                     \
-            rightOperandSpecialized = specialized->HasLeastSigOp();                                                      \
-        }                                                                                                                \
-                                                                                                                         \
-        if (leftOperandSpecialized && rightOperandSpecialized) {                                                         \
-            return specialized;                                                                                          \
-        }                                                                                                                \
-                                                                                                                         \
-        if (!(other.GetCategory() & Commutative)) {                                                                      \
-            return nullptr;                                                                                              \
-        }                                                                                                                \
-                                                                                                                         \
-        leftOperandSpecialized = true, rightOperandSpecialized = true;                                                   \
-        specialized = std::make_unique<Derived<FirstOp, SecondOp>>();                                                    \
-                                                                                                                         \
-        auto otherWithSwappedOps                                                                                         \
-            = otherBinaryExpression.SwapOperands();                                                                      \
-        if (otherWithSwappedOps.HasMostSigOp()) {                                                                        \
-            specialized->SetMostSigOp(FirstOp::Specialize(otherWithSwappedOps.GetMostSigOp()));                          \
-            leftOperandSpecialized = specialized->HasMostSigOp();                                                        \
-        }                                                                                                                \
-                                                                                                                         \
-        if (otherWithSwappedOps.HasLeastSigOp()) {                                                                       \
-            specialized->SetLeastSigOp(SecondOp::Specialize(otherWithSwappedOps.GetLeastSigOp()));                       \
-            rightOperandSpecialized = specialized->HasLeastSigOp();                                                      \
-        }                                                                                                                \
-                                                                                                                         \
-        if (leftOperandSpecialized && rightOperandSpecialized) {                                                         \
-            return specialized;                                                                                          \
-        }                                                                                                                \
-                                                                                                                         \
-        return nullptr;                                                                                                  \
-    }                                                                                                                    \
-                                                                                                                         \
-    static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Derived<FirstOp, SecondOp>> \
-    {                                                                                                                    \
-        if (!other.Is<Oasis::Derived>()) {                                                                               \
-            return nullptr;                                                                                              \
-        }                                                                                                                \
-                                                                                                                         \
-        Derived<FirstOp, SecondOp> multiply;                                                                             \
-                                                                                                                         \
-        std::unique_ptr<Expression> otherGeneralized;                                                                    \
-                                                                                                                         \
-        tf::Task generalizeTask = subflow.emplace([&other, &otherGeneralized](tf::Subflow& sbf) {                        \
-            otherGeneralized = other.Generalize(sbf);                                                                    \
-        });                                                                                                              \
-                                                                                                                         \
-        tf::Task mostSigOpTask = subflow.emplace([&multiply, &otherGeneralized](tf::Subflow& sbf) {                      \
-            const auto& otherBinaryExpression = dynamic_cast<const Derived<Expression>&>(*otherGeneralized);             \
-            if (otherBinaryExpression.HasMostSigOp()) {                                                                  \
-                multiply.SetMostSigOp(*FirstOp::Specialize(otherBinaryExpression.GetMostSigOp(), sbf));                  \
-            }                                                                                                            \
-        });                                                                                                              \
-                                                                                                                         \
-        mostSigOpTask.succeed(generalizeTask);                                                                           \
-                                                                                                                         \
-        tf::Task leastSigOpTask = subflow.emplace([&multiply, &otherGeneralized](tf::Subflow& sbf) {                     \
-            const auto& otherBinaryExpression = dynamic_cast<const Derived<Expression>&>(*otherGeneralized);             \
-            if (otherBinaryExpression.HasLeastSigOp()) {                                                                 \
-                multiply.SetLeastSigOp(*SecondOp::Specialize(otherBinaryExpression.GetLeastSigOp(), sbf));               \
-            }                                                                                                            \
-        });                                                                                                              \
-                                                                                                                         \
-        leastSigOpTask.succeed(generalizeTask);                                                                          \
-                                                                                                                         \
-        subflow.join();                                                                                                  \
-                                                                                                                         \
-        return std::make_unique<Derived<FirstOp, SecondOp>>(multiply);                                                   \
+#define IMPL_SPECIALIZE(Derived, FirstOp, SecondOp)                                                                          \
+    static auto Specialize(const Expression& other) -> std::unique_ptr<Derived<FirstOp, SecondOp>>                           \
+    {                                                                                                                        \
+        if (!other.Is<Oasis::Derived>()) {                                                                                   \
+            return nullptr;                                                                                                  \
+        }                                                                                                                    \
+        auto specialized = std::make_unique<Derived<FirstOp, SecondOp>>();                                                   \
+                                                                                                                             \
+        std::unique_ptr<Expression> otherGeneralized = other.Generalize();                                                   \
+        const auto& otherBinaryExpression = static_cast<const Derived<Expression>&>(*otherGeneralized);                      \
+                                                                                                                             \
+        bool leftOperandSpecialized = true, rightOperandSpecialized = true;                                                  \
+                                                                                                                             \
+        if (otherBinaryExpression.HasMostSigOp()) {                                                                          \
+            specialized->SetMostSigOp(FirstOp::Specialize(otherBinaryExpression.GetMostSigOp()));                            \
+            leftOperandSpecialized = specialized->HasMostSigOp();                                                            \
+        }                                                                                                                    \
+                                                                                                                             \
+        if (otherBinaryExpression.HasLeastSigOp()) {                                                                         \
+            specialized->SetLeastSigOp(SecondOp::Specialize(otherBinaryExpression.GetLeastSigOp()));                         \
+            rightOperandSpecialized = specialized->HasLeastSigOp();                                                          \
+        }                                                                                                                    \
+                                                                                                                             \
+        if (leftOperandSpecialized && rightOperandSpecialized) {                                                             \
+            return specialized;                                                                                              \
+        }                                                                                                                    \
+                                                                                                                             \
+        if (!(other.GetCategory() & Commutative)) {                                                                          \
+            return nullptr;                                                                                                  \
+        }                                                                                                                    \
+                                                                                                                             \
+        leftOperandSpecialized = true, rightOperandSpecialized = true;                                                       \
+        specialized = std::make_unique<Derived<FirstOp, SecondOp>>();                                                        \
+                                                                                                                             \
+        auto otherWithSwappedOps                                                                                             \
+            = otherBinaryExpression.SwapOperands();                                                                          \
+        if (otherWithSwappedOps.HasMostSigOp()) {                                                                            \
+            specialized->SetMostSigOp(FirstOp::Specialize(otherWithSwappedOps.GetMostSigOp()));                              \
+            leftOperandSpecialized = specialized->HasMostSigOp();                                                            \
+        }                                                                                                                    \
+                                                                                                                             \
+        if (otherWithSwappedOps.HasLeastSigOp()) {                                                                           \
+            specialized->SetLeastSigOp(SecondOp::Specialize(otherWithSwappedOps.GetLeastSigOp()));                           \
+            rightOperandSpecialized = specialized->HasLeastSigOp();                                                          \
+        }                                                                                                                    \
+                                                                                                                             \
+        if (leftOperandSpecialized && rightOperandSpecialized) {                                                             \
+            return specialized;                                                                                              \
+        }                                                                                                                    \
+                                                                                                                             \
+        return nullptr;                                                                                                      \
+    }                                                                                                                        \
+                                                                                                                             \
+    static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Derived<FirstOp, SecondOp>>     \
+    {                                                                                                                        \
+        if (!other.Is<Oasis::Derived>()) {                                                                                   \
+            return nullptr;                                                                                                  \
+        }                                                                                                                    \
+                                                                                                                             \
+        Derived<FirstOp, SecondOp> multiply;                                                                                 \
+        bool mostSigOpSpecialized = true, leastSigOpSpecialized = true;                                                      \
+                                                                                                                             \
+        std::unique_ptr<Expression> otherGeneralized;                                                                        \
+                                                                                                                             \
+        tf::Task generalizeTask = subflow.emplace([&other, &otherGeneralized](tf::Subflow& sbf) {                            \
+            otherGeneralized = other.Generalize(sbf);                                                                        \
+        });                                                                                                                  \
+                                                                                                                             \
+        tf::Task mostSigOpTask = subflow.emplace([&multiply, &otherGeneralized, &mostSigOpSpecialized](tf::Subflow& sbf) {   \
+            const auto& otherBinaryExpression = dynamic_cast<const Derived<Expression>&>(*otherGeneralized);                 \
+            if (otherBinaryExpression.HasMostSigOp()) {                                                                      \
+                auto specializedOp = FirstOp::Specialize(otherBinaryExpression.GetMostSigOp(), sbf);                         \
+                mostSigOpSpecialized = specializedOp != nullptr;                                                             \
+                if (specializedOp) {                                                                                         \
+                    multiply.SetMostSigOp(*specializedOp);                                                                   \
+                }                                                                                                            \
+            }                                                                                                                \
+        });                                                                                                                  \
+                                                                                                                             \
+        mostSigOpTask.succeed(generalizeTask);                                                                               \
+                                                                                                                             \
+        tf::Task leastSigOpTask = subflow.emplace([&multiply, &otherGeneralized, &leastSigOpSpecialized](tf::Subflow& sbf) { \
+            const auto& otherBinaryExpression = dynamic_cast<const Derived<Expression>&>(*otherGeneralized);                 \
+            if (otherBinaryExpression.HasLeastSigOp()) {                                                                     \
+                auto specializedOp = SecondOp::Specialize(otherBinaryExpression.GetLeastSigOp(), sbf);                       \
+                leastSigOpSpecialized = specializedOp != nullptr;                                                            \
+                if (specializedOp) {                                                                                         \
+                    multiply.SetLeastSigOp(*specializedOp);                                                                  \
+                }                                                                                                            \
+            }                                                                                                                \
+        });                                                                                                                  \
+                                                                                                                             \
+        leastSigOpTask.succeed(generalizeTask);                                                                              \
+                                                                                                                             \
+        subflow.join();                                                                                                      \
+                                                                                                                             \
+        if (!mostSigOpSpecialized || !leastSigOpSpecialized) {                                                               \
+            /* The operands may still match when swapped */                                                                  \
+            return Specialize(other);                                                                                        \
+        }                                                                                                                    \
+                                                                                                                             \
+        return std::make_unique<Derived<FirstOp, SecondOp>>(multiply);                                                       \
     }
 } // Oasis
 
@@ -0,0 +1,50 @@
+#ifndef OASIS_CANONICALORDER_HPP
+#define OASIS_CANONICALORDER_HPP
+
+#include <compare>
+#include <memory>
+
+#include "Expression.hpp"
+
+namespace Oasis {
+
+/**
+ * Compares two expressions in the canonical order.
+ *
+ * The canonical order is a total order on the structure of expressions. Expressions are ordered
+ * first by type, then by their value or name if they are real numbers or variables, then by their
+ * number of operands, and finally by their operands from the most significant to the least
+ * significant. It does not depend on the order in which the expressions were created, so sorting by
+ * it gives the same result every time.
+ *
+ * Expressions with the same structure compare equivalent. Expressions that are equal only up to the
+ * order of the operands of a commutative operation, such as `a + b` and `b + a`, do not.
+ *
+ * The comparison keeps its own stack instead of recursing, so it is safe to use on expressions of
+ * any depth.
+ *
+ * @param lhs The first expression.
+ * @param rhs The second expression.
+ * @return The order of the first expression relative to the second.
+ */
+[[nodiscard]] auto CompareCanonical(const Expression& lhs, const Expression& rhs) -> std::strong_ordering;
+
+/**
+ * A function object that orders expressions by the canonical order, for use with sorting
+ * algorithms and ordered containers.
+ */
+struct CanonicalLess {
+    auto operator()(const Expression& lhs, const Expression& rhs) const -> bool
+    {
+        return CompareCanonical(lhs, rhs) < 0;
+    }
+
+    auto operator()(const std::unique_ptr<Expression>& lhs, const std::unique_ptr<Expression>& rhs) const -> bool
+    {
+        return CompareCanonical(*lhs, *rhs) < 0;
+    }
+};
+
+} // Oasis
+
+#endif // OASIS_CANONICALORDER_HPP
@@ -24,17 +24,18 @@ public:
     Derivative(const Derivative<Expression, Expression>& other) = default;
 
     Derivative(const Expression& Exp, const Expression& Var);
-
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> final;
-    // auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
-
-    [[nodiscard]] auto ToString() const -> std::string final;
+    Derivative(std::unique_ptr<Expression>&& Exp, std::unique_ptr<Expression>&& Var);
 
     static auto Specialize(const Expression& other) -> std::unique_ptr<Derivative>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Derivative>;
 
     EXPRESSION_TYPE(Derivative)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    // auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
 };
 /// @endcond
 
@@ -58,9 +59,9 @@ public:
     {
     }
 
-    [[nodiscard]] auto ToString() const -> std::string final
+    Derivative(std::unique_ptr<Exp>&& exp, std::unique_ptr<Var>&& var)
+        : BinaryExpression<Derivative, Exp, Var>(std::move(exp), std::move(var))
     {
-        return fmt::format("(d/d{}({}))", this->leastSigOp->ToString(), this->mostSigOp->ToString());
     }
 
     IMPL_SPECIALIZE(Derivative, Exp, Var)
@@ -69,6 +70,12 @@ public:
 
     EXPRESSION_TYPE(Derivative)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final
+    {
+        return fmt::format("(d/d{}({}))", this->leastSigOp->ToString(), this->mostSigOp->ToString());
+    }
 };
 
 } // namespace Oasis
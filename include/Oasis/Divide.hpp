@@ -23,18 +23,20 @@ public:
     Divide(const Divide<Expression, Expression>& other) = default;
 
     Divide(const Expression& dividend, const Expression& divisor);
+    Divide(std::unique_ptr<Expression>&& dividend, std::unique_ptr<Expression>&& divisor);
 
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> final;
-    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
-
-    [[nodiscard]] auto ToString() const -> std::string final;
-    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression> final;
 
     static auto Specialize(const Expression& other) -> std::unique_ptr<Divide>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Divide>;
 
     EXPRESSION_TYPE(Divide)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression> final;
 };
 /// @endcond
 
@@ -58,9 +60,9 @@ public:
     {
     }
 
-    [[nodiscard]] auto ToString() const -> std::string final
+    Divide(std::unique_ptr<DividendT>&& addend1, std::unique_ptr<DivisorT>&& addend2)
+        : BinaryExpression<Divide, DividendT, DivisorT>(std::move(addend1), std::move(addend2))
     {
-        return fmt::format("({} + {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
     }
 
     IMPL_SPECIALIZE(Divide, DividendT, DivisorT)
@@ -69,6 +71,12 @@ public:
 
     EXPRESSION_TYPE(Divide)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final
+    {
+        return fmt::format("({} + {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
+    }
 };
 
 } // Oasis
@@ -24,18 +24,20 @@ public:
     Exponent(const Exponent<Expression, Expression>& other) = default;
 
     Exponent(const Expression& base, const Expression& power);
+    Exponent(std::unique_ptr<Expression>&& base, std::unique_ptr<Expression>&& power);
 
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> final;
-    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
-
-    [[nodiscard]] auto ToString() const -> std::string final;
-    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression> final;
 
     static auto Specialize(const Expression& other) -> std::unique_ptr<Exponent>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Exponent>;
 
     EXPRESSION_TYPE(Exponent)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression> final;
 };
 /// @endcond
 
@@ -59,9 +61,9 @@ public:
     {
     }
 
-    [[nodiscard]] auto ToString() const -> std::string final
+    Exponent(std::unique_ptr<BaseT>&& base, std::unique_ptr<PowerT>&& power)
+        : BinaryExpression<Exponent, BaseT, PowerT>(std::move(base), std::move(power))
     {
-        return fmt::format("({}^{})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
     }
 
     IMPL_SPECIALIZE(Exponent, BaseT, PowerT)
@@ -70,6 +72,12 @@ public:
 
     EXPRESSION_TYPE(Exponent)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final
+    {
+        return fmt::format("({}^{})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
+    }
 };
 
 }
@@ -0,0 +1,144 @@
+#ifndef OASIS_EXPR_HPP
+#define OASIS_EXPR_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "Expression.hpp"
+
+namespace Oasis {
+
+/**
+ * A shared, immutable expression.
+ *
+ * An Expr is a reference-counted handle to an expression that can only be read through it. Copying
+ * an Expr copies the handle, not the expression, so Exprs can be stored, returned, and passed
+ * around in constant time. Since the expression cannot be modified through the handle, copies of
+ * an Expr may be read from multiple threads at once.
+ *
+ * Operations on an Expr return new Exprs that share every subtree the operation did not need to
+ * change with their input. For example, substituting into a simplified expression only rebuilds
+ * the nodes on the paths to the substituted variable.
+ *
+ * An Expr is created from any expression, and its expression can be read through `Get`, so it can
+ * be used alongside the rest of the library.
+ */
+class Expr {
+public:
+    /**
+     * Creates an Expr from a copy of an expression.
+     *
+     * Copies of expressions share their operands, so this is constant time.
+     *
+     * @param expression The expression.
+     */
+    Expr(const Expression& expression);
+
+    /**
+     * Creates an Expr that takes ownership of an expression.
+     *
+     * @param expression The expression, which must not be `nullptr`.
+     */
+    Expr(std::unique_ptr<Expression>&& expression);
+
+    /**
+     * Creates an Expr that shares an expression, such as an operand of another expression.
+     *
+     * The expression must not be modified afterwards.
+     *
+     * @param expression The expression, which must not be `nullptr`.
+     */
+    explicit Expr(std::shared_ptr<Expression> expression);
+
+    /**
+     * Differentiates this expression.
+     *
+     * @param variable The variable to differentiate with respect to.
+     * @return The derivative of this expression.
+     */
+    [[nodiscard]] auto Differentiate(const Expr& variable) const -> Expr;
+
+    /**
+     * Gets whether this expression is equal to another.
+     *
+     * @param other The other expression.
+     * @return Whether the expressions are equal.
+     */
+    [[nodiscard]] auto Equals(const Expr& other) const -> bool;
+
+    /**
+     * Gets the expression this Expr refers to.
+     *
+     * @return The expression.
+     */
+    [[nodiscard]] auto Get() const -> const Expression&;
+
+    /**
+     * Gets an operand of this expression.
+     *
+     * @param index The index of the operand.
+     * @return The operand, which is shared with this expression.
+     */
+    [[nodiscard]] auto GetOperand(std::size_t index) const -> Expr;
+
+    [[nodiscard]] auto GetOperandCount() const -> std::size_t;
+
+    [[nodiscard]] auto Hash() const -> std::size_t;
+
+    /**
+     * Simplifies this expression.
+     *
+     * If the expression is already simplified, it is returned as is.
+     *
+     * @return The simplified expression.
+     */
+    [[nodiscard]] auto Simplify() const -> Expr;
+
+    /**
+     * Substitutes a value for a variable in this expression, and simplifies the result.
+     *
+     * @param var The variable to substitute.
+     * @param val The value to substitute.
+     * @return The simplified expression with the value substituted.
+     */
+    [[nodiscard]] auto Substitute(const Expr& var, const Expr& val) const -> Expr;
+
+    [[nodiscard]] auto ToString() const -> std::string;
+
+    template <IExpression T>
+    [[nodiscard]] auto Is() const -> bool
+    {
+        return expression->Is<T>();
+    }
+
+    template <template <typename, typename> typename T>
+    [[nodiscard]] auto Is() const -> bool
+    {
+        return expression->Is<T>();
+    }
+
+    auto operator*() const -> const Expression&;
+    auto operator->() const -> const Expression*;
+    auto operator==(const Expr& other) const -> bool;
+
+private:
+    std::shared_ptr<Expression> expression;
+};
+
+auto operator+(const Expr& lhs, const Expr& rhs) -> Expr;
+auto operator-(const Expr& lhs, const Expr& rhs) -> Expr;
+auto operator*(const Expr& lhs, const Expr& rhs) -> Expr;
+auto operator/(const Expr& lhs, const Expr& rhs) -> Expr;
+
+} // Oasis
+
+template <>
+struct std::hash<Oasis::Expr> {
+    auto operator()(const Oasis::Expr& expr) const -> std::size_t
+    {
+        return expr.Hash();
+    }
+};
+
+#endif // OASIS_EXPR_HPP
@@ -1,9 +1,16 @@
 #ifndef OASIS_EXPRESSION_HPP
 #define OASIS_EXPRESSION_HPP
 
+#include <atomic>
+#include <complex>
 #include <concepts>
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <optional>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace tf {
@@ -32,6 +39,12 @@ enum class ExpressionType {
     Derivative,
     Negate,
     Sqrt,
+    Sum,
+    Product,
+    Rational,
+
+    // The number of expression types, not a type itself. New types go before it.
+    Count,
 };
 
 /**
@@ -91,9 +104,16 @@ public:
 
     /**
      * Tries to differentiate this function.
+     *
+     * @note This function is not virtual. It simplifies the expression once, differentiates the
+     *       operands of the simplified expression with an explicit stack, and then calls
+     *       `ComputeDerivative` on each node. The derivative is simplified once at the end.
+     *       Subclasses customize differentiation by overriding `ComputeDerivative`.
+     *
+     * @param differentiationVariable The variable to differentiate with respect to.
      * @return the differentiated expression.
      */
-    [[nodiscard]] virtual auto Differentiate(const Expression&) -> std::unique_ptr<Expression>;
+    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) const -> std::unique_ptr<Expression>;
 
     /**
      * Compares this expression to another expression for equality.
@@ -103,18 +123,91 @@ public:
      * simplify the expressions before comparing them. For example, `Add<Real>(Real(1), Real(2))`
      * and `Add<Real>(Real(2), Real(1))` are not equal, despite being structurally equivalent.
      *
+     * Chains of expressions with operands are compared with an explicit stack, so comparing deep
+     * expressions is safe. Only an associative expression nested within an associative expression
+     * of a different type is compared by a nested call, so the depth of the call stack is bounded by
+     * the number of such alternations rather than by the depth of the expression.
+     *
      * @param other The other expression.
      * @return Whether the two expressions are equal.
      */
     [[nodiscard]] virtual auto Equals(const Expression& other) const -> bool = 0;
 
     /**
-     * The FindZeros function finds all rational real zeros, and up to 2 irrational/complex zeros of a polynomial. Currently assumes an expression of the form a+bx+cx^2+dx^3+... where a, b, c, d are a integers.
+     * Expands the polynomials in this expression.
+     *
+     * Each largest subexpression that is a polynomial, such as `(x + 1)^50 * (x - 2)^40`, is
+     * multiplied out into a sum of terms in decreasing order of their degree. Dense products of
+     * polynomials in one variable with integer coefficients are multiplied by a subquadratic kernel
+     * instead of by rewriting trees. The rest of the expression is left as it is.
      *
-     * @tparam origonalExpresion The expression for which all the factors will be found.
+     * The coefficients are computed exactly. They become rational numbers if the polynomial
+     * contains any, or if a double cannot represent them, and real numbers otherwise.
+     *
+     * @return The expanded expression.
+     * @throws std::overflow_error If an exponent of an expanded polynomial is too large.
+     */
+    [[nodiscard]] auto Expand() const -> std::unique_ptr<Expression>;
+
+    /**
+     * Finds the zeros of a polynomial in one variable that can be written exactly.
+     *
+     * The coefficients, whether real or rational, are scaled exactly to integers by the least
+     * common multiple of their denominators, and the polynomial is decomposed into square-free
+     * factors. Each rational zero of a factor is found by the rational root theorem, and whatever
+     * remains of a factor is solved by the quadratic formula if it has degree one or two. Zeros of
+     * a remainder of higher degree are not found; `FindZerosNumeric` finds those.
+     *
+     * Expressions that are not polynomials, such as those with negative powers of the variable,
+     * are matched term by term instead.
+     *
+     * @return Each distinct zero that is found, once.
      */
     auto FindZeros() const -> std::vector<std::unique_ptr<Expression>>;
 
+    /**
+     * Finds the zeros of a polynomial as `FindZeros` does, together with their multiplicities.
+     *
+     * A polynomial with integer coefficients is first decomposed into square-free factors, so that
+     * each distinct zero is searched for once, in the factor whose index gives its multiplicity.
+     *
+     * @return Each distinct zero that is found, and the number of times it is repeated.
+     */
+    auto FindZerosWithMultiplicity() const -> std::vector<std::pair<std::unique_ptr<Expression>, std::size_t>>;
+
+    /**
+     * Finds every complex zero of a polynomial in one variable numerically, including those that
+     * `FindZeros` cannot express, with `FindRoots`.
+     *
+     * @param tolerance The relative accuracy to which each zero is polished.
+     * @param polish Whether to polish each zero by Newton's method.
+     * @return The zeros, repeated by their multiplicities, or none if the expression is not a
+     * nonzero polynomial in one variable.
+     */
+    [[nodiscard]] auto FindZerosNumeric(double tolerance = 1e-12, bool polish = true) const -> std::vector<std::complex<double>>;
+
+    /**
+     * Finds the distinct real zeros of a polynomial in one variable within an interval, with
+     * `FindRealRoots`, which isolates them exactly before refining them.
+     *
+     * @param lower The lower end of the interval, which may be negative infinity.
+     * @param upper The upper end of the interval, which may be infinity.
+     * @param tolerance The largest distance between a returned value and the zero it approximates.
+     * @return The zeros, in ascending order, or none if the expression is not a nonzero polynomial in
+     * one variable.
+     */
+    [[nodiscard]] auto FindRealZeros(double lower, double upper, double tolerance = 1e-12) const -> std::vector<double>;
+
+    /**
+     * Evaluates a polynomial in at most one variable at many points with `EvaluateMultipoint`,
+     * which is much faster than substituting each point and simplifying.
+     *
+     * @param points The values of the variable.
+     * @return The value of the polynomial at each point, or `std::nullopt` if the expression is
+     * not a polynomial in at most one variable.
+     */
+    [[nodiscard]] auto EvaluateAt(std::span<const double> points) const -> std::optional<std::vector<double>>;
+
     /**
      * Gets the category of this expression.
      * @return The category of this expression.
@@ -127,6 +220,67 @@ public:
      */
     [[nodiscard]] virtual auto GetType() const -> ExpressionType;
 
+    /**
+     * Gets a hash of this expression.
+     *
+     * The hash is computed the first time it is requested and cached in the expression. Equal
+     * expressions have equal hashes, taking the associativity and commutativity of expressions into
+     * account, so two expressions with different hashes are known to be unequal without comparing
+     * them.
+     *
+     * @return The hash of this expression.
+     */
+    [[nodiscard]] auto Hash() const -> std::size_t;
+
+    /**
+     * Gets whether this expression is known to be simplified.
+     *
+     * Expressions returned by `Simplify` are flagged as simplified, and so are their copies.
+     * Simplifying a flagged expression returns a copy of it without visiting its operands.
+     *
+     * @return Whether this expression is known to be simplified.
+     */
+    [[nodiscard]] auto IsSimplified() const -> bool;
+
+    /**
+     * Gets the number of operands of this expression.
+     *
+     * Leaf expressions have no operands, unary expressions have one, and binary expressions have two.
+     *
+     * @return The number of operands of this expression.
+     */
+    [[nodiscard]] virtual auto GetOperandCount() const -> std::size_t;
+
+    /**
+     * Gets an operand of this expression without copying it.
+     *
+     * Operands are numbered from the most significant to the least significant operand.
+     *
+     * @param index The index of the operand, which must be less than `GetOperandCount()`.
+     * @return The operand at the given index.
+     */
+    [[nodiscard]] virtual auto GetOperandAt(std::size_t index) const -> const Expression&;
+
+    /**
+     * Gets shared ownership of an operand of this expression.
+     *
+     * @param index The index of the operand, which must be less than `GetOperandCount()`.
+     * @return The operand at the given index.
+     */
+    [[nodiscard]] virtual auto GetSharedOperandAt(std::size_t index) const -> std::shared_ptr<Expression>;
+
+    /**
+     * Creates an expression of the same type as this expression with different operands.
+     *
+     * The operands are shared with the new expression rather than copied. Because the operands may
+     * be of any type, the new expression is generalized. Leaf expressions have no operands and
+     * return a copy of themselves.
+     *
+     * @param operands The operands of the new expression. There must be `GetOperandCount()` of them.
+     * @return The new expression.
+     */
+    [[nodiscard]] virtual auto WithOperands(std::span<const std::shared_ptr<Expression>> operands) const -> std::unique_ptr<Expression>;
+
     /**
      * Converts this expression to a more general expression.
      *
@@ -201,9 +355,18 @@ public:
 
     /**
      * Simplifies this expression.
+     *
+     * If a `SimplifyCache` is active, the result is looked up in and stored to the cache.
+     *
+     * @note This function is not virtual. It simplifies the operands of the expression with an
+     *       explicit stack, and then calls `ComputeSimplified` on each rebuilt node. Subclasses
+     *       customize simplification by overriding `ComputeSimplified`. A subclass that declares
+     *       its own `Simplify` hides this function rather than overriding it, and its rules are
+     *       skipped when the expression is simplified as an operand.
+     *
      * @return The simplified expression.
      */
-    [[nodiscard]] virtual auto Simplify() const -> std::unique_ptr<Expression>;
+    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression>;
 
     /**
      * Simplifies this expression asynchronously.
@@ -213,7 +376,7 @@ public:
      * @param subflow The invoking subflow.
      * @return The simplified expression.
      */
-    virtual auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>;
+    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>;
 
     /**
      * Simplifies this expression asynchronously.
@@ -264,11 +427,211 @@ public:
 
     /**
      * Converts this expression to a string.
+     *
+     * @note This function is not virtual. It converts the operands of the expression with an
+     *       explicit stack, and then calls `ComputeString` on each node. Subclasses customize
+     *       their string representation by overriding `ComputeString`. A subclass that declares
+     *       its own `ToString` hides this function rather than overriding it.
+     *
      * @return The string representation of this expression.
      */
-    [[nodiscard]] virtual std::string ToString() const = 0;
+    [[nodiscard]] auto ToString() const -> std::string;
 
     virtual ~Expression() = default;
+
+    /**
+     * Allocates memory for an expression.
+     *
+     * If an `ExpressionArena` is active on the calling thread, the memory is taken from the arena.
+     * Otherwise, it is taken from the heap.
+     *
+     * @param size The size of the expression in bytes.
+     * @return The allocated memory.
+     */
+    static auto operator new(std::size_t size) -> void*;
+
+    /**
+     * Destroys an expression and frees its memory.
+     *
+     * Memory taken from an `ExpressionArena` is only reclaimed when the arena is reset. Whether it
+     * was is recorded when the expression is constructed, so that freeing it costs no lookup.
+     *
+     * @param expression The expression to destroy.
+     */
+    static auto operator delete(Expression* expression, std::destroying_delete_t) -> void;
+
+    /**
+     * Frees memory allocated for an expression whose constructor threw.
+     *
+     * @param ptr The memory to free.
+     */
+    static auto operator delete(void* ptr) -> void;
+
+protected:
+    Expression();
+    Expression(const Expression& other);
+
+    auto operator=(const Expression& other) -> Expression&;
+
+    /**
+     * Computes the hash of this expression.
+     *
+     * Overrides must be consistent with `Equals`, such that equal expressions have equal hashes.
+     * The hashes of operands should be obtained through `Hash`, so that they are only computed once.
+     *
+     * @return The hash of this expression.
+     */
+    [[nodiscard]] virtual auto ComputeHash() const -> std::size_t;
+
+    /**
+     * Simplifies this expression, without consulting a `SimplifyCache`.
+     *
+     * Operands should be simplified through `Simplify`, so that they can be found in the cache.
+     *
+     * @return The simplified expression.
+     */
+    [[nodiscard]] virtual auto ComputeSimplified() const -> std::unique_ptr<Expression>;
+
+    /**
+     * Simplifies this expression asynchronously, without consulting a `SimplifyCache`.
+     *
+     * @param subflow The invoking subflow.
+     * @return The simplified expression.
+     */
+    virtual auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>;
+
+    /**
+     * Differentiates this expression, given the derivatives of its operands.
+     *
+     * Operands must not be differentiated again. Their derivatives are the operands of
+     * `derivatives`, and the result does not need to be simplified.
+     *
+     * @param differentiationVariable The variable to differentiate with respect to.
+     * @param derivatives This expression with each operand replaced by its derivative.
+     * @return The derivative of this expression.
+     */
+    [[nodiscard]] virtual auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression>;
+
+    /**
+     * Converts this expression to a string.
+     *
+     * Operands should be converted through `ToString`, which finds the strings of operands that
+     * were converted ahead of this expression.
+     *
+     * @return The string representation of this expression.
+     */
+    [[nodiscard]] virtual auto ComputeString() const -> std::string = 0;
+
+    /**
+     * Substitutes a value for a variable throughout an expression, and simplifies every
+     * expression rebuilt along the way.
+     *
+     * This is the `Substitute` of expressions with operands. It does not recurse, so it is safe to
+     * use on expressions of any depth.
+     *
+     * @param expression The expression to substitute into.
+     * @param var The variable to substitute.
+     * @param val The value to substitute.
+     * @return The simplified expression with the value substituted.
+     */
+    static auto SubstituteAll(const Expression& expression, const Expression& var, const Expression& val) -> std::unique_ptr<Expression>;
+
+    /**
+     * Differentiates a node, given the derivatives of its operands, through its `ComputeDerivative`.
+     *
+     * This lets specialized expressions defer to the rules of their generalized counterparts.
+     *
+     * @param node The node to differentiate.
+     * @param differentiationVariable The variable to differentiate with respect to.
+     * @param derivatives The node with each operand replaced by its derivative.
+     * @return The derivative of the node.
+     */
+    static auto DifferentiateNode(const Expression& node, const Expression& differentiationVariable, const Expression& derivatives) -> std::unique_ptr<Expression>;
+
+    /**
+     * Releases an operand of an expression that is being destroyed.
+     *
+     * If this was the last reference to the operand, the operand is destroyed without recursing
+     * into its own operands, so that destroying an expression of any depth is safe. Destructors of
+     * expressions with operands should release their operands through this function.
+     *
+     * @param operand The operand to release.
+     */
+    static auto ReleaseOperand(std::shared_ptr<Expression> operand) -> void;
+
+    /**
+     * Compares the operands of two expressions of the same type in order. This is the `Equals` of
+     * expressions that are neither leaves nor associative.
+     *
+     * Operands that are neither leaves nor associative are compared through their own operands,
+     * with an explicit stack, so that chains of such expressions of any depth are compared without
+     * recursing. Other operands are compared with `Equals`.
+     *
+     * @param lhs The first expression.
+     * @param rhs The second expression.
+     * @return Whether the operands of the expressions are equal.
+     */
+    static auto OperandsEqual(const Expression& lhs, const Expression& rhs) -> bool;
+
+    /**
+     * Compares the flattened terms of two associative expressions. This is the `Equals` of
+     * associative expressions.
+     *
+     * Terms are compared in order first, so that identical expressions are compared in linear
+     * time. If the expressions are commutative, each term is then matched with any unmatched term
+     * of the other expression.
+     *
+     * @param lhs The terms of the first expression.
+     * @param rhs The terms of the second expression.
+     * @param commutative Whether the terms may be in any order.
+     * @return Whether the terms are equal.
+     */
+    static auto TermsEqual(std::span<const Expression* const> lhs, std::span<const Expression* const> rhs, bool commutative) -> bool;
+
+    /**
+     * Discards the cached hash of this expression and clears its simplified flag. Must be called
+     * whenever the expression is modified.
+     */
+    auto Invalidate() -> void;
+
+    /**
+     * Combines a hash with another, such that the result depends on the order of combination.
+     *
+     * @param seed The hash to combine into.
+     * @param value The hash to combine.
+     * @return The combined hash.
+     */
+    static auto CombineHash(std::size_t seed, std::size_t value) -> std::size_t;
+
+    /**
+     * Scrambles the bits of a hash.
+     *
+     * Mixed hashes are suitable for combining by addition, which does not depend on the order of
+     * combination.
+     *
+     * @param value The hash to mix.
+     * @return The mixed hash.
+     */
+    static auto MixHash(std::size_t value) -> std::size_t;
+
+private:
+    friend class Expr;
+    friend class ExpressionArena;
+    friend class UniqueTable;
+
+    // Simplifies an expression, sharing operands that are already simplified with the result. The
+    // owner is the pointer that owns the expression, if any, which is returned as is if the
+    // expression is already simplified.
+    static auto SimplifyShared(const Expression& expression, const std::shared_ptr<Expression>& owner) -> std::shared_ptr<Expression>;
+
+    // Substitutes a value for a variable, sharing untouched, simplified operands with the result.
+    static auto SubstituteShared(const Expression& expression, const std::shared_ptr<Expression>& owner, const Expression& var, const Expression& val) -> std::shared_ptr<Expression>;
+
+    mutable std::atomic<std::size_t> hash = 0;
+    std::atomic<bool> simplified = false;
+
+    // Whether this expression was allocated from an `ExpressionArena`, which is not copied.
+    bool arenaAllocated = false;
 };
 
 #define EXPRESSION_TYPE(type)                       \
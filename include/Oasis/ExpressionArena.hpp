@@ -0,0 +1,210 @@
+#ifndef OASIS_EXPRESSIONARENA_HPP
+#define OASIS_EXPRESSIONARENA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Expression.hpp"
+
+namespace Oasis {
+
+/**
+ * A monotonic memory resource for expressions.
+ *
+ * Simplification creates and discards many short-lived expressions. While an arena is active on a
+ * thread, every expression allocated on that thread is carved out of the arena's blocks instead of
+ * the heap, and freeing it costs nothing. Expressions allocated while no arena is in use anywhere
+ * go to the heap directly, without any bookkeeping. Each expression records whether it came from an
+ * arena, so that freeing it on any thread needs no lookup. The memory is reclaimed all at once when
+ * the arena is reset, which is only possible once none of the expressions allocated from it are
+ * alive.
+ *
+ * Expressions allocated from an arena must not outlive it, and destroying an arena that still has
+ * live expressions, or that is active, terminates the program. Use `Detach` to move a result out of
+ * the arena before resetting it, or `Simplify`, which does so automatically.
+ */
+class ExpressionArena {
+public:
+    /**
+     * Activates an arena on the current thread for the lifetime of the scope.
+     *
+     * Scopes may be nested, in which case the previously active arena is restored when the inner
+     * scope ends.
+     */
+    class Scope {
+    public:
+        explicit Scope(ExpressionArena& arena);
+        Scope(const Scope& other) = delete;
+        ~Scope();
+
+        auto operator=(const Scope& other) -> Scope& = delete;
+
+    private:
+        ExpressionArena* previous;
+    };
+
+    explicit ExpressionArena(std::size_t blockSize = 64 * 1024);
+    ExpressionArena(const ExpressionArena& other) = delete;
+    ~ExpressionArena();
+
+    /**
+     * Copies an expression out of this arena.
+     *
+     * Nodes of the expression that were allocated from this arena are copied to the heap, while
+     * nodes that were not are shared with the copy. The arena must not be active on the calling
+     * thread.
+     *
+     * @param expression The expression to detach.
+     * @return An equivalent expression that does not depend on this arena.
+     */
+    [[nodiscard]] auto Detach(const Expression& expression) const -> std::unique_ptr<Expression>;
+
+    /**
+     * Gets the number of bytes handed out since the arena was last reset.
+     *
+     * @return The number of bytes handed out since the arena was last reset.
+     */
+    [[nodiscard]] auto GetBytesAllocated() const -> std::size_t;
+
+    /**
+     * Gets the number of expressions allocated from this arena that are still alive, including
+     * the reference counts of shared expressions.
+     *
+     * @return The number of allocations from this arena that are still alive.
+     */
+    [[nodiscard]] auto GetLiveCount() const -> std::size_t;
+
+    /**
+     * Gets whether an expression was allocated from this arena.
+     *
+     * @param expression The expression to check.
+     * @return Whether the expression was allocated from this arena.
+     */
+    [[nodiscard]] auto Owns(const Expression& expression) const -> bool;
+
+    /**
+     * Reclaims all of the memory handed out by this arena.
+     *
+     * The arena is only reset if none of the expressions allocated from it are alive, as they
+     * would otherwise be left dangling. The blocks are kept for reuse.
+     *
+     * @return Whether the arena was reset.
+     */
+    auto Reset() -> bool;
+
+    /**
+     * Simplifies an expression, allocating all intermediate expressions from this arena.
+     *
+     * The result is detached from the arena, and the arena is reset afterwards, so that calling
+     * this repeatedly reuses the same blocks. No expression allocated from this arena may be alive
+     * when it is called.
+     *
+     * @param expression The expression to simplify.
+     * @return The simplified expression.
+     * @throws std::logic_error If an expression allocated from this arena is alive when it is called.
+     * @throws std::runtime_error If an expression allocated while simplifying is still alive
+     * afterwards, in which case the arena is not reset.
+     */
+    [[nodiscard]] auto Simplify(const Expression& expression) -> std::unique_ptr<Expression>;
+
+    /**
+     * Shares ownership of an expression.
+     *
+     * If the expression was allocated from the arena active on the calling thread, the reference
+     * count of the shared pointer is allocated from the same arena, so that building expressions
+     * in an arena does not touch the heap. Otherwise, it is allocated from the heap.
+     *
+     * @tparam T The type of the expression.
+     * @param expression The expression to share.
+     * @return The shared expression.
+     */
+    template <typename T>
+    static auto Share(std::unique_ptr<T> expression) -> std::shared_ptr<T>
+    {
+        ExpressionArena* arena = expression ? GetActiveArenaOf(*expression) : nullptr;
+
+        if (arena == nullptr) {
+            return expression;
+        }
+
+        return { expression.release(), std::default_delete<T> {}, Allocator<T> { arena } };
+    }
+
+    /**
+     * Gets the arena that is active on the current thread.
+     *
+     * @return The active arena, or `nullptr` if no arena is active.
+     */
+    static auto GetCurrent() -> ExpressionArena*;
+
+    /// @cond
+    static auto AllocateExpression(std::size_t size) -> void*;
+    static auto ClaimExpression(const void* ptr) -> bool;
+    static auto DeallocateExpression(void* ptr, bool arenaAllocated) -> void;
+    static auto DeallocateUnconstructed(void* ptr) -> void;
+    /// @endcond
+
+    auto operator=(const ExpressionArena& other) -> ExpressionArena& = delete;
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        std::size_t size;
+    };
+
+    // Allocates the reference counts of shared expressions from an arena. Like the expressions,
+    // they count as live until freed, which may happen on any thread.
+    template <typename T>
+    struct Allocator {
+        using value_type = T;
+
+        explicit Allocator(ExpressionArena* arena)
+            : arena(arena)
+        {
+        }
+
+        template <typename U>
+        Allocator(const Allocator<U>& other)
+            : arena(other.arena)
+        {
+        }
+
+        auto allocate(std::size_t n) -> T*
+        {
+            ++arena->liveCount;
+            return static_cast<T*>(arena->Allocate(n * sizeof(T)));
+        }
+
+        auto deallocate(T*, std::size_t) -> void
+        {
+            --arena->liveCount;
+        }
+
+        template <typename U>
+        auto operator==(const Allocator<U>& other) const -> bool
+        {
+            return arena == other.arena;
+        }
+
+        ExpressionArena* arena;
+    };
+
+    // Gets the arena an expression was allocated from, if it is active on the calling thread.
+    static auto GetActiveArenaOf(const Expression& expression) -> ExpressionArena*;
+
+    auto Allocate(std::size_t size) -> void*;
+    [[nodiscard]] auto OwnsAddress(const void* ptr) const -> bool;
+
+    std::vector<Block> blocks;
+    std::size_t blockSize;
+    std::size_t currentBlock = 0;
+    std::size_t offset = 0;
+    std::size_t bytesAllocated = 0;
+    std::atomic<std::size_t> liveCount = 0;
+};
+
+} // Oasis
+
+#endif // OASIS_EXPRESSIONARENA_HPP
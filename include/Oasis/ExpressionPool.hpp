@@ -0,0 +1,165 @@
+#ifndef OASIS_EXPRESSIONPOOL_HPP
+#define OASIS_EXPRESSIONPOOL_HPP
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Expression.hpp"
+#include "Fraction.hpp"
+#include "SymbolTable.hpp"
+
+namespace Oasis {
+
+/**
+ * A compact store of expression nodes.
+ *
+ * Instead of allocating each node as a polymorphic object, an ExpressionPool stores the type, the
+ * operands, and the payload of every node in parallel arrays, and refers to nodes by 32-bit
+ * indices. A node is always added after its operands, so its operands have smaller indices.
+ * Passes over an expression, such as hashing, evaluation, and differentiation, are therefore
+ * linear scans over the arrays rather than walks over pointers.
+ *
+ * Unary nodes store their operand as their most significant operand. N-ary expressions are stored
+ * as chains of binary nodes. Nodes are immutable and may be shared by any number of parents.
+ * Rational numbers keep their exact values, which are stored apart from the other payloads since
+ * few nodes have one.
+ *
+ * Expressions are converted to and from the `Expression` hierarchy with `Import` and `Export`. A
+ * pool is not safe to modify from multiple threads.
+ */
+class ExpressionPool {
+public:
+    using Index = std::uint32_t;
+
+    /**
+     * The index of a missing operand.
+     */
+    static constexpr Index NoIndex = std::numeric_limits<Index>::max();
+
+    /**
+     * Removes all nodes from the pool.
+     */
+    auto Clear() -> void;
+
+    /**
+     * Differentiates an expression with respect to a variable.
+     *
+     * The derivative is added to the pool. Multiplications by zero and one, and additions of zero,
+     * are folded away, but the result is not otherwise simplified.
+     *
+     * @param index The expression to differentiate.
+     * @param variable The symbol of the variable to differentiate with respect to.
+     * @return The derivative.
+     */
+    auto Differentiate(Index index, SymbolTable::Id variable) -> Index;
+
+    /**
+     * Evaluates an expression numerically.
+     *
+     * @param index The expression to evaluate.
+     * @param bindings The values of the variables in the expression.
+     * @return The value of the expression, or NaN if it contains an unbound variable or a node with
+     * no real value, such as an imaginary unit or a derivative.
+     */
+    [[nodiscard]] auto Evaluate(Index index, const std::unordered_map<SymbolTable::Id, double>& bindings) const -> double;
+
+    /**
+     * Converts a node back into an expression.
+     *
+     * Nodes shared by several parents in the pool are shared in the expression too.
+     *
+     * @param index The node to convert.
+     * @return The equivalent expression.
+     */
+    [[nodiscard]] auto Export(Index index) const -> std::unique_ptr<Expression>;
+
+    /**
+     * Gets the hash of a node, which is the same as the hash of the equivalent expression.
+     *
+     * @param index The node.
+     * @return The hash of the node.
+     */
+    [[nodiscard]] auto Hash(Index index) const -> std::size_t;
+
+    /**
+     * Adds an expression to the pool.
+     *
+     * @param expression The expression to add.
+     * @return The index of the root of the expression.
+     */
+    auto Import(const Expression& expression) -> Index;
+
+    /**
+     * Adds a node without a payload, such as an operation or an imaginary unit, to the pool.
+     *
+     * @param type The type of the node.
+     * @param mostSigOp The most significant operand, or the operand of a unary node.
+     * @param leastSigOp The least significant operand, or `NoIndex` for a unary or leaf node.
+     * @return The index of the node.
+     */
+    auto MakeNode(ExpressionType type, Index mostSigOp = NoIndex, Index leastSigOp = NoIndex) -> Index;
+
+    /**
+     * Adds a rational number to the pool.
+     *
+     * The rational evaluates to the nearest double, but exports and hashes exactly.
+     *
+     * @param value The value of the rational number.
+     * @return The index of the node.
+     */
+    auto MakeRational(const Fraction& value) -> Index;
+
+    /**
+     * Adds a real number to the pool.
+     *
+     * @param value The value of the real number.
+     * @return The index of the node.
+     */
+    auto MakeReal(double value) -> Index;
+
+    /**
+     * Adds a variable to the pool.
+     *
+     * @param symbol The symbol of the variable.
+     * @return The index of the node.
+     */
+    auto MakeVariable(SymbolTable::Id symbol) -> Index;
+
+    /**
+     * Reserves space for a number of nodes.
+     *
+     * @param capacity The number of nodes to reserve space for.
+     */
+    auto Reserve(std::size_t capacity) -> void;
+
+    [[nodiscard]] auto GetLeastSigOp(Index index) const -> Index;
+    [[nodiscard]] auto GetMostSigOp(Index index) const -> Index;
+    [[nodiscard]] auto GetRational(Index index) const -> const Fraction&;
+    [[nodiscard]] auto GetSize() const -> std::size_t;
+    [[nodiscard]] auto GetSymbol(Index index) const -> SymbolTable::Id;
+    [[nodiscard]] auto GetType(Index index) const -> ExpressionType;
+    [[nodiscard]] auto GetValue(Index index) const -> double;
+
+private:
+    auto Append(ExpressionType type, Index mostSigOp, Index leastSigOp, double value, SymbolTable::Id symbol) -> Index;
+    auto ComputeHash(Index index) const -> std::size_t;
+    [[nodiscard]] auto IsReal(Index index, double value) const -> bool;
+
+    // Marks the nodes reachable from a root. Only nodes up to the root can be reachable.
+    [[nodiscard]] auto Reachable(Index root) const -> std::vector<bool>;
+
+    std::vector<ExpressionType> types;
+    std::vector<Index> mostSigOps;
+    std::vector<Index> leastSigOps;
+    std::vector<double> values;
+    std::vector<SymbolTable::Id> symbols;
+    std::vector<std::size_t> hashes;
+    std::unordered_map<Index, Fraction> rationals;
+};
+
+} // Oasis
+
+#endif // OASIS_EXPRESSIONPOOL_HPP
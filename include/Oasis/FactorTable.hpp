@@ -0,0 +1,93 @@
+#ifndef OASIS_FACTORTABLE_HPP
+#define OASIS_FACTORTABLE_HPP
+
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Oasis {
+
+/**
+ * A bounded cache of the prime factorizations of 64-bit integers.
+ *
+ * Integers are factored by trial division by small primes, then by Pollard's rho algorithm with
+ * Brent's cycle detection, with each factor tested for primality by a deterministic Miller-Rabin
+ * test. Since the rational root test factors the same leading and constant coefficients again and
+ * again, factorizations are kept until the table is full, at which point it is cleared.
+ *
+ * `FindZeros` factors coefficients through the global table. The table is safe to use from multiple
+ * threads.
+ */
+class FactorTable {
+public:
+    /**
+     * The distinct prime factors of an integer, in ascending order, each with its exponent.
+     */
+    using PrimeFactors = std::vector<std::pair<std::uint64_t, unsigned>>;
+
+    explicit FactorTable(std::size_t capacity = 4096);
+    FactorTable(const FactorTable& other) = delete;
+
+    /**
+     * Gets the table used by `FindZeros`.
+     *
+     * @return The global factor table.
+     */
+    static auto Global() -> FactorTable&;
+
+    /**
+     * Checks whether an integer is prime.
+     *
+     * @param n The integer.
+     * @return Whether the integer is prime.
+     */
+    static auto IsPrime(std::uint64_t n) -> bool;
+
+    /**
+     * Removes every factorization from the table.
+     */
+    auto Clear() -> void;
+
+    /**
+     * Factors an integer into primes.
+     *
+     * @param n The integer.
+     * @return The prime factors of the integer, which are none for 0 and 1.
+     */
+    auto Factorize(std::uint64_t n) -> PrimeFactors;
+
+    /**
+     * Gets the maximum number of factorizations in the table.
+     *
+     * @return The maximum number of factorizations in the table.
+     */
+    [[nodiscard]] auto GetCapacity() const -> std::size_t;
+
+    /**
+     * Gets the positive divisors of an integer from its prime factors.
+     *
+     * @param n The integer.
+     * @return The divisors of the integer, in ascending order, or none for 0.
+     */
+    auto GetDivisors(std::uint64_t n) -> std::vector<std::uint64_t>;
+
+    /**
+     * Gets the number of factorizations in the table.
+     *
+     * @return The number of factorizations in the table.
+     */
+    [[nodiscard]] auto GetSize() const -> std::size_t;
+
+    auto operator=(const FactorTable& other) -> FactorTable& = delete;
+
+private:
+    std::size_t capacity;
+    std::unordered_map<std::uint64_t, PrimeFactors> factorizations;
+    mutable std::shared_mutex mutex;
+};
+
+} // Oasis
+
+#endif // OASIS_FACTORTABLE_HPP
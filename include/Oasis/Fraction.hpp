@@ -0,0 +1,129 @@
+#ifndef OASIS_FRACTION_HPP
+#define OASIS_FRACTION_HPP
+
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "BigInt.hpp"
+
+namespace Oasis {
+
+/**
+ * An exact rational number.
+ *
+ * A Fraction is kept in lowest terms with a positive denominator. Its numerator and denominator are
+ * stored inline as 64-bit integers, and arithmetic on them checks for overflow instead of
+ * allocating, so that fractions of small integers are nearly as cheap as doubles. Only a result
+ * that overflows spills into a pair of `BigInt`s, which copies of the fraction share. A fraction
+ * that fits is always stored inline, so that equal fractions have equal representations.
+ */
+class Fraction {
+public:
+    /**
+     * Creates zero.
+     */
+    Fraction() = default;
+
+    /**
+     * Creates a fraction from an integer numerator and denominator.
+     *
+     * @param numerator The numerator.
+     * @param denominator The denominator.
+     * @throws std::domain_error If the denominator is zero.
+     */
+    Fraction(std::int64_t numerator, std::int64_t denominator = 1);
+
+    /**
+     * Creates a fraction from an arbitrary-precision numerator and denominator.
+     *
+     * @param numerator The numerator.
+     * @param denominator The denominator.
+     * @throws std::domain_error If the denominator is zero.
+     */
+    Fraction(const BigInt& numerator, const BigInt& denominator);
+
+    /**
+     * Fractions are not converted implicitly from doubles, which would truncate them through the
+     * integer constructor. Use `FromDouble` instead.
+     */
+    template <std::floating_point T>
+    Fraction(T value) = delete;
+
+    /**
+     * Converts a double to the fraction with exactly its value.
+     *
+     * @param value The finite double.
+     * @return The fraction.
+     * @throws std::domain_error If the double is infinite or NaN.
+     */
+    static auto FromDouble(double value) -> Fraction;
+
+    [[nodiscard]] auto GetDenominator() const -> BigInt;
+    [[nodiscard]] auto GetNumerator() const -> BigInt;
+
+    [[nodiscard]] auto Hash() const -> std::size_t;
+
+    /**
+     * Checks whether this fraction is stored inline, without spilling into `BigInt`s.
+     */
+    [[nodiscard]] auto IsInline() const -> bool;
+
+    [[nodiscard]] auto IsInteger() const -> bool;
+    [[nodiscard]] auto IsNegative() const -> bool;
+    [[nodiscard]] auto IsZero() const -> bool;
+
+    /**
+     * Raises this fraction to an integer power by repeated squaring.
+     *
+     * @param exponent The power.
+     * @return This fraction raised to the power.
+     * @throws std::domain_error If this fraction is zero and the power is negative.
+     */
+    [[nodiscard]] auto Pow(std::int64_t exponent) const -> Fraction;
+
+    /**
+     * Converts this fraction to the nearest double, or to infinity if it is out of range.
+     */
+    [[nodiscard]] auto ToDouble() const -> double;
+
+    /**
+     * Formats this fraction as `n` if it is an integer, or `n/d` otherwise.
+     */
+    [[nodiscard]] auto ToString() const -> std::string;
+
+    auto operator+(const Fraction& other) const -> Fraction;
+    auto operator-(const Fraction& other) const -> Fraction;
+    auto operator-() const -> Fraction;
+    auto operator*(const Fraction& other) const -> Fraction;
+
+    /**
+     * Divides this fraction by another.
+     *
+     * @throws std::domain_error If the other fraction is zero.
+     */
+    auto operator/(const Fraction& other) const -> Fraction;
+
+    auto operator==(const Fraction& other) const -> bool;
+    auto operator<=>(const Fraction& other) const -> std::strong_ordering;
+
+private:
+    struct Spilled {
+        BigInt numerator;
+        BigInt denominator;
+    };
+
+    // Reduces a fraction to lowest terms, storing it inline if it fits.
+    static auto Normalize(BigInt numerator, BigInt denominator) -> Fraction;
+
+    // The inline numerator is never the most negative 64-bit integer, so that it can be negated.
+    std::int64_t numerator = 0;
+    std::int64_t denominator = 1;
+    std::shared_ptr<const Spilled> spilled;
+};
+
+} // Oasis
+
+#endif // OASIS_FRACTION_HPP
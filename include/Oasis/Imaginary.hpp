@@ -22,10 +22,11 @@ public:
     EXPRESSION_TYPE(Imaginary)
     EXPRESSION_CATEGORY(UnExp)
 
-    [[nodiscard]] auto ToString() const -> std::string final;
-
     static auto Specialize(const Expression& other) -> std::unique_ptr<Imaginary>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Imaginary>;
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
 };
 }
 
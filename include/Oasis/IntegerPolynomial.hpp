@@ -0,0 +1,89 @@
+#ifndef OASIS_INTEGERPOLYNOMIAL_HPP
+#define OASIS_INTEGERPOLYNOMIAL_HPP
+
+#include <span>
+#include <vector>
+
+#include "BigInt.hpp"
+
+namespace Oasis {
+
+// The functions below work on dense univariate polynomials with integer coefficients, given from
+// the constant term to the term of the highest degree. Their results have no leading zero
+// coefficients, so that the zero polynomial has no coefficients at all.
+
+/**
+ * Differentiates a dense polynomial.
+ *
+ * @param coefficients The coefficients of the polynomial.
+ * @return The coefficients of its derivative.
+ */
+auto DifferentiateDense(std::span<const BigInt> coefficients) -> std::vector<BigInt>;
+
+/**
+ * Divides a dense polynomial by another that divides it exactly.
+ *
+ * @param dividend The coefficients of the dividend.
+ * @param divisor The coefficients of the divisor.
+ * @return The coefficients of the quotient.
+ * @throws std::domain_error If the divisor is zero or does not divide the dividend with an integer
+ * quotient.
+ */
+auto DivideDenseExact(std::span<const BigInt> dividend, std::span<const BigInt> divisor) -> std::vector<BigInt>;
+
+/**
+ * Evaluates a dense polynomial at a rational point by Horner's method, without rounding or
+ * overflowing.
+ *
+ * For a polynomial f of degree n, the value is scaled to q^n f(p/q), which is an integer with the
+ * same sign as f(p/q) for a positive q, and which is zero exactly when f(p/q) is.
+ *
+ * @param coefficients The coefficients of the polynomial.
+ * @param numerator The numerator p of the point.
+ * @param denominator The denominator q of the point, which must not be zero.
+ * @return The scaled value q^n f(p/q).
+ */
+auto EvaluateDense(std::span<const BigInt> coefficients, const BigInt& numerator, const BigInt& denominator) -> BigInt;
+
+/**
+ * Computes the greatest common divisor of two dense polynomials by a primitive remainder sequence.
+ *
+ * @param lhs The coefficients of the first polynomial.
+ * @param rhs The coefficients of the second polynomial.
+ * @return The coefficients of the greatest common divisor, with a positive leading coefficient, or
+ * none if both polynomials are zero.
+ */
+auto GcdDense(std::span<const BigInt> lhs, std::span<const BigInt> rhs) -> std::vector<BigInt>;
+
+/**
+ * Computes the content of a dense polynomial, the greatest common divisor of its coefficients.
+ *
+ * @param coefficients The coefficients of the polynomial.
+ * @return The nonnegative content, which is zero only for the zero polynomial.
+ */
+auto GetContent(std::span<const BigInt> coefficients) -> BigInt;
+
+/**
+ * Divides a dense polynomial by its content, and by -1 if its leading coefficient is negative.
+ *
+ * @param coefficients The coefficients of the polynomial.
+ * @return The coefficients of its primitive part.
+ */
+auto GetPrimitivePart(std::span<const BigInt> coefficients) -> std::vector<BigInt>;
+
+/**
+ * Decomposes the primitive part of a dense polynomial into square-free factors by Yun's algorithm.
+ *
+ * The polynomial is the product of each factor raised to one more than its index, up to its
+ * content. The factors have no common zeros and no repeated zeros, so each zero of the polynomial
+ * is a simple zero of exactly one factor, whose index gives its multiplicity.
+ *
+ * @param coefficients The coefficients of the polynomial.
+ * @return The coefficients of the factors, some of which may be 1, or none if the polynomial is
+ * constant.
+ */
+auto SquareFreeDecomposition(std::span<const BigInt> coefficients) -> std::vector<std::vector<BigInt>>;
+
+} // Oasis
+
+#endif // OASIS_INTEGERPOLYNOMIAL_HPP
@@ -38,10 +38,6 @@ public:
     {
         return this->GetType() == other.GetType();
     }
-    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression> override
-    {
-        return Generalize()->Differentiate(differentiationVariable);
-    }
     auto Substitute(const Expression&, const Expression&) -> std::unique_ptr<Expression> override
     {
         return this->Copy();
@@ -23,17 +23,18 @@ public:
     Log(const Log<Expression, Expression>& other) = default;
 
     Log(const Expression& base, const Expression& argument);
-
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> final;
-    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
-
-    [[nodiscard]] auto ToString() const -> std::string final;
+    Log(std::unique_ptr<Expression>&& base, std::unique_ptr<Expression>&& argument);
 
     static auto Specialize(const Expression& other) -> std::unique_ptr<Log>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Log>;
 
     EXPRESSION_TYPE(Log)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
 };
 /// @endcond
 
@@ -57,9 +58,9 @@ public:
     {
     }
 
-    [[nodiscard]] auto ToString() const -> std::string final
+    Log(std::unique_ptr<BaseT>&& base, std::unique_ptr<ArgumentT>&& argument)
+        : BinaryExpression<Log, BaseT, ArgumentT>(std::move(base), std::move(argument))
     {
-        return fmt::format("log({}, {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
     }
 
     IMPL_SPECIALIZE(Log, BaseT, ArgumentT);
@@ -68,6 +69,12 @@ public:
 
     EXPRESSION_TYPE(Log);
     EXPRESSION_CATEGORY(BinExp);
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final
+    {
+        return fmt::format("log({}, {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
+    }
 };
 
 } // Oasis
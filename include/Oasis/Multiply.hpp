@@ -21,17 +21,30 @@ class Multiply<Expression, Expression> : public BinaryExpression<Multiply> {
 public:
     using BinaryExpression::BinaryExpression;
 
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> final;
-    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
 
-    [[nodiscard]] auto ToString() const -> std::string final;
-    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression> final;
+    /**
+     * Combines like factors in a list of simplified factors, such as `x^2` and `x` into `x^3`.
+     *
+     * Real factors are multiplied into a single leading coefficient. The other factors follow in the
+     * canonical order of their bases, so the result does not depend on the order of the factors.
+     * Combining n factors takes O(n log n) time.
+     *
+     * @param factors The factors to combine.
+     * @return The combined factors.
+     */
+    static auto CombineLikeFactors(const std::vector<std::unique_ptr<Expression>>& factors) -> std::vector<std::unique_ptr<Expression>>;
 
     static auto Specialize(const Expression& other) -> std::unique_ptr<Multiply>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Multiply>;
 
     EXPRESSION_TYPE(Multiply)
     EXPRESSION_CATEGORY(Associative | Commutative | BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression> final;
 };
 /// @endcond
 
@@ -55,9 +68,9 @@ public:
     {
     }
 
-    [[nodiscard]] auto ToString() const -> std::string final
+    Multiply(std::unique_ptr<MultiplicandT>&& addend1, std::unique_ptr<MultiplierT>&& addend2)
+        : BinaryExpression<Multiply, MultiplicandT, MultiplierT>(std::move(addend1), std::move(addend2))
     {
-        return fmt::format("({} + {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
     }
 
     IMPL_SPECIALIZE(Multiply, MultiplicandT, MultiplierT)
@@ -66,6 +79,12 @@ public:
 
     EXPRESSION_TYPE(Multiply)
     EXPRESSION_CATEGORY(Associative | Commutative | BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final
+    {
+        return fmt::format("({} * {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
+    }
 };
 
 } // Oasis
@@ -0,0 +1,385 @@
+#ifndef OASIS_NARYEXPRESSION_HPP
+#define OASIS_NARYEXPRESSION_HPP
+
+#include <cassert>
+#include <vector>
+
+#include "taskflow/taskflow.hpp"
+
+#include "BinaryExpression.hpp"
+
+namespace Oasis {
+
+/**
+ * An n-ary expression.
+ *
+ * The NaryExpression class is a base class for expressions that apply an associative and
+ * commutative binary operation to any number of operands, such as a sum of many terms. Instead of
+ * nesting binary expressions, the operands are stored contiguously, so that they can be visited and
+ * rebuilt without flattening and rebuilding a tree.
+ *
+ * An n-ary expression has its own type, since its operands are laid out differently from those of
+ * the equivalent tree of binary expressions, so it does not compare equal to that tree. Instead,
+ * `Generalize` converts it to the tree, and `Specialize` converts any expression of the binary
+ * expression's type into an n-ary expression, sharing the operands instead of copying them. Nested
+ * operands of the binary expression's type are flattened into the n-ary expression's operands,
+ * both when specializing and when comparing n-ary expressions, while a binary expression treats
+ * an n-ary operand as a single term.
+ *
+ * @note This class is not intended to be used directly by end users.
+ *
+ * @tparam DerivedT The derived class.
+ * @tparam BinaryT The equivalent binary expression, e.g. Add or Multiply.
+ * @tparam TypeV The type of the derived class.
+ */
+template <typename DerivedT, template <IExpression, IExpression> class BinaryT, ExpressionType TypeV>
+    requires IAssociativeAndCommutative<BinaryT>
+class NaryExpression : public Expression {
+
+    using BinaryGeneralized = BinaryT<Expression, Expression>;
+
+public:
+    /**
+     * Copies an n-ary expression.
+     *
+     * Expressions are immutable, so the copy shares its operands with the original.
+     *
+     * @param other The n-ary expression to copy.
+     */
+    NaryExpression(const NaryExpression& other)
+        : Expression(other)
+        , operands(other.operands)
+    {
+    }
+
+    /**
+     * Creates an n-ary expression from shared operands.
+     *
+     * @param operands The operands of the expression. There must be at least two.
+     */
+    explicit NaryExpression(std::vector<std::shared_ptr<Expression>> operands)
+        : operands(std::move(operands))
+    {
+        assert(this->operands.size() >= 2);
+    }
+
+    /**
+     * Creates an n-ary expression from copies of the given operands.
+     *
+     * @param operands The operands of the expression. There must be at least two.
+     */
+    explicit NaryExpression(const std::vector<std::unique_ptr<Expression>>& operands)
+    {
+        assert(operands.size() >= 2);
+        this->operands.reserve(operands.size());
+
+        for (const auto& operand : operands) {
+            this->operands.push_back(ExpressionArena::Share(operand->Copy()));
+        }
+    }
+
+    template <IExpression... OpsT>
+        requires(sizeof...(OpsT) >= 2)
+    explicit NaryExpression(const OpsT&... ops)
+        : operands { ExpressionArena::Share(ops.Copy())... }
+    {
+    }
+
+    ~NaryExpression() override
+    {
+        for (auto& operand : operands) {
+            ReleaseOperand(std::move(operand));
+        }
+    }
+
+    [[nodiscard]] auto Copy() const -> std::unique_ptr<Expression> final
+    {
+        return std::make_unique<DerivedT>(*static_cast<const DerivedT*>(this));
+    }
+
+    auto Copy(tf::Subflow&) const -> std::unique_ptr<Expression> final
+    {
+        return Copy();
+    }
+
+    [[nodiscard]] auto Equals(const Expression& other) const -> bool final
+    {
+        if (this == &other) {
+            return true;
+        }
+
+        if (this->GetType() != other.GetType() || this->Hash() != other.Hash()) {
+            return false;
+        }
+
+        std::vector<const Expression*> thisTerms, otherTerms;
+        CollectTerms(*this, thisTerms);
+        CollectTerms(other, otherTerms);
+
+        return TermsEqual(thisTerms, otherTerms, true);
+    }
+
+    /**
+     * Flattens this expression.
+     *
+     * Operands that are themselves of this expression's type are flattened as well, so that the
+     * output is the same as flattening the equivalent binary expression.
+     *
+     * @param out The vector to copy the operands into.
+     */
+    auto Flatten(std::vector<std::unique_ptr<Expression>>& out) const -> void
+    {
+        std::vector<const Expression*> terms;
+        CollectTerms(*this, terms);
+
+        for (const Expression* term : terms) {
+            out.push_back(term->Copy());
+        }
+    }
+
+    /**
+     * Converts this expression to the equivalent, balanced tree of binary expressions.
+     *
+     * @return The generalized expression.
+     */
+    [[nodiscard]] auto Generalize() const -> std::unique_ptr<Expression> final
+    {
+        std::vector<std::unique_ptr<Expression>> ops;
+        ops.reserve(operands.size());
+
+        for (const auto& operand : operands) {
+            ops.push_back(operand->Copy());
+        }
+
+        return BuildFromVector<BinaryT>(ops);
+    }
+
+    auto Generalize(tf::Subflow&) const -> std::unique_ptr<Expression> final
+    {
+        return Generalize();
+    }
+
+    [[nodiscard]] auto GetCategory() const -> uint32_t final
+    {
+        return GetStaticCategory();
+    }
+
+    constexpr static auto GetStaticCategory() -> uint32_t
+    {
+        return BinaryGeneralized::GetStaticCategory();
+    }
+
+    [[nodiscard]] auto GetType() const -> ExpressionType final
+    {
+        return GetStaticType();
+    }
+
+    static auto GetStaticType() -> ExpressionType
+    {
+        return TypeV;
+    }
+
+    [[nodiscard]] auto GetOperandCount() const -> std::size_t final
+    {
+        return operands.size();
+    }
+
+    [[nodiscard]] auto GetOperandAt(std::size_t index) const -> const Expression& final
+    {
+        assert(index < operands.size());
+        return *operands[index];
+    }
+
+    [[nodiscard]] auto GetSharedOperandAt(std::size_t index) const -> std::shared_ptr<Expression> final
+    {
+        assert(index < operands.size());
+        return operands[index];
+    }
+
+    /**
+     * Gets the operands of this expression.
+     * @return The operands of this expression.
+     */
+    [[nodiscard]] auto GetOperands() const -> const std::vector<std::shared_ptr<Expression>>&
+    {
+        return operands;
+    }
+
+    [[nodiscard]] auto WithOperands(std::span<const std::shared_ptr<Expression>> operands) const -> std::unique_ptr<Expression> final
+    {
+        return std::make_unique<DerivedT>(std::vector<std::shared_ptr<Expression>> { operands.begin(), operands.end() });
+    }
+
+    /**
+     * Converts an expression of the equivalent binary expression's type, or of this expression's
+     * type, into an n-ary expression.
+     *
+     * Nested operands of the binary expression's type are flattened into the n-ary expression. The
+     * operands are shared with the original expression rather than copied.
+     *
+     * @param other The expression to specialize.
+     * @return The n-ary expression, or `nullptr` if the expression is not of the right type.
+     */
+    static auto Specialize(const Expression& other) -> std::unique_ptr<DerivedT>
+    {
+        if (other.GetType() != GetStaticType() && other.GetType() != BinaryGeneralized::GetStaticType()) {
+            return nullptr;
+        }
+
+        std::vector<std::shared_ptr<Expression>> terms;
+        CollectSharedTerms(other, terms);
+
+        return std::make_unique<DerivedT>(std::move(terms));
+    }
+
+    static auto Specialize(const Expression& other, tf::Subflow&) -> std::unique_ptr<DerivedT>
+    {
+        return Specialize(other);
+    }
+
+    [[nodiscard]] auto StructurallyEquivalent(const Expression& other) const -> bool final
+    {
+        return Generalize()->StructurallyEquivalent(other);
+    }
+
+    auto StructurallyEquivalent(const Expression& other, tf::Subflow& subflow) const -> bool final
+    {
+        return Generalize()->StructurallyEquivalent(other, subflow);
+    }
+
+    auto Substitute(const Expression& var, const Expression& val) -> std::unique_ptr<Expression> final
+    {
+        return SubstituteAll(*this, var, val);
+    }
+
+    auto operator=(const NaryExpression& other) -> NaryExpression& = default;
+
+protected:
+    [[nodiscard]] auto ComputeHash() const -> std::size_t override
+    {
+        // The seed plus the mixed hashes of the terms that Equals compares, in any order.
+        std::vector<const Expression*> terms;
+        CollectTerms(*this, terms);
+
+        auto hash = Expression::ComputeHash();
+
+        for (const Expression* term : terms) {
+            hash += MixHash(term->Hash());
+        }
+
+        return hash;
+    }
+
+    /**
+     * Simplifies each operand of this expression.
+     * @return The simplified operands.
+     */
+    [[nodiscard]] auto SimplifyOperands() const -> std::vector<std::unique_ptr<Expression>>
+    {
+        std::vector<std::unique_ptr<Expression>> simplified;
+        simplified.reserve(operands.size());
+
+        for (const auto& operand : operands) {
+            simplified.push_back(operand->Simplify());
+        }
+
+        return simplified;
+    }
+
+    /**
+     * Simplifies each operand of this expression in parallel.
+     * @param subflow The invoking subflow.
+     * @return The simplified operands.
+     */
+    auto SimplifyOperands(tf::Subflow& subflow) const -> std::vector<std::unique_ptr<Expression>>
+    {
+        std::vector<std::unique_ptr<Expression>> simplified(operands.size());
+
+        for (std::size_t i = 0; i < operands.size(); ++i) {
+            subflow.emplace([this, &simplified, i](tf::Subflow& sbf) {
+                simplified[i] = operands[i]->Simplify(sbf);
+            });
+        }
+
+        subflow.join();
+
+        return simplified;
+    }
+
+    /**
+     * Splices the operands of simplified operands that are of this expression's type, or of the
+     * binary expression's type, into the list of operands, so that the simplified expression stays
+     * flat.
+     *
+     * @param simplified The simplified operands.
+     * @return The flattened operands.
+     */
+    static auto SpliceOperands(std::vector<std::unique_ptr<Expression>>& simplified) -> std::vector<std::unique_ptr<Expression>>
+    {
+        std::vector<std::unique_ptr<Expression>> terms;
+        terms.reserve(simplified.size());
+
+        for (auto& operand : simplified) {
+            if (operand->GetType() != GetStaticType() && operand->GetType() != BinaryGeneralized::GetStaticType()) {
+                terms.push_back(std::move(operand));
+                continue;
+            }
+
+            std::vector<const Expression*> nested;
+            CollectTerms(*operand, nested);
+
+            for (const Expression* term : nested) {
+                terms.push_back(term->Copy());
+            }
+        }
+
+        return terms;
+    }
+
+    std::vector<std::shared_ptr<Expression>> operands;
+
+private:
+    // Nested terms are collected with an explicit stack of (node, next operand) frames, since binary
+    // chains can be arbitrarily deep. Terms are emitted in the same order as a recursive traversal.
+    // Nested n-ary expressions are flattened, as are binary expressions, but only n-ary expressions
+    // within an n-ary expression, since a binary expression's own terms do not include them.
+    template <typename TermT, typename GetT>
+    static auto CollectWith(const Expression& expression, std::vector<TermT>& out, GetT get) -> void
+    {
+        std::vector<std::pair<const Expression*, std::size_t>> stack { { &expression, 0 } };
+
+        while (!stack.empty()) {
+            auto& [node, next] = stack.back();
+
+            if (next == node->GetOperandCount()) {
+                stack.pop_back();
+                continue;
+            }
+
+            const std::size_t index = next++;
+            const Expression& operand = node->GetOperandAt(index);
+
+            const bool nested = operand.GetType() == BinaryGeneralized::GetStaticType() || (operand.GetType() == GetStaticType() && node->GetType() == GetStaticType());
+
+            if (nested) {
+                stack.emplace_back(&operand, 0);
+            } else {
+                out.push_back(get(*node, index));
+            }
+        }
+    }
+
+    static auto CollectTerms(const Expression& expression, std::vector<const Expression*>& out) -> void
+    {
+        CollectWith(expression, out, [](const Expression& node, std::size_t index) { return &node.GetOperandAt(index); });
+    }
+
+    static auto CollectSharedTerms(const Expression& expression, std::vector<std::shared_ptr<Expression>>& out) -> void
+    {
+        CollectWith(expression, out, [](const Expression& node, std::size_t index) { return node.GetSharedOperandAt(index); });
+    }
+};
+
+} // Oasis
+
+#endif // OASIS_NARYEXPRESSION_HPP
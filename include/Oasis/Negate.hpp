@@ -26,7 +26,23 @@ public:
     {
     }
 
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> override
+    explicit Negate(std::unique_ptr<OperandT>&& operand)
+        : UnaryExpression<Negate, OperandT>(std::move(operand))
+    {
+    }
+
+    IMPL_SPECIALIZE_UNARYEXPR(Negate, OperandT)
+
+    EXPRESSION_TYPE(Negate)
+    EXPRESSION_CATEGORY(UnExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string override
+    {
+        return fmt::format("-({})", this->GetOperand().ToString());
+    }
+
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> override
     {
         return Multiply {
             Real { -1.0 },
@@ -35,7 +51,7 @@ public:
             .Simplify();
     }
 
-    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> override
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> override
     {
         return Multiply {
             Real { -1.0 },
@@ -43,16 +59,6 @@ public:
         }
             .Simplify(subflow);
     }
-
-    [[nodiscard]] auto ToString() const -> std::string override
-    {
-        return fmt::format("-({})", this->GetOperand().ToString());
-    }
-
-    IMPL_SPECIALIZE_UNARYEXPR(Negate, OperandT)
-
-    EXPRESSION_TYPE(Negate)
-    EXPRESSION_CATEGORY(UnExp)
 };
 
 } // Oasis
@@ -0,0 +1,232 @@
+#ifndef OASIS_POLYNOMIAL_HPP
+#define OASIS_POLYNOMIAL_HPP
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Expression.hpp"
+#include "Fraction.hpp"
+#include "SymbolTable.hpp"
+
+namespace Oasis {
+
+/**
+ * A sparse polynomial in any number of variables with rational coefficients.
+ *
+ * A Polynomial stores only its nonzero terms, with exact coefficients. The exponents of a term's variables, its monomial,
+ * are packed into a single 64-bit word, so that monomials are compared, multiplied, and hashed as
+ * integers. Each variable gets an equal share of the word, up to 33 bits, with the first variable
+ * in the most significant bits, so comparing two monomials as integers orders them
+ * lexicographically by their exponents. The terms are kept sorted in decreasing order of their monomials.
+ *
+ * The variables of a polynomial are sorted by name. Arithmetic on polynomials with different
+ * variables works on the union of their variables.
+ *
+ * Polynomials are converted to and from expressions with `FromExpression` and `ToExpression`, so
+ * that algorithms on polynomials can work on flat arrays of terms instead of trees.
+ */
+class Polynomial {
+public:
+    using Monomial = std::uint64_t;
+
+    /**
+     * A term of a polynomial.
+     */
+    struct Term {
+        Monomial monomial;
+        Fraction coefficient;
+
+        auto operator==(const Term& other) const -> bool = default;
+    };
+
+    /**
+     * The most variables a polynomial can have.
+     */
+    static constexpr std::size_t MaxVariables = 32;
+
+    /**
+     * Creates the zero polynomial.
+     */
+    Polynomial() = default;
+
+    /**
+     * Creates the zero polynomial in the given variables.
+     *
+     * @param variables The symbols of the variables. Duplicates are ignored.
+     * @throws std::invalid_argument If there are more than `MaxVariables` variables.
+     */
+    explicit Polynomial(std::vector<SymbolTable::Id> variables);
+
+    /**
+     * Adds a term to this polynomial.
+     *
+     * @param exponents The exponent of each variable, in the order returned by `GetVariables`.
+     * @param coefficient The coefficient of the term.
+     * @throws std::overflow_error If an exponent does not fit in the monomial.
+     */
+    auto AddTerm(std::span<const std::uint32_t> exponents, const Fraction& coefficient) -> void;
+
+    /**
+     * Adds a term with the exact value of a double as its coefficient.
+     *
+     * @throws std::domain_error If the coefficient is infinite or NaN.
+     * @see AddTerm
+     */
+    auto AddTerm(std::span<const std::uint32_t> exponents, double coefficient) -> void;
+
+    /**
+     * Divides a polynomial by another, with remainder.
+     *
+     * The leading term of what remains of the dividend, in the order of the terms, is repeatedly
+     * cancelled by a multiple of the divisor if the leading term of the divisor divides it, and is
+     * otherwise moved to the remainder, in exact arithmetic. Polynomials in one variable with
+     * integer coefficients whose quotient and divisor are long enough for `DivRemDense` to use
+     * Newton's method are divided by `DivRemNewton` instead.
+     *
+     * @param dividend The dividend.
+     * @param divisor The divisor.
+     * @return The quotient and the remainder, no term of which is divisible by the leading term of
+     * the divisor.
+     * @throws std::domain_error If the divisor is zero.
+     * @throws std::overflow_error If an exponent of the quotient does not fit in a monomial.
+     */
+    static auto DivRem(const Polynomial& dividend, const Polynomial& divisor) -> std::pair<Polynomial, Polynomial>;
+
+    /**
+     * Creates a constant polynomial.
+     *
+     * @param value The constant.
+     * @return The polynomial.
+     */
+    static auto FromConstant(const Fraction& value) -> Polynomial;
+
+    /**
+     * Creates a constant polynomial with the exact value of a double.
+     *
+     * @throws std::domain_error If the value is infinite or NaN.
+     * @see FromConstant
+     */
+    static auto FromConstant(double value) -> Polynomial;
+
+    /**
+     * Converts an expression into a polynomial.
+     *
+     * The expression may contain real and rational numbers, variables, sums, differences, products,
+     * negations, quotients by numbers, and powers with nonnegative integer exponents. Numbers are
+     * converted exactly, and real numbers are taken at the exact value of their doubles.
+     *
+     * @param expression The expression to convert.
+     * @return The equivalent polynomial, or `std::nullopt` if the expression is not a polynomial or
+     * contains an infinite or NaN real number.
+     */
+    static auto FromExpression(const Expression& expression) -> std::optional<Polynomial>;
+
+    /**
+     * Creates a polynomial consisting of a single variable.
+     *
+     * @param variable The symbol of the variable.
+     * @return The polynomial.
+     */
+    static auto FromVariable(SymbolTable::Id variable) -> Polynomial;
+
+    /**
+     * Gets the coefficients of a polynomial in at most one variable, rounded to the nearest doubles.
+     *
+     * @return The coefficient of each power of the variable, from the constant term to the term of
+     * the highest degree. The zero polynomial has no coefficients.
+     * @throws std::logic_error If the polynomial has more than one variable.
+     */
+    [[nodiscard]] auto GetDenseCoefficients() const -> std::vector<double>;
+
+    /**
+     * Gets the exact coefficients of a polynomial in at most one variable.
+     *
+     * @see GetDenseCoefficients
+     */
+    [[nodiscard]] auto GetDenseFractions() const -> std::vector<Fraction>;
+
+    /**
+     * Gets the total degree of this polynomial.
+     *
+     * @return The largest sum of the exponents of a term, or -1 for the zero polynomial.
+     */
+    [[nodiscard]] auto GetDegree() const -> long;
+
+    /**
+     * Unpacks the exponents of a monomial of this polynomial.
+     *
+     * @param monomial The monomial.
+     * @return The exponent of each variable, in the order returned by `GetVariables`.
+     */
+    [[nodiscard]] auto GetExponents(Monomial monomial) const -> std::vector<std::uint32_t>;
+
+    /**
+     * Gets the terms of this polynomial, in decreasing order of their monomials.
+     * @return The terms of this polynomial.
+     */
+    [[nodiscard]] auto GetTerms() const -> const std::vector<Term>&;
+
+    /**
+     * Gets the variables of this polynomial, sorted by name.
+     * @return The symbols of the variables of this polynomial.
+     */
+    [[nodiscard]] auto GetVariables() const -> const std::vector<SymbolTable::Id>&;
+
+    [[nodiscard]] auto IsZero() const -> bool;
+
+    /**
+     * Raises this polynomial to a power by repeated squaring.
+     *
+     * @param exponent The power.
+     * @return This polynomial raised to the power.
+     * @throws std::overflow_error If an exponent of the result does not fit in a monomial.
+     */
+    [[nodiscard]] auto Pow(std::uint32_t exponent) const -> Polynomial;
+
+    /**
+     * Converts this polynomial into an expression.
+     *
+     * @param rational Whether every coefficient becomes a Rational. Otherwise, a coefficient becomes
+     * a Real if a double represents it exactly, and a Rational if not.
+     * @return A sum of terms in decreasing order of their monomials.
+     */
+    [[nodiscard]] auto ToExpression(bool rational = false) const -> std::unique_ptr<Expression>;
+
+    auto operator+(const Polynomial& other) const -> Polynomial;
+    auto operator-(const Polynomial& other) const -> Polynomial;
+    auto operator-() const -> Polynomial;
+    auto operator*(const Polynomial& other) const -> Polynomial;
+    auto operator*(const Fraction& scalar) const -> Polynomial;
+
+    /**
+     * Multiplies this polynomial by the exact value of a double.
+     *
+     * @throws std::domain_error If the scalar is infinite or NaN.
+     */
+    auto operator*(double scalar) const -> Polynomial;
+    auto operator==(const Polynomial& other) const -> bool;
+
+private:
+    [[nodiscard]] auto GetFieldWidth() const -> unsigned;
+    [[nodiscard]] auto Pack(std::span<const std::uint32_t> exponents) const -> Monomial;
+
+    // Converts this polynomial to a superset of its variables.
+    [[nodiscard]] auto WithVariables(const std::vector<SymbolTable::Id>& newVariables) const -> Polynomial;
+
+    // Converts two polynomials to the union of their variables.
+    static auto Unify(const Polynomial& lhs, const Polynomial& rhs) -> std::pair<Polynomial, Polynomial>;
+
+    // Sorts terms into decreasing order and combines the coefficients of equal monomials.
+    auto Normalize() -> void;
+
+    std::vector<SymbolTable::Id> variables;
+    std::vector<Term> terms;
+};
+
+} // Oasis
+
+#endif // OASIS_POLYNOMIAL_HPP
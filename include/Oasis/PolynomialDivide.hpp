@@ -0,0 +1,83 @@
+#ifndef OASIS_POLYNOMIALDIVIDE_HPP
+#define OASIS_POLYNOMIALDIVIDE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Oasis {
+
+// The functions below work on dense univariate polynomials, given from the constant term to the
+// term of the highest degree. Their results have no leading zero coefficients, so that the zero
+// polynomial has no coefficients at all.
+
+/**
+ * The length of the quotient from which `DivRemDense` divides by Newton's method rather than by
+ * the schoolbook method, as long as the divisor is at least `NewtonDivisorThreshold` long.
+ */
+constexpr std::size_t NewtonDivisionThreshold = 2048;
+
+/**
+ * The length of the divisor below which `DivRemDense` always divides by the schoolbook method,
+ * whose cost grows with the length of the divisor while that of Newton's method hardly does.
+ */
+constexpr std::size_t NewtonDivisorThreshold = 8192;
+
+/**
+ * Divides a dense polynomial by another, with remainder.
+ *
+ * Polynomials with integer coefficients whose divisor has a leading coefficient of 1 or -1, whose
+ * quotient is at least `NewtonDivisionThreshold` long, and whose divisor is at least
+ * `NewtonDivisorThreshold` long, are divided exactly by `DivRemNewton`, as long as no intermediate
+ * coefficient overflows. Other polynomials are divided by `DivRemSchoolbook`.
+ *
+ * @param dividend The coefficients of the dividend.
+ * @param divisor The coefficients of the divisor.
+ * @return The coefficients of the quotient and of the remainder, whose degree is less than that of
+ * the divisor.
+ * @throws std::domain_error If the divisor is zero.
+ */
+auto DivRemDense(std::span<const double> dividend, std::span<const double> divisor) -> std::pair<std::vector<double>, std::vector<double>>;
+
+/**
+ * Divides a dense polynomial by another, with remainder, by long division in O(mn) time for a
+ * quotient of length m and a divisor of length n.
+ *
+ * @see DivRemDense
+ */
+auto DivRemSchoolbook(std::span<const double> dividend, std::span<const double> divisor) -> std::pair<std::vector<double>, std::vector<double>>;
+
+/**
+ * Divides a dense polynomial with integer coefficients by another whose leading coefficient is 1
+ * or -1, with remainder, in the time of a few multiplications by `MultiplyDense`.
+ *
+ * The quotient of the reversed polynomials is a power series, which is the reversed dividend
+ * times the reciprocal of the reversed divisor from `InvertSeries`, truncated to the length of
+ * the quotient. The remainder is then the dividend less the divisor times the quotient.
+ *
+ * @param dividend The coefficients of the dividend.
+ * @param divisor The coefficients of the divisor.
+ * @return The coefficients of the quotient and of the remainder, or `std::nullopt` if a coefficient
+ * would not fit in 64 bits.
+ * @throws std::domain_error If the leading coefficient of the divisor is not 1 or -1.
+ */
+auto DivRemNewton(std::span<const std::int64_t> dividend, std::span<const std::int64_t> divisor) -> std::optional<std::pair<std::vector<std::int64_t>, std::vector<std::int64_t>>>;
+
+/**
+ * Computes the reciprocal of a power series with integer coefficients whose constant term is 1 or
+ * -1, by Newton's method, which doubles the number of correct coefficients with each step.
+ *
+ * @param coefficients The coefficients of the power series.
+ * @param length The number of coefficients of the reciprocal to compute.
+ * @return The first `length` coefficients of the reciprocal, or `std::nullopt` if a coefficient
+ * would not fit in 64 bits.
+ * @throws std::domain_error If the constant term is not 1 or -1.
+ */
+auto InvertSeries(std::span<const std::int64_t> coefficients, std::size_t length) -> std::optional<std::vector<std::int64_t>>;
+
+} // Oasis
+
+#endif // OASIS_POLYNOMIALDIVIDE_HPP
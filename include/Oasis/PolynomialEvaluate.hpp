@@ -0,0 +1,32 @@
+#ifndef OASIS_POLYNOMIALEVALUATE_HPP
+#define OASIS_POLYNOMIALEVALUATE_HPP
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Oasis {
+
+/**
+ * The number of points that `EvaluateMultipoint` carries through each pass over the coefficients.
+ */
+constexpr std::size_t EvaluationBlockSize = 64;
+
+/**
+ * Evaluates a polynomial with real coefficients at many points.
+ *
+ * The points are evaluated by Horner's method in blocks of `EvaluationBlockSize`, one coefficient
+ * at a time for the whole block, so that the steps for different points are independent and can
+ * run in parallel in vector registers instead of each waiting on the last. Each value is as
+ * accurate as if it had been evaluated on its own.
+ *
+ * @param coefficients The coefficients of the polynomial, from the constant term to the term of the
+ * highest degree.
+ * @param points The points.
+ * @return The value of the polynomial at each point, in the same order.
+ */
+auto EvaluateMultipoint(std::span<const double> coefficients, std::span<const double> points) -> std::vector<double>;
+
+} // Oasis
+
+#endif // OASIS_POLYNOMIALEVALUATE_HPP
@@ -0,0 +1,43 @@
+#ifndef OASIS_POLYNOMIALGCD_HPP
+#define OASIS_POLYNOMIALGCD_HPP
+
+#include <optional>
+#include <utility>
+
+#include "Polynomial.hpp"
+
+namespace Oasis {
+
+/**
+ * Computes the greatest common divisor of two polynomials in any number of variables.
+ *
+ * Each polynomial is first scaled exactly to integer coefficients. The divisor is then found by the
+ * heuristic GCD, which evaluates the polynomials at a large integer, one variable at a time, takes
+ * the greatest common divisor of the resulting integers, and recovers a candidate divisor from its
+ * digits in that base, kept only if it divides both polynomials. If a few evaluation points all
+ * fail, the divisor is instead found by the subresultant remainder sequence, which keeps the
+ * coefficients of the remainders small without computing their contents at every step.
+ *
+ * @param lhs The first polynomial.
+ * @param rhs The second polynomial.
+ * @return The greatest common divisor over the union of the variables of the polynomials, scaled to
+ * integer coefficients with no common factor and a positive leading coefficient, which is 1 if the
+ * polynomials have no common factor, or the zero polynomial if both are zero.
+ */
+auto Gcd(const Polynomial& lhs, const Polynomial& rhs) -> Polynomial;
+
+/**
+ * Cancels the common factors of the numerator and the denominator of a rational function.
+ *
+ * @param numerator The numerator.
+ * @param denominator The denominator.
+ * @return The reduced numerator and denominator, whose quotient equals that of the originals,
+ * where the denominator is 1 if it divides the numerator and otherwise has a positive leading
+ * coefficient, or `std::nullopt` if they have no common factor other than a constant, or if either
+ * is zero.
+ */
+auto CancelCommonFactors(const Polynomial& numerator, const Polynomial& denominator) -> std::optional<std::pair<Polynomial, Polynomial>>;
+
+} // Oasis
+
+#endif // OASIS_POLYNOMIALGCD_HPP
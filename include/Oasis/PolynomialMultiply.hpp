@@ -0,0 +1,78 @@
+#ifndef OASIS_POLYNOMIALMULTIPLY_HPP
+#define OASIS_POLYNOMIALMULTIPLY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Oasis {
+
+/**
+ * The length of the shorter operand below which `MultiplyDense` multiplies by the schoolbook
+ * method, and below which `MultiplyKaratsuba` stops recursing.
+ */
+constexpr std::size_t KaratsubaThreshold = 32;
+
+/**
+ * The length of the shorter operand from which `MultiplyDense` multiplies with the number-theoretic
+ * transform.
+ */
+constexpr std::size_t NttThreshold = 512;
+
+/**
+ * Checks whether the product of two dense univariate polynomials can be multiplied exactly.
+ *
+ * The check bounds the coefficients of the product by the largest coefficients of the operands, so
+ * it may reject a product whose coefficients would have fit.
+ *
+ * @param lhs The coefficients of the left operand.
+ * @param rhs The coefficients of the right operand.
+ * @return Whether every coefficient of the product is sure to fit in 64 bits.
+ */
+auto DenseProductFits(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> bool;
+
+/**
+ * Multiplies two dense univariate polynomials with integer coefficients.
+ *
+ * The polynomials are given by their coefficients, from the constant term to the term of the
+ * highest degree. The product is computed exactly by the schoolbook method, Karatsuba's method or
+ * the number-theoretic transform, depending on the length of the shorter operand.
+ *
+ * @param lhs The coefficients of the left operand.
+ * @param rhs The coefficients of the right operand.
+ * @return The coefficients of the product, which has `lhs.size() + rhs.size() - 1` of them, or
+ * none if either operand has none.
+ * @throws std::overflow_error If `DenseProductFits` rejects the product.
+ */
+auto MultiplyDense(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::vector<std::int64_t>;
+
+/**
+ * Multiplies two dense univariate polynomials by the schoolbook method in quadratic time.
+ *
+ * @see MultiplyDense
+ */
+auto MultiplySchoolbook(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::vector<std::int64_t>;
+
+/**
+ * Multiplies two dense univariate polynomials by Karatsuba's method in O(n^1.59) time.
+ *
+ * @see MultiplyDense
+ */
+auto MultiplyKaratsuba(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::vector<std::int64_t>;
+
+/**
+ * Multiplies two dense univariate polynomials with the number-theoretic transform in O(n log n)
+ * time.
+ *
+ * The product is computed modulo three primes and reconstructed by the Chinese remainder theorem.
+ * Products with more than 2^23 coefficients, which the primes cannot transform, are multiplied by
+ * Karatsuba's method instead.
+ *
+ * @see MultiplyDense
+ */
+auto MultiplyNtt(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::vector<std::int64_t>;
+
+} // Oasis
+
+#endif // OASIS_POLYNOMIALMULTIPLY_HPP
@@ -0,0 +1,38 @@
+#ifndef OASIS_POLYNOMIALROOTS_HPP
+#define OASIS_POLYNOMIALROOTS_HPP
+
+#include <complex>
+#include <span>
+#include <vector>
+
+namespace Oasis {
+
+/**
+ * Finds every complex root of a polynomial with real coefficients numerically.
+ *
+ * The roots are found by Aberth-Ehrlich iteration, which refines approximations of every root at
+ * once and converges cubically to simple roots, so that a polynomial of degree n takes O(n^2) time
+ * per sweep. If the iteration does not converge, the roots are instead the eigenvalues of the
+ * balanced companion matrix of the polynomial. Either way, each root may then be polished by
+ * Newton's method on the polynomial itself, keeping each step only if it reduces the residual.
+ * The nonreal roots are then returned in exact conjugate pairs: a root whose imaginary part is
+ * within the tolerance, or whose real part is as good a root to within rounding error, is snapped
+ * onto the real axis, and the others are paired with their nearest conjugates and averaged.
+ * A root of multiplicity m can only be found to about the m-th root of the machine precision.
+ *
+ * @param coefficients The coefficients of the polynomial, from the constant term to the term of the
+ * highest degree.
+ * @param tolerance The relative size of the last Newton step at which a root is considered polished,
+ * and of the imaginary part below which a root is considered real.
+ * @param polish Whether to polish the roots by Newton's method.
+ * @return The roots, repeated by their multiplicities and sorted by their real and then imaginary
+ * parts, or none if the polynomial is a nonzero constant.
+ * @throws std::domain_error If the polynomial is zero, since every number is then a root.
+ * @throws std::runtime_error If neither the iteration nor the eigenvalues of the companion matrix
+ * converge.
+ */
+auto FindRoots(std::span<const double> coefficients, double tolerance = 1e-12, bool polish = true) -> std::vector<std::complex<double>>;
+
+} // Oasis
+
+#endif // OASIS_POLYNOMIALROOTS_HPP
@@ -0,0 +1,36 @@
+#ifndef OASIS_PRODUCT_HPP
+#define OASIS_PRODUCT_HPP
+
+#include "Multiply.hpp"
+#include "NaryExpression.hpp"
+
+namespace Oasis {
+
+/**
+ * The Product expression multiplies any number of expressions together.
+ *
+ * A Product is equivalent to a tree of Multiply expressions, but stores its factors contiguously.
+ * Simplifying a Product combines like factors directly, without flattening and rebuilding a tree,
+ * and produces a Product again.
+ */
+class Product final : public NaryExpression<Product, Multiply, ExpressionType::Product> {
+public:
+    using NaryExpression::NaryExpression;
+
+    Product(const Product& other) = default;
+
+    auto operator=(const Product& other) -> Product& = default;
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression> final;
+
+private:
+    static auto Combine(std::vector<std::unique_ptr<Expression>> simplified) -> std::unique_ptr<Expression>;
+};
+
+} // Oasis
+
+#endif // OASIS_PRODUCT_HPP
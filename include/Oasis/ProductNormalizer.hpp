@@ -0,0 +1,115 @@
+#ifndef OASIS_PRODUCTNORMALIZER_HPP
+#define OASIS_PRODUCTNORMALIZER_HPP
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Expression.hpp"
+#include "Fraction.hpp"
+
+namespace Oasis {
+
+/**
+ * Normalizes products and quotients of simplified factors.
+ *
+ * A ProductNormalizer gathers the factors of a product or quotient into a numeric coefficient and
+ * a map from each base to its summed exponent, so that like factors, such as `x^2`, `x` and `1/x`,
+ * are combined however many factors there are and however they are nested. Factors are grouped by
+ * the hash of their base, so gathering n factors takes linear time. The normalized expression is
+ * then rebuilt once, with the coefficient first and the bases in the canonical order.
+ *
+ * Products among the factors are flattened into their own factors. Other expressions, including
+ * quotients, are factors of their own. Integer powers of the imaginary unit are reduced to `1`,
+ * `i`, `-1` or `-i`. The coefficient is an exact `Rational` if every numeric factor is rational,
+ * and a `Real` otherwise.
+ *
+ * The normalizer refers to the factors instead of copying them, so they must outlive it.
+ */
+class ProductNormalizer {
+public:
+    /**
+     * Multiplies the normalized expression by a factor.
+     *
+     * @param factor The simplified factor.
+     */
+    auto MultiplyBy(const Expression& factor) -> void;
+
+    /**
+     * Divides the normalized expression by a factor.
+     *
+     * @param factor The simplified factor.
+     */
+    auto DivideBy(const Expression& factor) -> void;
+
+    /**
+     * Builds the normalized expression as a product.
+     *
+     * Factors with negative exponents are raised to their exponent, as in `x^-1`.
+     *
+     * @return The normalized product.
+     */
+    [[nodiscard]] auto BuildProduct() const -> std::unique_ptr<Expression>;
+
+    /**
+     * Builds the normalized expression as a quotient.
+     *
+     * Factors with negative exponents are moved into the divisor, as in `1 / x`. If there are none,
+     * the result is a product.
+     *
+     * @return The normalized quotient.
+     */
+    [[nodiscard]] auto BuildQuotient() const -> std::unique_ptr<Expression>;
+
+    /**
+     * Builds the factors of the normalized expression.
+     *
+     * Factors with negative exponents are raised to their exponent, as in `BuildProduct`. The
+     * coefficient is the first factor, unless it is one and there are other factors. If it is zero,
+     * it is the only factor.
+     *
+     * @return The factors, with the non-numeric factors in the canonical order of their bases.
+     */
+    [[nodiscard]] auto BuildFactors() const -> std::vector<std::unique_ptr<Expression>>;
+
+private:
+    // The product of the numeric factors, which is also kept exactly while they are all rational.
+    struct Coefficient {
+        double value = 1.0;
+        std::optional<Fraction> exact;
+        bool inexact = false;
+
+        [[nodiscard]] auto IsOne() const -> bool;
+        [[nodiscard]] auto IsZero() const -> bool;
+        auto Negate() -> void;
+        [[nodiscard]] auto ToExpression() const -> std::unique_ptr<Expression>;
+    };
+
+    // The exponents of a base. Real exponents are summed as they are gathered.
+    struct Power {
+        const Expression* base;
+        double realExponent;
+        std::vector<const Expression*> exponents;
+        std::vector<const Expression*> inverseExponents;
+    };
+
+    // A base raised to its summed exponent. An inverted factor is the reciprocal of the base raised
+    // to the exponent.
+    struct Factor {
+        const Expression* base;
+        std::unique_ptr<Expression> exponent;
+        bool inverted;
+    };
+
+    auto Gather(const Expression& factor, bool inverse) -> void;
+    [[nodiscard]] auto Normalize(Coefficient& normalizedCoefficient) const -> std::vector<Factor>;
+
+    Coefficient coefficient;
+    std::vector<Power> powers;
+    std::unordered_map<std::size_t, std::vector<std::size_t>> powersByHash;
+};
+
+} // Oasis
+
+#endif // OASIS_PRODUCTNORMALIZER_HPP
@@ -0,0 +1,57 @@
+#ifndef OASIS_RATIONAL_HPP
+#define OASIS_RATIONAL_HPP
+
+#include "Fraction.hpp"
+#include "LeafExpression.hpp"
+
+namespace Oasis {
+
+/**
+ * An exact rational number.
+ *
+ * Unlike `Real`, which holds a double, a Rational holds a `Fraction`, so sums, products, quotients
+ * and integer powers of rationals are folded without rounding, however large their numerators and
+ * denominators grow. Folding a rational with a real produces a real.
+ */
+class Rational : public LeafExpression<Rational> {
+public:
+    Rational() = default;
+    Rational(const Rational& other) = default;
+
+    explicit Rational(Fraction value);
+
+    /**
+     * Creates a rational from an integer numerator and denominator.
+     *
+     * @throws std::domain_error If the denominator is zero.
+     */
+    Rational(std::int64_t numerator, std::int64_t denominator);
+
+    [[nodiscard]] auto Equals(const Expression& other) const -> bool final;
+
+    EXPRESSION_TYPE(Rational)
+    EXPRESSION_CATEGORY(UnExp)
+
+    /**
+     * Gets the value of the rational number.
+     * @return The value of the rational number.
+     */
+    [[nodiscard]] auto GetValue() const -> const Fraction&;
+
+    static auto Specialize(const Expression& other) -> std::unique_ptr<Rational>;
+    static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Rational>;
+
+    auto operator=(const Rational& other) -> Rational& = default;
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeHash() const -> std::size_t final;
+    [[nodiscard]] auto ComputeDerivative(const Expression&, const Expression&) const -> std::unique_ptr<Expression> final;
+
+private:
+    Fraction value;
+};
+
+} // Oasis
+
+#endif // OASIS_RATIONAL_HPP
@@ -30,14 +30,16 @@ public:
      */
     [[nodiscard]] auto GetValue() const -> double;
 
-    [[nodiscard]] auto ToString() const -> std::string final;
-
     static auto Specialize(const Expression& other) -> std::unique_ptr<Real>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Real>;
-    [[nodiscard]] auto Differentiate(const Expression&) -> std::unique_ptr<Expression> final;
 
     auto operator=(const Real& other) -> Real& = default;
 
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeHash() const -> std::size_t final;
+    [[nodiscard]] auto ComputeDerivative(const Expression&, const Expression&) const -> std::unique_ptr<Expression> final;
+
 private:
     double value {};
 };
@@ -0,0 +1,60 @@
+#ifndef OASIS_REALROOTS_HPP
+#define OASIS_REALROOTS_HPP
+
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "BigInt.hpp"
+#include "Fraction.hpp"
+
+namespace Oasis {
+
+/**
+ * Isolates the distinct real roots of a polynomial with integer coefficients in a closed interval.
+ *
+ * The roots are counted exactly with the Sturm sequence of the square-free part of the polynomial,
+ * evaluated at rational points, and intervals are bisected until each holds a single root, so that
+ * the work grows with the number of roots rather than with the degree or the size of the
+ * coefficients.
+ *
+ * @param coefficients The coefficients of the polynomial, from the constant term to the term of the
+ * highest degree.
+ * @param lower The lower end of the interval.
+ * @param upper The upper end of the interval.
+ * @return For each root, in ascending order, an interval `(a, b]` that contains it and no other
+ * root, or `[a, a]` if the root is exactly `a`.
+ * @throws std::domain_error If the polynomial is zero, since every number is then a root.
+ */
+auto IsolateRealRoots(std::span<const BigInt> coefficients, const Fraction& lower, const Fraction& upper) -> std::vector<std::pair<Fraction, Fraction>>;
+
+/**
+ * Finds the distinct real roots of a polynomial in a closed interval to a given tolerance.
+ *
+ * The coefficients are converted exactly to integers, the roots are isolated by `IsolateRealRoots`,
+ * and each isolating interval is then bisected exactly until it is no wider than the tolerance.
+ *
+ * @param coefficients The coefficients of the polynomial, from the constant term to the term of the
+ * highest degree.
+ * @param lower The lower end of the interval, which may be negative infinity.
+ * @param upper The upper end of the interval, which may be infinity.
+ * @param tolerance The largest distance between a returned value and the root it approximates,
+ * which must be positive.
+ * @return The roots, in ascending order.
+ * @throws std::domain_error If the polynomial is zero, if a coefficient is infinite or NaN, if an end
+ * of the interval is NaN, or if the tolerance is not positive.
+ */
+auto FindRealRoots(std::span<const double> coefficients, double lower, double upper, double tolerance = 1e-12) -> std::vector<double>;
+
+/**
+ * Finds the distinct real roots of a polynomial with integer coefficients in a closed interval to a
+ * given tolerance, as the overload for double coefficients does once it has converted them.
+ *
+ * @throws std::domain_error If the polynomial is zero, if an end of the interval is NaN, or if the
+ * tolerance is not positive.
+ */
+auto FindRealRoots(std::span<const BigInt> coefficients, double lower, double upper, double tolerance = 1e-12) -> std::vector<double>;
+
+} // Oasis
+
+#endif // OASIS_REALROOTS_HPP
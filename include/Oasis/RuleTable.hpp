@@ -0,0 +1,134 @@
+#ifndef OASIS_RULETABLE_HPP
+#define OASIS_RULETABLE_HPP
+
+#include <array>
+#include <concepts>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "View.hpp"
+
+namespace Oasis {
+
+/**
+ * A table of simplification rules for a binary expression, indexed by the types of its operands.
+ *
+ * Each rule is written against a pattern type, such as `Add<Multiply<Real, Expression>, Expression>`,
+ * and receives a `View` of the expression it matched. A rule returns the rewritten expression, or
+ * `nullptr` if it does not apply after all, in which case the next rule is tried.
+ *
+ * When a table is built, every rule is filed under each pair of operand types that its pattern can
+ * match, taking commutativity into account, while keeping the order in which rules were
+ * registered. Applying the table then only tries the rules filed under the operand types of the
+ * expression, so rules whose shape cannot match cost nothing, no matter how many there are.
+ *
+ * @tparam NodeT The binary expression the rules apply to.
+ */
+template <template <IExpression, IExpression> class NodeT>
+class RuleTable {
+public:
+    /**
+     * A type-erased rule, which returns `nullptr` if it does not apply.
+     */
+    using Rule = auto (*)(const Expression& node) -> std::unique_ptr<Expression>;
+
+    /**
+     * A rule, together with the operand types it can match. `ExpressionType::None` matches any type.
+     */
+    struct Entry {
+        ExpressionType mostSigOpType;
+        ExpressionType leastSigOpType;
+        Rule rule;
+    };
+
+    /**
+     * Creates a rule from a pattern and a function that rewrites the matched expression.
+     *
+     * @tparam PatternT The pattern the rule matches, such as `Add<Real, Expression>`.
+     * @param fn A function without captures, taking a `View<PatternT>` and returning the rewritten
+     *           expression or `nullptr`.
+     * @return The rule.
+     */
+    template <IExpression PatternT, typename FnT>
+        requires std::is_empty_v<FnT> && std::default_initializable<FnT>
+    static auto Make(FnT) -> Entry
+    {
+        return {
+            TypeOf<typename View<PatternT>::MostSigOpPattern>(),
+            TypeOf<typename View<PatternT>::LeastSigOpPattern>(),
+            [](const Expression& node) -> std::unique_ptr<Expression> {
+                if (auto view = View<PatternT>::Specialize(node)) {
+                    return FnT {}(*view);
+                }
+
+                return nullptr;
+            }
+        };
+    }
+
+    RuleTable(std::initializer_list<Entry> entries)
+    {
+        constexpr bool commutative = NodeT<Expression, Expression>::GetStaticCategory() & Commutative;
+
+        for (std::size_t mostSigOpType = 0; mostSigOpType < TypeCount; ++mostSigOpType) {
+            for (std::size_t leastSigOpType = 0; leastSigOpType < TypeCount; ++leastSigOpType) {
+                auto& rules = candidates[mostSigOpType * TypeCount + leastSigOpType];
+
+                for (const Entry& entry : entries) {
+                    const bool matches = Matches(entry.mostSigOpType, mostSigOpType) && Matches(entry.leastSigOpType, leastSigOpType);
+                    const bool matchesSwapped = commutative && Matches(entry.mostSigOpType, leastSigOpType) && Matches(entry.leastSigOpType, mostSigOpType);
+
+                    if (matches || matchesSwapped) {
+                        rules.push_back(entry.rule);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Applies the first rule that matches an expression.
+     *
+     * @param node The expression to rewrite, which must have two operands.
+     * @return The rewritten expression, or `nullptr` if no rule applies.
+     */
+    auto Apply(const Expression& node) const -> std::unique_ptr<Expression>
+    {
+        const auto mostSigOpType = static_cast<std::size_t>(node.GetOperandAt(0).GetType());
+        const auto leastSigOpType = static_cast<std::size_t>(node.GetOperandAt(1).GetType());
+
+        for (Rule rule : candidates[mostSigOpType * TypeCount + leastSigOpType]) {
+            if (auto result = rule(node)) {
+                return result;
+            }
+        }
+
+        return nullptr;
+    }
+
+private:
+    static constexpr std::size_t TypeCount = static_cast<std::size_t>(ExpressionType::Count);
+
+    template <IExpression T>
+    static auto TypeOf() -> ExpressionType
+    {
+        if constexpr (std::same_as<T, Expression>) {
+            return ExpressionType::None;
+        } else {
+            return T::GetStaticType();
+        }
+    }
+
+    static auto Matches(ExpressionType pattern, std::size_t type) -> bool
+    {
+        return pattern == ExpressionType::None || static_cast<std::size_t>(pattern) == type;
+    }
+
+    std::array<std::vector<Rule>, TypeCount * TypeCount> candidates;
+};
+
+} // Oasis
+
+#endif // OASIS_RULETABLE_HPP
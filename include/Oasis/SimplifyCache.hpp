@@ -0,0 +1,149 @@
+#ifndef OASIS_SIMPLIFYCACHE_HPP
+#define OASIS_SIMPLIFYCACHE_HPP
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Expression.hpp"
+
+namespace Oasis {
+
+/**
+ * A bounded cache of simplified expressions.
+ *
+ * While a cache is active, `Expression::Simplify` looks up every non-leaf expression in the cache
+ * before simplifying it, and stores the result afterwards, so that equal subtrees are only
+ * simplified once. Expressions are found by their hash and compared with `Equals`. When the cache
+ * is full, the least recently used entry is evicted.
+ *
+ * A cache can be activated on the current thread with a `Scope`, for example for the duration of a
+ * single request, or for the whole process with `SetGlobal`, in which case it is also used by the
+ * worker threads of `SimplifyAsync`. `SimplifyAsync` only looks up expressions, since its weaker
+ * rules may not simplify them fully. A scoped cache takes precedence over the global cache. A cache
+ * is safe to use from multiple threads.
+ *
+ * Expressions are not cached while an `ExpressionArena` is active on the calling thread, since the
+ * cache would otherwise keep the arena's expressions alive past a reset.
+ */
+class SimplifyCache {
+public:
+    /**
+     * Activates a cache on the current thread for the lifetime of the scope.
+     *
+     * Scopes may be nested, in which case the previously active cache is restored when the inner
+     * scope ends.
+     */
+    class Scope {
+    public:
+        explicit Scope(SimplifyCache& cache);
+        Scope(const Scope& other) = delete;
+        ~Scope();
+
+        auto operator=(const Scope& other) -> Scope& = delete;
+
+    private:
+        SimplifyCache* previous;
+    };
+
+    explicit SimplifyCache(std::size_t capacity = 4096);
+    SimplifyCache(const SimplifyCache& other) = delete;
+
+    /**
+     * Removes every entry from the cache and resets its statistics.
+     */
+    auto Clear() -> void;
+
+    /**
+     * Looks up the simplified form of an expression.
+     *
+     * @param expression The expression to look up.
+     * @return A copy of the simplified expression, or `nullptr` if the expression is not cached.
+     */
+    [[nodiscard]] auto Find(const Expression& expression) -> std::unique_ptr<Expression>;
+
+    /**
+     * Stores the simplified form of an expression, evicting the least recently used entry if the
+     * cache is full.
+     *
+     * @param expression The expression that was simplified.
+     * @param simplified The simplified expression.
+     */
+    auto Insert(const Expression& expression, const Expression& simplified) -> void;
+
+    /**
+     * Gets the maximum number of entries in the cache.
+     *
+     * @return The maximum number of entries in the cache.
+     */
+    [[nodiscard]] auto GetCapacity() const -> std::size_t;
+
+    /**
+     * Gets the number of lookups that found an entry.
+     *
+     * @return The number of lookups that found an entry.
+     */
+    [[nodiscard]] auto GetHits() const -> std::size_t;
+
+    /**
+     * Gets the number of lookups that did not find an entry.
+     *
+     * @return The number of lookups that did not find an entry.
+     */
+    [[nodiscard]] auto GetMisses() const -> std::size_t;
+
+    /**
+     * Gets the number of entries in the cache.
+     *
+     * @return The number of entries in the cache.
+     */
+    [[nodiscard]] auto GetSize() const -> std::size_t;
+
+    /**
+     * Gets the cache used by `Expression::Simplify` on the current thread.
+     *
+     * @return The scoped cache if there is one, otherwise the global cache, or `nullptr` if no
+     *         cache is active.
+     */
+    static auto GetCurrent() -> SimplifyCache*;
+
+    /**
+     * Sets the cache used by every thread that has no scoped cache.
+     *
+     * @param cache The global cache, or `nullptr` to disable it.
+     */
+    static auto SetGlobal(SimplifyCache* cache) -> void;
+
+    /**
+     * Gets whether the simplified form of an expression may be cached.
+     *
+     * @param expression The expression to check.
+     * @return Whether the expression may be cached.
+     */
+    static auto IsCacheable(const Expression& expression) -> bool;
+
+    auto operator=(const SimplifyCache& other) -> SimplifyCache& = delete;
+
+private:
+    struct Entry {
+        std::unique_ptr<Expression> expression;
+        std::unique_ptr<Expression> simplified;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    auto FindUnlocked(const Expression& expression) -> EntryList::iterator;
+
+    EntryList entries;
+    std::unordered_multimap<std::size_t, EntryList::iterator> index;
+    std::size_t capacity;
+    std::atomic<std::size_t> hits = 0;
+    std::atomic<std::size_t> misses = 0;
+    mutable std::mutex mutex;
+};
+
+} // Oasis
+
+#endif // OASIS_SIMPLIFYCACHE_HPP
@@ -23,18 +23,20 @@ public:
     Subtract(const Subtract<Expression, Expression>& other) = default;
 
     Subtract(const Expression& minuend, const Expression& subtrahend);
+    Subtract(std::unique_ptr<Expression>&& minuend, std::unique_ptr<Expression>&& subtrahend);
 
-    [[nodiscard]] auto Simplify() const -> std::unique_ptr<Expression> final;
-    auto Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
-
-    [[nodiscard]] auto ToString() const -> std::string final;
-    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression> final;
 
     static auto Specialize(const Expression& other) -> std::unique_ptr<Subtract>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Subtract>;
 
     EXPRESSION_TYPE(Subtract)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression> final;
 };
 /// @endcond
 
@@ -58,9 +60,9 @@ public:
     {
     }
 
-    [[nodiscard]] auto ToString() const -> std::string final
+    Subtract(std::unique_ptr<MinuendT>&& addend1, std::unique_ptr<SubtrahendT>&& addend2)
+        : BinaryExpression<Subtract, MinuendT, SubtrahendT>(std::move(addend1), std::move(addend2))
     {
-        return fmt::format("({} - {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
     }
 
     IMPL_SPECIALIZE(Subtract, MinuendT, SubtrahendT)
@@ -69,6 +71,12 @@ public:
 
     EXPRESSION_TYPE(Subtract)
     EXPRESSION_CATEGORY(BinExp)
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final
+    {
+        return fmt::format("({} - {})", this->mostSigOp->ToString(), this->leastSigOp->ToString());
+    }
 };
 
 } // Oasis
@@ -0,0 +1,36 @@
+#ifndef OASIS_SUM_HPP
+#define OASIS_SUM_HPP
+
+#include "Add.hpp"
+#include "NaryExpression.hpp"
+
+namespace Oasis {
+
+/**
+ * The Sum expression adds any number of expressions together.
+ *
+ * A Sum is equivalent to a tree of Add expressions, but stores its terms contiguously. Simplifying a
+ * Sum combines like terms directly, without flattening and rebuilding a tree, and produces a Sum
+ * again, which makes it well suited to large sums such as polynomials.
+ */
+class Sum final : public NaryExpression<Sum, Add, ExpressionType::Sum> {
+public:
+    using NaryExpression::NaryExpression;
+
+    Sum(const Sum& other) = default;
+
+    auto operator=(const Sum& other) -> Sum& = default;
+
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeSimplified() const -> std::unique_ptr<Expression> final;
+    auto ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final;
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression> final;
+
+private:
+    static auto Combine(std::vector<std::unique_ptr<Expression>> simplified) -> std::unique_ptr<Expression>;
+};
+
+} // Oasis
+
+#endif // OASIS_SUM_HPP
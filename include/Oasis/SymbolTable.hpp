@@ -0,0 +1,79 @@
+#ifndef OASIS_SYMBOLTABLE_HPP
+#define OASIS_SYMBOLTABLE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Oasis {
+
+/**
+ * A table of interned symbol names.
+ *
+ * Interning a name through a SymbolTable returns a compact integer id that is shared by every
+ * occurrence of the same name, so that symbols can be compared and hashed as integers instead of
+ * strings. Names are never removed, and the name of an id stays at the same address for the
+ * lifetime of the table.
+ *
+ * Variables intern their names through the global table. The table is safe to use from multiple
+ * threads.
+ */
+class SymbolTable {
+public:
+    /**
+     * The id of an interned name.
+     */
+    using Id = std::uint32_t;
+
+    /**
+     * The id of the empty name, which every table interns first.
+     */
+    static constexpr Id EmptyId = 0;
+
+    SymbolTable();
+    SymbolTable(const SymbolTable& other) = delete;
+
+    /**
+     * Gets the table used by variables.
+     *
+     * @return The global symbol table.
+     */
+    static auto Global() -> SymbolTable&;
+
+    /**
+     * Gets the name of an interned id.
+     *
+     * @param id The id returned by `Intern`.
+     * @return The name of the id.
+     */
+    [[nodiscard]] auto GetName(Id id) const -> const std::string&;
+
+    /**
+     * Gets the number of names in this table.
+     *
+     * @return The number of names in this table.
+     */
+    [[nodiscard]] auto GetSize() const -> std::size_t;
+
+    /**
+     * Gets the id of a name, adding it to the table if needed.
+     *
+     * @param name The name to intern.
+     * @return The id of the name.
+     */
+    auto Intern(std::string_view name) -> Id;
+
+    auto operator=(const SymbolTable& other) -> SymbolTable& = delete;
+
+private:
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, Id> ids;
+    mutable std::shared_mutex mutex;
+};
+
+} // Oasis
+
+#endif // OASIS_SYMBOLTABLE_HPP
@@ -0,0 +1,192 @@
+#ifndef OASIS_TRAVERSAL_HPP
+#define OASIS_TRAVERSAL_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Expression.hpp"
+#include "ExpressionArena.hpp"
+
+namespace Oasis {
+
+/**
+ * Visits an expression and its operands, each node before its operands.
+ *
+ * The traversal keeps its own stack instead of recursing, so it is safe to use on expressions of
+ * any depth. Operands are visited from the most significant to the least significant.
+ *
+ * @param root The expression to traverse.
+ * @param visit Called with each node. Returns whether the operands of the node should be visited.
+ */
+template <typename VisitT>
+auto PreOrder(const Expression& root, VisitT&& visit) -> void
+{
+    std::vector<const Expression*> stack { &root };
+
+    while (!stack.empty()) {
+        const Expression* node = stack.back();
+        stack.pop_back();
+
+        if (!visit(*node)) {
+            continue;
+        }
+
+        for (std::size_t i = node->GetOperandCount(); i-- > 0;) {
+            stack.push_back(&node->GetOperandAt(i));
+        }
+    }
+}
+
+/**
+ * Visits an expression and its operands, each node after its operands.
+ *
+ * The traversal keeps its own stack instead of recursing, so it is safe to use on expressions of
+ * any depth. Operands are visited from the most significant to the least significant.
+ *
+ * @param root The expression to traverse.
+ * @param enter Called with each node before its operands. Returns whether the node should be
+ *              traversed. Neither a skipped node nor its operands are visited.
+ * @param visit Called with each node that was entered, after its operands.
+ */
+template <typename EnterT, typename VisitT>
+auto PostOrder(const Expression& root, EnterT&& enter, VisitT&& visit) -> void
+{
+    if (!enter(root)) {
+        return;
+    }
+
+    // Each entry holds a node and the index of the next operand to traverse.
+    std::vector<std::pair<const Expression*, std::size_t>> stack { { &root, 0 } };
+
+    while (!stack.empty()) {
+        auto& [node, next] = stack.back();
+
+        if (next == node->GetOperandCount()) {
+            visit(*node);
+            stack.pop_back();
+            continue;
+        }
+
+        const Expression& operand = node->GetOperandAt(next++);
+
+        if (enter(operand)) {
+            stack.emplace_back(&operand, 0);
+        }
+    }
+}
+
+/**
+ * Rebuilds an expression from the bottom up.
+ *
+ * Each node is rebuilt from the results of its operands with `WithOperands` and passed to `exit`,
+ * which returns the result for the node. A node whose operands all resulted in themselves is not
+ * rebuilt. Instead, the node itself is passed to `exit`, so that untouched subtrees can be shared
+ * between the input and the result. This is the basis of operations such as `Simplify` and
+ * `Substitute`, which would otherwise recurse once per level of the expression. The traversal keeps
+ * its own stack, so it is safe to use on expressions of any depth. An operand shared by several
+ * nodes is only traversed once, and its result is reused wherever it appears, so `enter` and `exit`
+ * must depend only on the node they are given.
+ *
+ * @param root The expression to rebuild.
+ * @param owner The pointer that owns the root, if any.
+ * @param enter Called with each node and the pointer that owns it, if any, before its operands. May return the result for the node, in which case its operands
+ *              are not traversed, or `nullptr` to traverse them.
+ * @param exit Called with each traversed node and its rebuilt counterpart, after its operands.
+ *             Returns the result for the node, which must not be `nullptr`.
+ * @return The result for the root.
+ */
+template <typename EnterT, typename ExitT>
+auto Transform(const Expression& root, std::shared_ptr<Expression> owner, EnterT&& enter, ExitT&& exit) -> std::shared_ptr<Expression>
+{
+    if (auto result = enter(root, owner)) {
+        return result;
+    }
+
+    struct Frame {
+        const Expression* node;
+        std::shared_ptr<Expression> owner;
+        std::vector<std::shared_ptr<Expression>> results;
+        bool shared;
+    };
+
+    // The result of each operand with more than one owner, since only those can be reached more
+    // than once. Besides its parent, an operand is owned by the pointer taken to traverse it.
+    std::unordered_map<const Expression*, std::shared_ptr<Expression>> visited;
+
+    std::vector<Frame> stack;
+    stack.push_back({ &root, std::move(owner), {}, false });
+
+    while (true) {
+        Frame& frame = stack.back();
+        const Expression& node = *frame.node;
+        const std::size_t operandCount = node.GetOperandCount();
+
+        if (frame.results.size() < operandCount) {
+            const std::size_t index = frame.results.size();
+            auto operand = node.GetSharedOperandAt(index);
+            const bool shared = operand.use_count() > 2;
+
+            if (auto it = shared ? visited.find(operand.get()) : visited.end(); it != visited.end()) {
+                frame.results.push_back(it->second);
+            } else if (auto result = enter(*operand, operand)) {
+                if (shared) {
+                    visited.emplace(operand.get(), result);
+                }
+
+                frame.results.emplace_back(std::move(result));
+            } else {
+                frame.results.reserve(operandCount);
+                stack.push_back({ operand.get(), std::move(operand), {}, shared });
+            }
+
+            continue;
+        }
+
+        bool unchanged = true;
+
+        for (std::size_t i = 0; i < operandCount && unchanged; ++i) {
+            unchanged = frame.results[i].get() == &node.GetOperandAt(i);
+        }
+
+        std::shared_ptr<Expression> rebuilt;
+
+        if (!unchanged) {
+            rebuilt = ExpressionArena::Share(node.WithOperands(frame.results));
+        } else if (frame.owner) {
+            rebuilt = std::move(frame.owner);
+        } else {
+            rebuilt = ExpressionArena::Share(node.Copy());
+        }
+
+        auto result = exit(node, rebuilt);
+
+        if (frame.shared) {
+            visited.emplace(&node, result);
+        }
+
+        stack.pop_back();
+
+        if (stack.empty()) {
+            return result;
+        }
+
+        stack.back().results.emplace_back(std::move(result));
+    }
+}
+
+/**
+ * Rebuilds an expression that is not owned by a shared pointer from the bottom up.
+ *
+ * @see Transform
+ */
+template <typename EnterT, typename ExitT>
+auto Transform(const Expression& root, EnterT&& enter, ExitT&& exit) -> std::shared_ptr<Expression>
+{
+    return Transform(root, nullptr, std::forward<EnterT>(enter), std::forward<ExitT>(exit));
+}
+
+} // Oasis
+
+#endif // OASIS_TRAVERSAL_HPP
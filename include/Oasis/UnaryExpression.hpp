@@ -5,7 +5,10 @@
 #ifndef UNARYEXPRESSION_HPP
 #define UNARYEXPRESSION_HPP
 
+#include <cassert>
+
 #include "Expression.hpp"
+#include "ExpressionArena.hpp"
 
 namespace Oasis {
 
@@ -15,15 +18,16 @@ class UnaryExpression : public Expression {
     using DerivedSpecialized = DerivedT<OperandT>;
     using DerivedGeneralized = DerivedT<Expression>;
 
+    template <template <IExpression> class, IExpression>
+    friend class UnaryExpression;
+
 public:
     UnaryExpression() = default;
 
     UnaryExpression(const UnaryExpression& other)
         : Expression(other)
+        , op(other.op)
     {
-        if (other.HasOperand()) {
-            SetOperand(other.GetOperand());
-        }
     }
 
     explicit UnaryExpression(const OperandT& operand)
@@ -31,6 +35,23 @@ public:
         SetOperand(operand);
     }
 
+    /**
+     * Creates a unary expression that takes ownership of its operand.
+     *
+     * @param operand The operand.
+     */
+    template <typename T>
+        requires std::derived_from<T, OperandT> || std::same_as<T, Expression>
+    explicit UnaryExpression(std::unique_ptr<T>&& operand)
+    {
+        SetOperand(std::move(operand));
+    }
+
+    ~UnaryExpression() override
+    {
+        ReleaseOperand(std::move(op));
+    }
+
     [[nodiscard]] auto Copy() const -> std::unique_ptr<Expression> final
     {
         return std::make_unique<DerivedSpecialized>(*static_cast<const DerivedSpecialized*>(this));
@@ -43,25 +64,28 @@ public:
 
     [[nodiscard]] auto Equals(const Expression& other) const -> bool final
     {
-        if (!other.Is<DerivedSpecialized>()) {
-            return false;
+        if (this == &other) {
+            return true;
         }
 
-        // generalize
-        const auto otherGeneralized = other.Generalize();
-        const auto& otherUnaryGeneralized = dynamic_cast<const DerivedGeneralized&>(*otherGeneralized);
+        if (!other.Is<DerivedSpecialized>() || this->Hash() != other.Hash()) {
+            return false;
+        }
 
-        return op->Equals(otherUnaryGeneralized.GetOperand());
+        return OperandsEqual(*this, other);
     }
 
     [[nodiscard]] auto Generalize() const -> std::unique_ptr<Expression> final
     {
-        return std::make_unique<DerivedGeneralized>(*this);
+        auto generalized = std::make_unique<DerivedGeneralized>();
+        generalized->op = this->op;
+
+        return generalized;
     }
 
-    auto Generalize(tf::Subflow& subflow) const -> std::unique_ptr<Expression> final
+    auto Generalize(tf::Subflow&) const -> std::unique_ptr<Expression> final
     {
-        return DerivedGeneralized { *this }.Copy(subflow);
+        return Generalize();
     }
 
     auto GetOperand() const -> const OperandT&
@@ -74,6 +98,33 @@ public:
         return op != nullptr;
     }
 
+    [[nodiscard]] auto GetOperandCount() const -> std::size_t final
+    {
+        return 1;
+    }
+
+    [[nodiscard]] auto GetOperandAt([[maybe_unused]] std::size_t index) const -> const Expression& final
+    {
+        assert(index == 0);
+        return GetOperand();
+    }
+
+    [[nodiscard]] auto GetSharedOperandAt([[maybe_unused]] std::size_t index) const -> std::shared_ptr<Expression> final
+    {
+        assert(index == 0);
+        return op;
+    }
+
+    [[nodiscard]] auto WithOperands(std::span<const std::shared_ptr<Expression>> operands) const -> std::unique_ptr<Expression> final
+    {
+        assert(operands.size() == 1);
+
+        auto generalized = std::make_unique<DerivedGeneralized>();
+        generalized->op = operands[0];
+
+        return generalized;
+    }
+
     [[nodiscard]] auto StructurallyEquivalent(const Expression& other) const -> bool final
     {
         return this->GetType() == other.GetType();
@@ -87,22 +138,48 @@ public:
     auto SetOperand(const OperandT& operand) -> void
     {
         if constexpr (std::same_as<OperandT, Expression>) {
-            this->op = operand.Copy();
+            this->op = ExpressionArena::Share(operand.Copy());
+        } else {
+            this->op = ExpressionArena::Share(std::make_unique<OperandT>(operand));
+        }
+
+        this->Invalidate();
+    }
+
+    /**
+     * Sets the operand of this expression, taking ownership of it.
+     *
+     * The operand is only copied if it needs to be specialized to the operand type.
+     *
+     * @param operand The operand to set.
+     */
+    template <typename T>
+        requires std::derived_from<T, OperandT> || std::same_as<T, Expression>
+    auto SetOperand(std::unique_ptr<T>&& operand) -> void
+    {
+        if constexpr (!std::derived_from<T, OperandT>) {
+            auto specializedOperand = OperandT::Specialize(*operand);
+            assert(specializedOperand);
+            this->op = ExpressionArena::Share(std::move(specializedOperand));
         } else {
-            this->op = std::make_unique<OperandT>(operand);
+            this->op = ExpressionArena::Share(std::move(operand));
         }
+
+        this->Invalidate();
     }
 
     auto Substitute(const Expression& var, const Expression& val) -> std::unique_ptr<Expression> override
     {
-        std::unique_ptr<Expression> right = ((GetOperand().Copy())->Substitute(var, val));
-        DerivedT<Expression> comb = DerivedT<Expression> { *right };
-        auto ret = comb.Simplify();
-        return ret;
+        return SubstituteAll(*this, var, val);
     }
 
 protected:
-    std::unique_ptr<OperandT> op;
+    [[nodiscard]] auto ComputeHash() const -> std::size_t override
+    {
+        return CombineHash(Expression::ComputeHash(), op ? op->Hash() : 0);
+    }
+
+    std::shared_ptr<OperandT> op;
 };
 
 #define IMPL_SPECIALIZE_UNARYEXPR(DerivedT, OperandT)                                           \
@@ -117,7 +194,7 @@ protected:
         const auto& otherUnary = dynamic_cast<const DerivedT<Expression>&>(*otherGeneralized);  \
                                                                                                 \
         if (auto operand = OperandT::Specialize(otherUnary.GetOperand()); operand != nullptr) { \
-            specialized->op = std::move(operand);                                               \
+            specialized->op = ExpressionArena::Share(std::move(operand));                       \
             return specialized;                                                                 \
         }                                                                                       \
                                                                                                 \
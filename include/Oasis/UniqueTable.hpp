@@ -0,0 +1,74 @@
+#ifndef OASIS_UNIQUETABLE_HPP
+#define OASIS_UNIQUETABLE_HPP
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Expression.hpp"
+
+namespace Oasis {
+
+/**
+ * A table of unique, immutable expressions.
+ *
+ * Interning an expression through a UniqueTable returns its canonical node, a node shared by every
+ * structurally identical expression interned through the same table. Operands are interned
+ * first, so identical subtrees exist only once no matter how many times they appear. As a result,
+ * two canonical nodes from the same table are equal if they are the same node, which can be
+ * checked by comparing pointers, and copying a canonical node is constant time.
+ *
+ * Canonical nodes are generalized, and are kept alive by the table until it is cleared or
+ * destroyed. A table is safe to use from multiple threads.
+ */
+class UniqueTable {
+public:
+    UniqueTable() = default;
+    UniqueTable(const UniqueTable& other) = delete;
+
+    /**
+     * Clears the table.
+     *
+     * Canonical nodes that are still referenced elsewhere stay alive, but are no longer canonical.
+     */
+    auto Clear() -> void;
+
+    /**
+     * Gets whether an expression is a canonical node of this table.
+     *
+     * @param expression The expression to check.
+     * @return Whether the expression is a canonical node of this table.
+     */
+    [[nodiscard]] auto Contains(const Expression& expression) const -> bool;
+
+    /**
+     * Gets the number of canonical nodes in this table.
+     *
+     * @return The number of canonical nodes in this table.
+     */
+    [[nodiscard]] auto GetSize() const -> std::size_t;
+
+    /**
+     * Gets the canonical node for an expression, adding it to the table if needed.
+     *
+     * @param expression The expression to intern.
+     * @return The canonical node equivalent to the expression.
+     */
+    auto Intern(const Expression& expression) -> std::shared_ptr<Expression>;
+
+    auto operator=(const UniqueTable& other) -> UniqueTable& = delete;
+
+private:
+    static auto ShallowHash(const Expression& expression) -> std::size_t;
+
+    auto InternUnlocked(const Expression& expression) -> std::shared_ptr<Expression>;
+    auto InternNode(std::unique_ptr<Expression> candidate) -> std::shared_ptr<Expression>;
+
+    std::unordered_multimap<std::size_t, std::shared_ptr<Expression>> nodes;
+    std::unordered_map<const Expression*, std::shared_ptr<Expression>> canonical;
+    mutable std::mutex mutex;
+};
+
+} // Oasis
+
+#endif // OASIS_UNIQUETABLE_HPP
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "LeafExpression.hpp"
+#include "SymbolTable.hpp"
 
 namespace Oasis {
 
@@ -17,13 +18,16 @@ namespace Oasis {
  *
  * Variables are used to represent unknown values in an expression. Variables
  * can have names such as "x" or "y" or "x_1" and so on.
+ *
+ * The name of a variable is interned in the global SymbolTable, so that variables
+ * are compared and hashed by their symbol id rather than by their name.
  */
 class Variable : public LeafExpression<Variable> {
 public:
-    Variable() = default;
+    Variable();
     Variable(const Variable& other) = default;
 
-    explicit Variable(std::string name);
+    explicit Variable(std::string_view name);
 
     [[nodiscard]] virtual auto Equals(const Expression& other) const -> bool final;
 
@@ -35,10 +39,16 @@ public:
      *
      * @return The name of the variable.
      */
-    [[nodiscard]] auto GetName() const -> std::string;
+    [[nodiscard]] auto GetName() const -> const std::string&;
 
-    [[nodiscard]] auto ToString() const -> std::string final;
-    [[nodiscard]] auto Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression> final;
+    /**
+     * Gets the id of the variable's name in the global SymbolTable.
+     *
+     * Two variables are equal if and only if they have the same symbol.
+     *
+     * @return The symbol of the variable.
+     */
+    [[nodiscard]] auto GetSymbol() const -> SymbolTable::Id;
 
     static auto Specialize(const Expression& other) -> std::unique_ptr<Variable>;
     static auto Specialize(const Expression& other, tf::Subflow& subflow) -> std::unique_ptr<Variable>;
@@ -47,8 +57,14 @@ public:
 
     auto operator=(const Variable& other) -> Variable& = default;
 
+protected:
+    [[nodiscard]] auto ComputeString() const -> std::string final;
+    [[nodiscard]] auto ComputeHash() const -> std::size_t final;
+    [[nodiscard]] auto ComputeDerivative(const Expression& differentiationVariable, const Expression&) const -> std::unique_ptr<Expression> final;
+
 private:
-    std::string name {};
+    SymbolTable::Id symbol;
+    const std::string* name;
 };
 
 } // Oasis
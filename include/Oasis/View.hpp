@@ -0,0 +1,193 @@
+#ifndef OASIS_VIEW_HPP
+#define OASIS_VIEW_HPP
+
+#include <optional>
+
+#include "Expression.hpp"
+
+namespace Oasis {
+
+/**
+ * A borrowed, typed view of an expression.
+ *
+ * `Specialize` checks whether an expression has the shape described by a pattern type, such as
+ * `Multiply<Real, Exponent<Expression>>`, in the same way as the `Specialize` function of the pattern
+ * type does, including trying the swapped operands of commutative expressions. However, instead of
+ * copying the expression into a new, specialized expression, it returns a view that refers to the
+ * nodes of the original expression, so matching never allocates. A failed match costs nothing but
+ * the comparisons needed to reject it.
+ *
+ * A view of a leaf expression or of `Expression` itself is a reference to it. Views of binary and
+ * unary expressions expose their operands through `GetMostSigOp`, `GetLeastSigOp`, and
+ * `GetOperand`, which return references for leaf and `Expression` operands, and nested views for
+ * the others.
+ *
+ * A view is only valid as long as the expression it was specialized from.
+ *
+ * @tparam T The pattern type.
+ */
+template <IExpression T>
+class View {
+public:
+    /**
+     * Gets whether this view refers to operands through nested views.
+     */
+    static constexpr bool IsComposite = false;
+
+    /**
+     * Attempts to view an expression as the pattern type.
+     *
+     * @param other The expression to view.
+     * @return A view of the expression, or `std::nullopt` if it does not match the pattern.
+     */
+    static auto Specialize(const Expression& other) -> std::optional<View>
+    {
+        if constexpr (std::same_as<T, Expression>) {
+            return View { other };
+        } else {
+            if (!other.Is<T>()) {
+                return std::nullopt;
+            }
+
+            return View { static_cast<const T&>(other) };
+        }
+    }
+
+    /**
+     * Gets the viewed expression.
+     * @return The viewed expression.
+     */
+    [[nodiscard]] auto Get() const -> const T&
+    {
+        return *expression;
+    }
+
+private:
+    explicit View(const T& expression)
+        : expression(&expression)
+    {
+    }
+
+    const T* expression;
+};
+
+/// @cond
+template <template <IExpression, IExpression> class DerivedT, IExpression MostSigOpT, IExpression LeastSigOpT>
+class View<DerivedT<MostSigOpT, LeastSigOpT>> {
+public:
+    using MostSigOpPattern = MostSigOpT;
+    using LeastSigOpPattern = LeastSigOpT;
+
+    static constexpr bool IsComposite = true;
+
+    static auto Specialize(const Expression& other) -> std::optional<View>
+    {
+        if (other.GetType() != DerivedT<Expression, Expression>::GetStaticType()) {
+            return std::nullopt;
+        }
+
+        const Expression& mostSigOp = other.GetOperandAt(0);
+        const Expression& leastSigOp = other.GetOperandAt(1);
+
+        if (auto mostSigOpView = View<MostSigOpT>::Specialize(mostSigOp)) {
+            if (auto leastSigOpView = View<LeastSigOpT>::Specialize(leastSigOp)) {
+                return View { other, *mostSigOpView, *leastSigOpView };
+            }
+        }
+
+        if (!(other.GetCategory() & Commutative)) {
+            return std::nullopt;
+        }
+
+        if (auto mostSigOpView = View<MostSigOpT>::Specialize(leastSigOp)) {
+            if (auto leastSigOpView = View<LeastSigOpT>::Specialize(mostSigOp)) {
+                return View { other, *mostSigOpView, *leastSigOpView };
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] auto Get() const -> const Expression&
+    {
+        return *expression;
+    }
+
+    [[nodiscard]] auto GetMostSigOp() const -> decltype(auto)
+    {
+        if constexpr (View<MostSigOpT>::IsComposite) {
+            return (mostSigOp);
+        } else {
+            return mostSigOp.Get();
+        }
+    }
+
+    [[nodiscard]] auto GetLeastSigOp() const -> decltype(auto)
+    {
+        if constexpr (View<LeastSigOpT>::IsComposite) {
+            return (leastSigOp);
+        } else {
+            return leastSigOp.Get();
+        }
+    }
+
+private:
+    View(const Expression& expression, const View<MostSigOpT>& mostSigOp, const View<LeastSigOpT>& leastSigOp)
+        : expression(&expression)
+        , mostSigOp(mostSigOp)
+        , leastSigOp(leastSigOp)
+    {
+    }
+
+    const Expression* expression;
+    View<MostSigOpT> mostSigOp;
+    View<LeastSigOpT> leastSigOp;
+};
+
+template <template <IExpression> class DerivedT, IExpression OperandT>
+class View<DerivedT<OperandT>> {
+public:
+    static constexpr bool IsComposite = true;
+
+    static auto Specialize(const Expression& other) -> std::optional<View>
+    {
+        if (other.GetType() != DerivedT<Expression>::GetStaticType()) {
+            return std::nullopt;
+        }
+
+        if (auto operandView = View<OperandT>::Specialize(other.GetOperandAt(0))) {
+            return View { other, *operandView };
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] auto Get() const -> const Expression&
+    {
+        return *expression;
+    }
+
+    [[nodiscard]] auto GetOperand() const -> decltype(auto)
+    {
+        if constexpr (View<OperandT>::IsComposite) {
+            return (op);
+        } else {
+            return op.Get();
+        }
+    }
+
+private:
+    View(const Expression& expression, const View<OperandT>& op)
+        : expression(&expression)
+        , op(op)
+    {
+    }
+
+    const Expression* expression;
+    View<OperandT> op;
+};
+/// @endcond
+
+} // Oasis
+
+#endif // OASIS_VIEW_HPP
@@ -1,211 +1,245 @@
 //
 // Created by Matthew McCall on 7/2/23.
 //
+#include <algorithm>
+#include <optional>
 #include <unordered_map>
 
 #include "Oasis/Add.hpp"
+#include "Oasis/CanonicalOrder.hpp"
 #include "Oasis/Exponent.hpp"
 #include "Oasis/Imaginary.hpp"
 #include "Oasis/Log.hpp"
 #include "Oasis/Multiply.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/RuleTable.hpp"
+#include "Oasis/View.hpp"
 
 namespace Oasis {
 
-auto Add<Expression>::Simplify() const -> std::unique_ptr<Expression>
-{
-    auto simplifiedAugend = mostSigOp ? mostSigOp->Simplify() : nullptr;
-    auto simplifiedAddend = leastSigOp ? leastSigOp->Simplify() : nullptr;
+namespace {
 
-    Add simplifiedAdd { *simplifiedAugend, *simplifiedAddend };
-
-    if (auto realCase = Add<Real>::Specialize(simplifiedAdd); realCase != nullptr) {
-        const Real& firstReal = realCase->GetMostSigOp();
-        const Real& secondReal = realCase->GetLeastSigOp();
+// Rules for simplifying the sum of two simplified operands, tried in order.
+const RuleTable<Add> addRules {
+    // a + b, for real a and b
+    RuleTable<Add>::Make<Add<Real>>([](const auto& realCase) -> std::unique_ptr<Expression> {
+        const Real& firstReal = realCase.GetMostSigOp();
+        const Real& secondReal = realCase.GetLeastSigOp();
 
         return std::make_unique<Real>(firstReal.GetValue() + secondReal.GetValue());
-    }
+    }),
+    // a + b, for rational a and b, exactly
+    RuleTable<Add>::Make<Add<Rational>>([](const auto& rationalCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Rational>(rationalCase.GetMostSigOp().GetValue() + rationalCase.GetLeastSigOp().GetValue());
+    }),
+    // a + b, for rational a and real b
+    RuleTable<Add>::Make<Add<Rational, Real>>([](const auto& mixedCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Real>(mixedCase.GetMostSigOp().GetValue().ToDouble() + mixedCase.GetLeastSigOp().GetValue());
+    }),
+    // 0 + x = x
+    RuleTable<Add>::Make<Add<Rational, Expression>>([](const auto& zeroCase) -> std::unique_ptr<Expression> {
+        if (zeroCase.GetMostSigOp().GetValue().IsZero()) {
+            return zeroCase.GetLeastSigOp().Generalize();
+        }
 
-    if (auto zeroCase = Add<Real, Expression>::Specialize(simplifiedAdd); zeroCase != nullptr) {
-        if (zeroCase->GetMostSigOp().GetValue() == 0) {
-            return zeroCase->GetLeastSigOp().Generalize();
+        return nullptr;
+    }),
+    // 0 + x = x
+    RuleTable<Add>::Make<Add<Real, Expression>>([](const auto& zeroCase) -> std::unique_ptr<Expression> {
+        if (zeroCase.GetMostSigOp().GetValue() == 0) {
+            return zeroCase.GetLeastSigOp().Generalize();
         }
-    }
 
-    if (auto likeTermsCase = Add<Multiply<Real, Expression>>::Specialize(simplifiedAdd); likeTermsCase != nullptr) {
-        const Oasis::IExpression auto& leftTerm = likeTermsCase->GetMostSigOp().GetLeastSigOp();
-        const Oasis::IExpression auto& rightTerm = likeTermsCase->GetLeastSigOp().GetLeastSigOp();
+        return nullptr;
+    }),
+    // ax + bx = (a + b)x
+    RuleTable<Add>::Make<Add<Multiply<Real, Expression>>>([](const auto& likeTermsCase) -> std::unique_ptr<Expression> {
+        const Oasis::IExpression auto& leftTerm = likeTermsCase.GetMostSigOp().GetLeastSigOp();
+        const Oasis::IExpression auto& rightTerm = likeTermsCase.GetLeastSigOp().GetLeastSigOp();
 
         if (leftTerm.Equals(rightTerm)) {
-            const Real& coefficient1 = likeTermsCase->GetMostSigOp().GetMostSigOp();
-            const Real& coefficient2 = likeTermsCase->GetLeastSigOp().GetMostSigOp();
+            const Real& coefficient1 = likeTermsCase.GetMostSigOp().GetMostSigOp();
+            const Real& coefficient2 = likeTermsCase.GetLeastSigOp().GetMostSigOp();
 
             return std::make_unique<Multiply<Expression>>(Real(coefficient1.GetValue() + coefficient2.GetValue()), leftTerm);
         }
-    }
 
+        return nullptr;
+    }),
     // log(a) + log(b) = log(ab)
-    if (auto logCase = Add<Log<Expression, Expression>, Log<Expression, Expression>>::Specialize(simplifiedAdd); logCase != nullptr) {
-        if (logCase->GetMostSigOp().GetMostSigOp().Equals(logCase->GetLeastSigOp().GetMostSigOp())) {
-            const IExpression auto& base = logCase->GetMostSigOp().GetMostSigOp();
-            const IExpression auto& argument = Multiply<Expression>({ logCase->GetMostSigOp().GetLeastSigOp(), logCase->GetLeastSigOp().GetLeastSigOp() });
+    RuleTable<Add>::Make<Add<Log<Expression, Expression>, Log<Expression, Expression>>>([](const auto& logCase) -> std::unique_ptr<Expression> {
+        if (logCase.GetMostSigOp().GetMostSigOp().Equals(logCase.GetLeastSigOp().GetMostSigOp())) {
+            const IExpression auto& base = logCase.GetMostSigOp().GetMostSigOp();
+            const IExpression auto& argument = Multiply<Expression>({ logCase.GetMostSigOp().GetLeastSigOp(), logCase.GetLeastSigOp().GetLeastSigOp() });
             return std::make_unique<Log<Expression>>(base, argument);
         }
-    }
 
+        return nullptr;
+    }),
     // x + x = 2x
-    if (simplifiedAugend->Equals(*simplifiedAddend)) {
-        return Multiply<Real, Expression> { Real { 2.0 }, *simplifiedAugend }.Simplify();
-    }
+    RuleTable<Add>::Make<Add<Expression>>([](const auto& sameCase) -> std::unique_ptr<Expression> {
+        if (sameCase.GetMostSigOp().Equals(sameCase.GetLeastSigOp())) {
+            return Multiply<Real, Expression> { Real { 2.0 }, sameCase.GetMostSigOp() }.Simplify();
+        }
 
+        return nullptr;
+    }),
     // 2x + x = 3x
-    if (const auto likeTermsCase2 = Add<Multiply<Real, Expression>, Expression>::Specialize(simplifiedAdd); likeTermsCase2 != nullptr) {
-        if (likeTermsCase2->GetMostSigOp().GetLeastSigOp().Equals(likeTermsCase2->GetLeastSigOp())) {
-            const Real& coeffiecent = likeTermsCase2->GetMostSigOp().GetMostSigOp();
-            return std::make_unique<Multiply<Real, Expression>>(Real { coeffiecent.GetValue() + 1 }, likeTermsCase2->GetMostSigOp().GetLeastSigOp());
+    RuleTable<Add>::Make<Add<Multiply<Real, Expression>, Expression>>([](const auto& likeTermsCase2) -> std::unique_ptr<Expression> {
+        if (likeTermsCase2.GetMostSigOp().GetLeastSigOp().Equals(likeTermsCase2.GetLeastSigOp())) {
+            const Real& coeffiecent = likeTermsCase2.GetMostSigOp().GetMostSigOp();
+            return std::make_unique<Multiply<Real, Expression>>(Real { coeffiecent.GetValue() + 1 }, likeTermsCase2.GetMostSigOp().GetLeastSigOp());
         }
+
+        return nullptr;
+    }),
+};
+
+} // namespace
+
+auto Add<Expression>::ComputeSimplified() const -> std::unique_ptr<Expression>
+{
+    auto simplifiedAugend = mostSigOp ? mostSigOp->Simplify() : nullptr;
+    auto simplifiedAddend = leastSigOp ? leastSigOp->Simplify() : nullptr;
+
+    Add simplifiedAdd { std::move(simplifiedAugend), std::move(simplifiedAddend) };
+
+    if (auto result = addRules.Apply(simplifiedAdd)) {
+        return result;
     }
 
     // simplifies expressions and combines like terms
     // ex: 1 + 2x + 3 + 5x = 4 + 7x (or 7x + 4)
     std::vector<std::unique_ptr<Expression>> adds;
-    std::vector<std::unique_ptr<Expression>> vals;
     simplifiedAdd.Flatten(adds);
-    for (const auto& addend : adds) {
-        // real
-        size_t i = 0;
+    auto vals = CombineLikeTerms(adds);
+
+    // ax + bx = (a + b)x, when no rule has combined them
+    if (vals.size() == 1) {
+        return std::move(vals.front());
+    }
+
+    if (auto vec = BuildFromVector<Add>(std::move(vals)); vec != nullptr) {
+        return vec;
+    }
+
+    return simplifiedAdd.Copy();
+}
+
+auto Add<Expression>::CombineLikeTerms(const std::vector<std::unique_ptr<Expression>>& terms) -> std::vector<std::unique_ptr<Expression>>
+{
+    // Terms are like terms if they have equal non-coefficient parts, or bases. Terms are grouped by
+    // the hash of their base, so that each term is only compared to the terms that are likely to be
+    // like it, and the groups are emitted in the canonical order of their bases.
+    struct Group {
+        const Expression* base;
+        const Expression* first;
+        std::vector<const Expression*> coefficients; // nullptr for a coefficient of 1
+    };
+
+    std::vector<Group> groups;
+    std::unordered_map<std::size_t, std::vector<std::size_t>> groupsByHash;
+    std::optional<double> constant;
+    std::optional<Fraction> exactConstant; // the sum of the rational terms
+
+    for (const auto& addend : terms) {
         if (auto real = Real::Specialize(*addend); real != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Real::Specialize(*vals[i]); valI != nullptr) {
-                    vals[i] = Real { valI->GetValue() + real->GetValue() }.Generalize();
-                    break;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(addend->Generalize());
-            }
+            constant = constant.value_or(0.0) + real->GetValue();
             continue;
         }
-        // single i
-        if (auto img = Imaginary::Specialize(*addend); img != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Multiply<Expression, Imaginary>::Specialize(*vals[i]); valI != nullptr) {
-                    vals[i] = Multiply<Expression> { *(Add<Expression> { valI->GetMostSigOp(), Real { 1.0 } }.Simplify()), Imaginary {} }.Generalize();
-                    break;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(Multiply<Expression> { Real { 1.0 }, Imaginary {} }.Generalize());
-            }
-            continue;
-        }
-        // n*i
-        if (auto img = Multiply<Expression, Imaginary>::Specialize(*addend); img != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Multiply<Expression, Imaginary>::Specialize(*vals[i]); valI != nullptr) {
-                    vals[i] = Multiply<Expression> { *(Add<Expression> { valI->GetMostSigOp(), img->GetMostSigOp() }.Simplify()), Imaginary {} }.Generalize();
-                    break;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(img->Generalize());
-            }
+
+        if (addend->Is<Rational>()) {
+            exactConstant = exactConstant.value_or(Fraction {}) + static_cast<const Rational&>(*addend).GetValue();
             continue;
         }
-        // single variable
-        if (auto var = Variable::Specialize(*addend); var != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Multiply<Expression, Variable>::Specialize(*vals[i]); valI != nullptr) {
-                    if (valI->GetLeastSigOp().GetName() == var->GetName()) {
-                        vals[i] = Multiply<Expression> { *(Add<Expression> { valI->GetMostSigOp(), Real { 1.0 } }.Simplify()), *var }.Generalize();
-                        break;
-                    } else
-                        continue;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(Multiply<Expression> { Real { 1.0 }, *var }.Generalize());
-            }
-            continue;
+
+        const Expression* coefficient = nullptr;
+        const Expression* base = addend.get();
+
+        if (auto img = View<Multiply<Expression, Imaginary>>::Specialize(*addend)) {
+            // n*i
+            coefficient = &img->GetMostSigOp();
+            base = &img->GetLeastSigOp();
+        } else if (auto var = View<Multiply<Expression, Variable>>::Specialize(*addend)) {
+            // n*variable
+            coefficient = &var->GetMostSigOp();
+            base = &var->GetLeastSigOp();
+        } else if (auto exp = View<Multiply<Expression, Exponent<Expression>>>::Specialize(*addend)) {
+            // n*exponent
+            coefficient = &exp->GetMostSigOp();
+            base = &exp->GetLeastSigOp().Get();
         }
-        // n*variable
-        if (auto var = Multiply<Expression, Variable>::Specialize(*addend); var != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Multiply<Expression, Variable>::Specialize(*vals[i]); valI != nullptr) {
-                    if (valI->GetLeastSigOp().GetName() == var->GetLeastSigOp().GetName()) {
-                        vals[i] = Multiply<Expression> { *(Add<Expression> { valI->GetMostSigOp(), var->GetMostSigOp() }.Simplify()), valI->GetLeastSigOp() }.Generalize();
-                        break;
-                    } else
-                        continue;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(var->Generalize());
-            }
+
+        auto& candidates = groupsByHash[base->Hash()];
+        const auto like = std::ranges::find_if(candidates, [&groups, base](std::size_t i) { return groups[i].base->Equals(*base); });
+
+        if (like != candidates.end()) {
+            groups[*like].coefficients.push_back(coefficient);
             continue;
         }
-        // single exponent
-        if (auto exp = Exponent<Expression>::Specialize(*addend); exp != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Multiply<Expression, Exponent<Expression>>::Specialize(*vals[i]); valI != nullptr) {
-                    if (valI->GetLeastSigOp().Equals(*exp)) {
-                        vals[i] = Multiply<Expression> { *(Add<Expression> { valI->GetMostSigOp(), Real { 1.0 } }.Simplify()), *exp }.Generalize();
-                        break;
-                    } else
-                        continue;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(Multiply<Expression> { Real { 1.0 }, *exp }.Generalize());
-            }
+
+        candidates.push_back(groups.size());
+        groups.push_back({ base, addend.get(), { coefficient } });
+    }
+
+    std::ranges::sort(groups, [](const Group& lhs, const Group& rhs) { return CompareCanonical(*lhs.base, *rhs.base) < 0; });
+
+    std::vector<std::unique_ptr<Expression>> vals;
+    vals.reserve(groups.size() + 1);
+
+    // The constant stays exact, unless a real term makes it inexact.
+    if (constant) {
+        vals.push_back(std::make_unique<Real>(*constant + (exactConstant ? exactConstant->ToDouble() : 0.0)));
+    } else if (exactConstant) {
+        vals.push_back(std::make_unique<Rational>(*exactConstant));
+    }
+
+    for (const auto& group : groups) {
+        if (group.coefficients.size() == 1) {
+            vals.push_back(group.first->Copy());
             continue;
         }
-        // n*exponent
-        if (auto exp = Multiply<Expression, Exponent<Expression>>::Specialize(*addend); exp != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Multiply<Expression, Exponent<Expression>>::Specialize(*vals[i]); valI != nullptr) {
-                    if (valI->GetLeastSigOp().Equals(exp->GetLeastSigOp())) {
-                        vals[i] = Multiply<Expression> { *(Add<Expression> { valI->GetMostSigOp(), exp->GetMostSigOp() }.Simplify()), valI->GetLeastSigOp() }.Generalize();
-                        break;
-                    } else
-                        continue;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(exp->Generalize());
+
+        std::vector<std::unique_ptr<Expression>> coefficients;
+        coefficients.reserve(group.coefficients.size());
+
+        // An implicit coefficient of 1 is rational if another coefficient is, so that it sums exactly.
+        const bool exact = std::ranges::any_of(group.coefficients, [](const Expression* coefficient) { return coefficient && coefficient->Is<Rational>(); });
+
+        for (const Expression* coefficient : group.coefficients) {
+            if (coefficient) {
+                coefficients.push_back(coefficient->Copy());
+            } else {
+                coefficients.push_back(exact ? std::make_unique<Rational>(1, 1) : std::unique_ptr<Expression> { std::make_unique<Real>(1.0) });
             }
-            continue;
         }
+
+        vals.push_back(std::make_unique<Multiply<Expression>>(BuildFromVector<Add>(std::move(coefficients))->Simplify(), group.base->Copy()));
     }
+
     // rebuild equation after simplification.
 
     for (auto& val : vals) {
-        if (auto mul = Multiply<Real, Expression>::Specialize(*val); mul != nullptr) {
+        if (auto mul = View<Multiply<Real, Expression>>::Specialize(*val)) {
             if (mul->GetMostSigOp().GetValue() == 1.0) {
                 val = mul->GetLeastSigOp().Generalize();
             }
+        } else if (auto rationalMul = View<Multiply<Rational, Expression>>::Specialize(*val)) {
+            if (rationalMul->GetMostSigOp().GetValue() == Fraction { 1 }) {
+                val = rationalMul->GetLeastSigOp().Generalize();
+            }
         }
     }
 
-    if (auto vec = BuildFromVector<Add>(vals); vec != nullptr) {
-        return vec;
-    }
-
-    return simplifiedAdd.Copy();
+    return vals;
 }
 
-auto Add<Expression>::ToString() const -> std::string
+auto Add<Expression>::ComputeString() const -> std::string
 {
     return fmt::format("({} + {})", mostSigOp->ToString(), leastSigOp->ToString());
 }
 
-auto Add<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+auto Add<Expression>::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
 {
     std::unique_ptr<Expression> simplifiedAugend, simplifiedAddend;
 
@@ -230,11 +264,11 @@ auto Add<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Ex
     // While this task isn't actually parallelized, it exists as a prerequisite for check possible cases in parallel
     tf::Task simplifyTask = subflow.emplace([&simplifiedAdd, &simplifiedAugend, &simplifiedAddend](tf::Subflow&) {
         if (simplifiedAugend) {
-            simplifiedAdd.SetMostSigOp(*simplifiedAugend);
+            simplifiedAdd.SetMostSigOp(std::move(simplifiedAugend));
         }
 
         if (simplifiedAddend) {
-            simplifiedAdd.SetLeastSigOp(*simplifiedAddend);
+            simplifiedAdd.SetLeastSigOp(std::move(simplifiedAddend));
         }
     });
 
@@ -280,28 +314,13 @@ auto Add<Expression>::Specialize(const Expression& other, tf::Subflow& subflow)
     return std::make_unique<Add>(dynamic_cast<const Add&>(*otherGeneralized));
 }
 
-auto Add<Expression>::Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression>
+auto Add<Expression>::ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression>
 {
-    if (auto variable = Variable::Specialize(differentiationVariable); variable != nullptr) {
-        auto simplifiedAdd = this->Simplify();
-        if (auto adder = Add<Expression>::Specialize(*simplifiedAdd); adder != nullptr) {
-            auto leftRef = adder->GetLeastSigOp().Copy();
-            auto leftDifferentiate = leftRef->Differentiate(differentiationVariable);
-
-            auto specializedLeft = Expression::Specialize(*leftDifferentiate);
-            auto rightRef = adder->GetMostSigOp().Copy();
-
-            auto rightDifferentiate = rightRef->Differentiate(differentiationVariable);
-            auto specializedRight = Expression::Specialize(*rightDifferentiate);
-
-            if (specializedLeft == nullptr || specializedRight == nullptr) {
-                return Copy();
-            }
-            return std::make_unique<Add<Expression, Expression>>(Add<Expression, Expression> { *(specializedLeft->Copy()), *(specializedRight->Copy()) })->Simplify();
-        } else {
-            return simplifiedAdd->Differentiate(differentiationVariable)->Simplify();
-        }
+    // d/dx (f(x) + g(x)) = f'(x) + g'(x)
+    if (differentiationVariable.Is<Variable>()) {
+        return derivatives.Copy();
     }
+
     return Copy();
 }
 
@@ -0,0 +1,528 @@
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+#include "Oasis/BigInt.hpp"
+
+namespace Oasis {
+
+namespace {
+
+constexpr std::uint64_t LimbBase = std::uint64_t { 1 } << 32;
+
+// Multiplies a magnitude by a small factor and adds a small addend, in place.
+auto MultiplyAdd(std::vector<std::uint32_t>& limbs, std::uint32_t factor, std::uint32_t addend) -> void
+{
+    std::uint64_t carry = addend;
+
+    for (auto& limb : limbs) {
+        const std::uint64_t product = std::uint64_t { limb } * factor + carry;
+        limb = static_cast<std::uint32_t>(product);
+        carry = product >> 32;
+    }
+
+    if (carry != 0) {
+        limbs.push_back(static_cast<std::uint32_t>(carry));
+    }
+}
+
+// Divides a magnitude by a small divisor in place, returning the remainder.
+auto DivideSmall(std::vector<std::uint32_t>& limbs, std::uint32_t divisor) -> std::uint32_t
+{
+    std::uint64_t remainder = 0;
+
+    for (std::size_t i = limbs.size(); i-- > 0;) {
+        const std::uint64_t current = remainder << 32 | limbs[i];
+        limbs[i] = static_cast<std::uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+
+    while (!limbs.empty() && limbs.back() == 0) {
+        limbs.pop_back();
+    }
+
+    return static_cast<std::uint32_t>(remainder);
+}
+
+} // namespace
+
+BigInt::BigInt(std::int64_t value)
+    : negative(value < 0)
+{
+    // The magnitude of the most negative value does not fit in a std::int64_t, but does in a
+    // std::uint64_t.
+    std::uint64_t magnitude = negative ? std::uint64_t { 0 } - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+
+    while (magnitude != 0) {
+        limbs.push_back(static_cast<std::uint32_t>(magnitude));
+        magnitude >>= 32;
+    }
+}
+
+auto BigInt::FromString(std::string_view digits) -> BigInt
+{
+    BigInt result;
+    const bool isNegative = !digits.empty() && digits.front() == '-';
+
+    if (isNegative) {
+        digits.remove_prefix(1);
+    }
+
+    if (digits.empty()) {
+        throw std::invalid_argument("Expected a decimal integer.");
+    }
+
+    for (const char digit : digits) {
+        if (digit < '0' || digit > '9') {
+            throw std::invalid_argument("Expected a decimal integer.");
+        }
+
+        MultiplyAdd(result.limbs, 10, static_cast<std::uint32_t>(digit - '0'));
+    }
+
+    result.negative = isNegative;
+    result.Trim();
+    return result;
+}
+
+auto BigInt::DivRem(const BigInt& dividend, const BigInt& divisor) -> std::pair<BigInt, BigInt>
+{
+    if (divisor.IsZero()) {
+        throw std::domain_error("Division by zero.");
+    }
+
+    auto [quotientLimbs, remainderLimbs] = DivideMagnitudes(dividend.limbs, divisor.limbs);
+
+    BigInt quotient;
+    quotient.negative = dividend.negative != divisor.negative;
+    quotient.limbs = std::move(quotientLimbs);
+    quotient.Trim();
+
+    BigInt remainder;
+    remainder.negative = dividend.negative;
+    remainder.limbs = std::move(remainderLimbs);
+    remainder.Trim();
+
+    return { std::move(quotient), std::move(remainder) };
+}
+
+auto BigInt::Gcd(BigInt lhs, BigInt rhs) -> BigInt
+{
+    lhs.negative = false;
+    rhs.negative = false;
+
+    while (!rhs.IsZero()) {
+        lhs = std::move(DivRem(lhs, rhs).second);
+        std::swap(lhs, rhs);
+    }
+
+    return lhs;
+}
+
+auto BigInt::Abs() const -> BigInt
+{
+    BigInt result = *this;
+    result.negative = false;
+    return result;
+}
+
+auto BigInt::FitsInt64() const -> bool
+{
+    if (limbs.size() <= 1) {
+        return true;
+    }
+
+    if (limbs.size() > 2) {
+        return false;
+    }
+
+    // The magnitude may be at most 2^63 - 1, or 2^63 if this integer is negative.
+    const std::uint64_t magnitude = std::uint64_t { limbs[1] } << 32 | limbs[0];
+    const auto max = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+
+    return magnitude <= max || (negative && magnitude == max + 1);
+}
+
+auto BigInt::GetBitLength() const -> std::size_t
+{
+    if (limbs.empty()) {
+        return 0;
+    }
+
+    return 32 * (limbs.size() - 1) + static_cast<std::size_t>(std::bit_width(limbs.back()));
+}
+
+auto BigInt::Hash() const -> std::size_t
+{
+    std::size_t seed = negative ? 1 : 0;
+
+    for (const std::uint32_t limb : limbs) {
+        seed ^= std::hash<std::uint32_t> {}(limb) + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2);
+    }
+
+    return seed;
+}
+
+auto BigInt::IsNegative() const -> bool
+{
+    return negative;
+}
+
+auto BigInt::IsZero() const -> bool
+{
+    return limbs.empty();
+}
+
+auto BigInt::Pow(std::uint64_t exponent) const -> BigInt
+{
+    BigInt result { 1 };
+    BigInt base = *this;
+
+    while (exponent > 0) {
+        if (exponent & 1) {
+            result = result * base;
+        }
+
+        exponent >>= 1;
+
+        if (exponent > 0) {
+            base = base * base;
+        }
+    }
+
+    return result;
+}
+
+auto BigInt::ToDouble() const -> double
+{
+    const std::size_t bits = GetBitLength();
+    const auto limb = [this](std::size_t i) -> std::uint64_t { return i < limbs.size() ? limbs[i] : 0; };
+
+    if (bits <= 64) {
+        const double magnitude = static_cast<double>(limb(1) << 32 | limb(0));
+        return negative ? -magnitude : magnitude;
+    }
+
+    // The conversion of the leading 64 bits rounds them correctly, as long as the bits below them
+    // are folded into the least significant bit, which is well below the rounding bit of a double.
+    const std::size_t shift = bits - 64;
+    const std::size_t index = shift / 32;
+    const unsigned offset = shift % 32;
+
+    std::uint64_t leading = offset == 0
+        ? limb(index + 1) << 32 | limb(index)
+        : limb(index + 2) << (64 - offset) | limb(index + 1) << (32 - offset) | limb(index) >> offset;
+
+    const bool inexact = (limb(index) & ((std::uint64_t { 1 } << offset) - 1)) != 0
+        || std::any_of(limbs.begin(), limbs.begin() + static_cast<std::ptrdiff_t>(index), [](std::uint32_t lower) { return lower != 0; });
+
+    if (inexact) {
+        leading |= 1;
+    }
+
+    const double magnitude = std::ldexp(static_cast<double>(leading), static_cast<int>(std::min<std::size_t>(shift, 4096)));
+    return negative ? -magnitude : magnitude;
+}
+
+auto BigInt::ToInt64() const -> std::int64_t
+{
+    assert(FitsInt64());
+
+    std::uint64_t magnitude = 0;
+
+    for (std::size_t i = limbs.size(); i-- > 0;) {
+        magnitude = magnitude << 32 | limbs[i];
+    }
+
+    // Converting to a signed integer wraps modulo 2^64, so this is exact for the most negative value.
+    return static_cast<std::int64_t>(negative ? std::uint64_t { 0 } - magnitude : magnitude);
+}
+
+auto BigInt::ToString() const -> std::string
+{
+    if (limbs.empty()) {
+        return "0";
+    }
+
+    // Digits are peeled off nine at a time, from the least significant.
+    constexpr std::uint32_t chunk = 1'000'000'000;
+
+    Limbs remaining = limbs;
+    std::string digits;
+
+    while (!remaining.empty()) {
+        std::uint32_t part = DivideSmall(remaining, chunk);
+
+        for (int i = 0; i < 9 && (part != 0 || !remaining.empty()); ++i) {
+            digits.push_back(static_cast<char>('0' + part % 10));
+            part /= 10;
+        }
+    }
+
+    if (negative) {
+        digits.push_back('-');
+    }
+
+    std::ranges::reverse(digits);
+    return digits;
+}
+
+auto BigInt::operator+(const BigInt& other) const -> BigInt
+{
+    BigInt result;
+
+    if (negative == other.negative) {
+        result.negative = negative;
+        result.limbs = AddMagnitudes(limbs, other.limbs);
+    } else if (CompareMagnitudes(limbs, other.limbs) >= 0) {
+        result.negative = negative;
+        result.limbs = SubtractMagnitudes(limbs, other.limbs);
+    } else {
+        result.negative = other.negative;
+        result.limbs = SubtractMagnitudes(other.limbs, limbs);
+    }
+
+    result.Trim();
+    return result;
+}
+
+auto BigInt::operator-(const BigInt& other) const -> BigInt
+{
+    return *this + -other;
+}
+
+auto BigInt::operator-() const -> BigInt
+{
+    BigInt result = *this;
+    result.negative = !negative;
+    result.Trim();
+    return result;
+}
+
+auto BigInt::operator*(const BigInt& other) const -> BigInt
+{
+    BigInt result;
+    result.negative = negative != other.negative;
+    result.limbs = MultiplyMagnitudes(limbs, other.limbs);
+    result.Trim();
+    return result;
+}
+
+auto BigInt::operator/(const BigInt& other) const -> BigInt
+{
+    return DivRem(*this, other).first;
+}
+
+auto BigInt::operator%(const BigInt& other) const -> BigInt
+{
+    return DivRem(*this, other).second;
+}
+
+auto BigInt::operator<=>(const BigInt& other) const -> std::strong_ordering
+{
+    if (negative != other.negative) {
+        return negative ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+
+    const auto order = CompareMagnitudes(limbs, other.limbs);
+    return negative ? 0 <=> order : order;
+}
+
+auto BigInt::AddMagnitudes(const Limbs& lhs, const Limbs& rhs) -> Limbs
+{
+    const Limbs& longer = lhs.size() >= rhs.size() ? lhs : rhs;
+    const Limbs& shorter = lhs.size() >= rhs.size() ? rhs : lhs;
+
+    Limbs sum;
+    sum.reserve(longer.size() + 1);
+    std::uint64_t carry = 0;
+
+    for (std::size_t i = 0; i < longer.size(); ++i) {
+        const std::uint64_t digit = std::uint64_t { longer[i] } + (i < shorter.size() ? shorter[i] : 0) + carry;
+        sum.push_back(static_cast<std::uint32_t>(digit));
+        carry = digit >> 32;
+    }
+
+    if (carry != 0) {
+        sum.push_back(static_cast<std::uint32_t>(carry));
+    }
+
+    return sum;
+}
+
+auto BigInt::CompareMagnitudes(const Limbs& lhs, const Limbs& rhs) -> std::strong_ordering
+{
+    if (lhs.size() != rhs.size()) {
+        return lhs.size() <=> rhs.size();
+    }
+
+    for (std::size_t i = lhs.size(); i-- > 0;) {
+        if (lhs[i] != rhs[i]) {
+            return lhs[i] <=> rhs[i];
+        }
+    }
+
+    return std::strong_ordering::equal;
+}
+
+auto BigInt::DivideMagnitudes(const Limbs& dividend, const Limbs& divisor) -> std::pair<Limbs, Limbs>
+{
+    assert(!divisor.empty());
+
+    if (CompareMagnitudes(dividend, divisor) < 0) {
+        return { {}, dividend };
+    }
+
+    if (divisor.size() == 1) {
+        Limbs quotient = dividend;
+        const std::uint32_t remainder = DivideSmall(quotient, divisor.front());
+        return { std::move(quotient), remainder == 0 ? Limbs {} : Limbs { remainder } };
+    }
+
+    // Knuth's Algorithm D. Both operands are shifted so that the divisor's leading limb has its top
+    // bit set, which keeps each estimated quotient limb at most two more than the true limb.
+    const std::size_t n = divisor.size();
+    const std::size_t m = dividend.size() - n;
+    const int shift = std::countl_zero(divisor.back());
+
+    const auto shiftLeft = [shift](const Limbs& limbs, std::size_t size) {
+        Limbs shifted(size, 0);
+
+        for (std::size_t i = 0; i < limbs.size(); ++i) {
+            const std::uint64_t wide = std::uint64_t { limbs[i] } << shift;
+            shifted[i] |= static_cast<std::uint32_t>(wide);
+
+            if (i + 1 < size) {
+                shifted[i + 1] = static_cast<std::uint32_t>(wide >> 32);
+            }
+        }
+
+        return shifted;
+    };
+
+    const Limbs v = shiftLeft(divisor, n);
+    Limbs u = shiftLeft(dividend, dividend.size() + 1);
+    Limbs quotient(m + 1, 0);
+
+    for (std::size_t j = m + 1; j-- > 0;) {
+        const std::uint64_t numerator = std::uint64_t { u[j + n] } << 32 | u[j + n - 1];
+        std::uint64_t estimate = numerator / v[n - 1];
+        std::uint64_t remainder = numerator % v[n - 1];
+
+        while (estimate >= LimbBase || estimate * v[n - 2] > (remainder << 32 | u[j + n - 2])) {
+            --estimate;
+            remainder += v[n - 1];
+
+            if (remainder >= LimbBase) {
+                break;
+            }
+        }
+
+        // u -= estimate * v, shifted by j limbs.
+        std::int64_t borrow = 0;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::uint64_t product = estimate * v[i];
+            const std::int64_t difference = static_cast<std::int64_t>(u[i + j]) - borrow - static_cast<std::int64_t>(product & 0xFFFF'FFFF);
+            u[i + j] = static_cast<std::uint32_t>(difference);
+            borrow = static_cast<std::int64_t>(product >> 32) - (difference >> 32);
+        }
+
+        const std::int64_t top = static_cast<std::int64_t>(u[j + n]) - borrow;
+        u[j + n] = static_cast<std::uint32_t>(top);
+
+        // The estimate was one too large, so the divisor is added back.
+        if (top < 0) {
+            --estimate;
+            std::uint64_t carry = 0;
+
+            for (std::size_t i = 0; i < n; ++i) {
+                const std::uint64_t sum = std::uint64_t { u[i + j] } + v[i] + carry;
+                u[i + j] = static_cast<std::uint32_t>(sum);
+                carry = sum >> 32;
+            }
+
+            u[j + n] += static_cast<std::uint32_t>(carry);
+        }
+
+        quotient[j] = static_cast<std::uint32_t>(estimate);
+    }
+
+    // The remainder is what is left of u, shifted back.
+    Limbs remainder(n, 0);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        remainder[i] = shift == 0 ? u[i] : u[i] >> shift | u[i + 1] << (32 - shift);
+    }
+
+    while (!quotient.empty() && quotient.back() == 0) {
+        quotient.pop_back();
+    }
+
+    while (!remainder.empty() && remainder.back() == 0) {
+        remainder.pop_back();
+    }
+
+    return { std::move(quotient), std::move(remainder) };
+}
+
+auto BigInt::MultiplyMagnitudes(const Limbs& lhs, const Limbs& rhs) -> Limbs
+{
+    if (lhs.empty() || rhs.empty()) {
+        return {};
+    }
+
+    Limbs product(lhs.size() + rhs.size(), 0);
+
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        std::uint64_t carry = 0;
+
+        for (std::size_t j = 0; j < rhs.size(); ++j) {
+            const std::uint64_t digit = std::uint64_t { lhs[i] } * rhs[j] + product[i + j] + carry;
+            product[i + j] = static_cast<std::uint32_t>(digit);
+            carry = digit >> 32;
+        }
+
+        product[i + rhs.size()] = static_cast<std::uint32_t>(carry);
+    }
+
+    return product;
+}
+
+auto BigInt::SubtractMagnitudes(const Limbs& lhs, const Limbs& rhs) -> Limbs
+{
+    Limbs difference;
+    difference.reserve(lhs.size());
+    std::int64_t borrow = 0;
+
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        std::int64_t digit = static_cast<std::int64_t>(lhs[i]) - (i < rhs.size() ? rhs[i] : 0) - borrow;
+        borrow = digit < 0 ? 1 : 0;
+
+        if (digit < 0) {
+            digit += static_cast<std::int64_t>(LimbBase);
+        }
+
+        difference.push_back(static_cast<std::uint32_t>(digit));
+    }
+
+    assert(borrow == 0);
+    return difference;
+}
+
+auto BigInt::Trim() -> void
+{
+    while (!limbs.empty() && limbs.back() == 0) {
+        limbs.pop_back();
+    }
+
+    if (limbs.empty()) {
+        negative = false;
+    }
+}
+
+} // Oasis
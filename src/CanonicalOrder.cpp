@@ -0,0 +1,78 @@
+#include <utility>
+#include <vector>
+
+#include "Oasis/CanonicalOrder.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Variable.hpp"
+
+namespace {
+
+// The position of a type in the canonical order. Rational numbers are kept next to real numbers,
+// ahead of every other type, although their type was added last.
+auto GetRank(Oasis::ExpressionType type) -> std::size_t
+{
+    if (type == Oasis::ExpressionType::Rational) {
+        return 2 * static_cast<std::size_t>(Oasis::ExpressionType::Real) + 1;
+    }
+
+    return 2 * static_cast<std::size_t>(type);
+}
+
+}
+
+namespace Oasis {
+
+auto CompareCanonical(const Expression& lhs, const Expression& rhs) -> std::strong_ordering
+{
+    // Pairs of corresponding nodes are compared in pre-order, so the first pair that differs decides
+    // the order, as in a lexicographic comparison.
+    std::vector<std::pair<const Expression*, const Expression*>> stack { { &lhs, &rhs } };
+
+    while (!stack.empty()) {
+        const auto [left, right] = stack.back();
+        stack.pop_back();
+
+        if (left == right) {
+            continue;
+        }
+
+        if (const auto order = GetRank(left->GetType()) <=> GetRank(right->GetType()); order != 0) {
+            return order;
+        }
+
+        if (left->Is<Real>()) {
+            const auto order = std::strong_order(static_cast<const Real&>(*left).GetValue(), static_cast<const Real&>(*right).GetValue());
+
+            if (order != 0) {
+                return order;
+            }
+        } else if (left->Is<Rational>()) {
+            const auto order = static_cast<const Rational&>(*left).GetValue() <=> static_cast<const Rational&>(*right).GetValue();
+
+            if (order != 0) {
+                return order;
+            }
+        } else if (left->Is<Variable>()) {
+            const auto order = static_cast<const Variable&>(*left).GetName() <=> static_cast<const Variable&>(*right).GetName();
+
+            if (order != 0) {
+                return order;
+            }
+        }
+
+        const std::size_t operandCount = left->GetOperandCount();
+
+        if (const auto order = operandCount <=> right->GetOperandCount(); order != 0) {
+            return order;
+        }
+
+        for (std::size_t i = operandCount; i-- > 0;) {
+            stack.emplace_back(&left->GetOperandAt(i), &right->GetOperandAt(i));
+        }
+    }
+
+    return std::strong_ordering::equal;
+}
+
+} // Oasis
@@ -6,8 +6,15 @@
 #include "Oasis/Imaginary.hpp"
 #include "Oasis/Log.hpp"
 #include "Oasis/Multiply.hpp"
+#include "Oasis/Polynomial.hpp"
+#include "Oasis/PolynomialGcd.hpp"
+#include "Oasis/ProductNormalizer.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/RuleTable.hpp"
 #include "Oasis/Subtract.hpp"
+#include "Oasis/Traversal.hpp"
 #include "Oasis/Variable.hpp"
+#include "Oasis/View.hpp"
 #include <map>
 #include <vector>
 
@@ -18,210 +25,177 @@ Divide<Expression>::Divide(const Expression& dividend, const Expression& divisor
 {
 }
 
-auto Divide<Expression>::Simplify() const -> std::unique_ptr<Expression>
+Divide<Expression>::Divide(std::unique_ptr<Expression>&& dividend, std::unique_ptr<Expression>&& divisor)
+    : BinaryExpression(std::move(dividend), std::move(divisor))
 {
-    auto simplifiedDividend = mostSigOp->Simplify(); // numerator
-    auto simplifiedDivider = leastSigOp->Simplify(); // denominator
-    Divide simplifiedDivide { *simplifiedDividend, *simplifiedDivider };
+}
+
+namespace {
 
-    if (auto realCase = Divide<Real>::Specialize(simplifiedDivide); realCase != nullptr) {
-        const Real& dividend = realCase->GetMostSigOp();
-        const Real& divisor = realCase->GetLeastSigOp();
+// Rules for simplifying the quotient of two simplified operands, tried in order.
+const RuleTable<Divide> divideRules {
+    RuleTable<Divide>::Make<Divide<Real>>([](const auto& realCase) -> std::unique_ptr<Expression> {
+        const Real& dividend = realCase.GetMostSigOp();
+        const Real& divisor = realCase.GetLeastSigOp();
         return std::make_unique<Real>(dividend.GetValue() / divisor.GetValue());
-    }
+    }),
+    // a / b, for rational a and b, exactly
+    RuleTable<Divide>::Make<Divide<Rational>>([](const auto& rationalCase) -> std::unique_ptr<Expression> {
+        const Fraction& divisor = rationalCase.GetLeastSigOp().GetValue();
+
+        if (divisor.IsZero()) {
+            return nullptr;
+        }
 
+        return std::make_unique<Rational>(rationalCase.GetMostSigOp().GetValue() / divisor);
+    }),
+    // a / b, for rational a and real b
+    RuleTable<Divide>::Make<Divide<Rational, Real>>([](const auto& mixedCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Real>(mixedCase.GetMostSigOp().GetValue().ToDouble() / mixedCase.GetLeastSigOp().GetValue());
+    }),
+    // a / b, for real a and rational b
+    RuleTable<Divide>::Make<Divide<Real, Rational>>([](const auto& mixedCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Real>(mixedCase.GetMostSigOp().GetValue() / mixedCase.GetLeastSigOp().GetValue().ToDouble());
+    }),
     // log(a)/log(b)=log[b](a)
-    if (auto logCase = Divide<Log<Expression, Expression>, Log<Expression, Expression>>::Specialize(simplifiedDivide); logCase != nullptr) {
-        if (logCase->GetMostSigOp().GetMostSigOp().Equals(logCase->GetLeastSigOp().GetMostSigOp())) {
-            const IExpression auto& base = logCase->GetLeastSigOp().GetLeastSigOp();
-            const IExpression auto& argument = logCase->GetMostSigOp().GetLeastSigOp();
+    RuleTable<Divide>::Make<Divide<Log<Expression, Expression>, Log<Expression, Expression>>>([](const auto& logCase) -> std::unique_ptr<Expression> {
+        if (logCase.GetMostSigOp().GetMostSigOp().Equals(logCase.GetLeastSigOp().GetMostSigOp())) {
+            const IExpression auto& base = logCase.GetLeastSigOp().GetLeastSigOp();
+            const IExpression auto& argument = logCase.GetMostSigOp().GetLeastSigOp();
             return std::make_unique<Log<Expression>>(base, argument);
         }
+
+        return nullptr;
+    }),
+};
+
+// What a scan of an operand finds out before it is converted into a polynomial.
+struct PolynomialShape {
+    // Whether every node is of a kind that a polynomial can be built from.
+    bool polynomial = true;
+
+    // Whether there is a sum or a difference, without which the operand is a single term.
+    bool sum = false;
+
+    // Whether there is a rational number, so that the coefficients must stay rational.
+    bool rational = false;
+};
+
+auto ScanPolynomial(const Expression& expression) -> PolynomialShape
+{
+    PolynomialShape shape;
+
+    PreOrder(expression, [&shape](const Expression& node) {
+        switch (node.GetType()) {
+        case ExpressionType::Real:
+        case ExpressionType::Variable:
+        case ExpressionType::Negate:
+        case ExpressionType::Multiply:
+        case ExpressionType::Product:
+            break;
+        case ExpressionType::Rational:
+            shape.rational = true;
+            break;
+        case ExpressionType::Add:
+        case ExpressionType::Sum:
+        case ExpressionType::Subtract:
+            shape.sum = true;
+            break;
+        case ExpressionType::Divide:
+        case ExpressionType::Exponent:
+            shape.polynomial = shape.polynomial && (node.GetOperandAt(1).Is<Real>() || node.GetOperandAt(1).Is<Rational>());
+            break;
+        default:
+            shape.polynomial = false;
+            break;
+        }
+
+        return shape.polynomial;
+    });
+
+    return shape;
+}
+
+// Cancels the common factors of a quotient of polynomials with their greatest common divisor, or
+// returns null if they have none. Quotients of monomials are left to ProductNormalizer, and are
+// not converted into polynomials at all.
+auto CancelPolynomialFactors(const Expression& dividend, const Expression& divisor) -> std::unique_ptr<Expression>
+{
+    const PolynomialShape dividendShape = ScanPolynomial(dividend);
+    const PolynomialShape divisorShape = ScanPolynomial(divisor);
+
+    if (!dividendShape.polynomial || !divisorShape.polynomial || !(dividendShape.sum || divisorShape.sum)) {
+        return nullptr;
     }
-    // convert the terms in numerator and denominator into a vector to make manipulations easier
-    std::vector<std::unique_ptr<Expression>> numerator;
-    std::vector<std::unique_ptr<Expression>> denominator;
-    std::vector<std::unique_ptr<Expression>> result;
-    std::vector<std::unique_ptr<Expression>> numeratorVals;
-    std::vector<std::unique_ptr<Expression>> denominatorVals;
-
-    if (auto multipliedNumerator = Multiply<Expression>::Specialize(*simplifiedDividend); multipliedNumerator != nullptr) {
-        multipliedNumerator->Flatten(numerator);
-    } else {
-        numerator.push_back(simplifiedDividend->Copy());
-    }
 
-    if (auto multipliedDenominator = Multiply<Expression>::Specialize(*simplifiedDivider); multipliedDenominator != nullptr) {
-        multipliedDenominator->Flatten(denominator);
-    } else {
-        denominator.push_back(simplifiedDivider->Copy());
+    const bool rational = dividendShape.rational || divisorShape.rational;
+    const auto numerator = Polynomial::FromExpression(dividend);
+    const auto denominator = Polynomial::FromExpression(divisor);
+
+    if (!numerator || !denominator || numerator->GetDegree() < 1 || denominator->GetDegree() < 1) {
+        return nullptr;
     }
 
-    // now that we have the terms in a vector, we have to cancel like terms and simplify them
-    result.reserve(numerator.size());
-    for (const auto& num : numerator) {
-        result.push_back(num->Copy());
+    if (numerator->GetTerms().size() < 2 && denominator->GetTerms().size() < 2) {
+        return nullptr;
     }
 
-    for (const auto& denom : denominator) {
-        size_t i = 0;
-        if (auto real = Real::Specialize(*denom); real != nullptr) {
-            for (; i < result.size(); i++) {
-                if (auto resI = Real::Specialize(*result[i]); resI != nullptr) {
-                    result[i] = Real { resI->GetValue() / real->GetValue() }.Generalize();
-                    break;
-                }
-            }
-            if (i >= result.size()) {
-                result.push_back(Real { 1 / real->GetValue() }.Generalize());
-            }
-            continue;
-        }
-        if (auto img = Imaginary::Specialize(*denom); img != nullptr) {
-            for (; i < result.size(); i++) {
-                if (auto resI = Imaginary::Specialize(*result[i]); resI != nullptr) {
-                    result[i] = Real { 1.0 }.Generalize();
-                    break;
-                }
-            }
-            if (i >= result.size()) {
-                result.push_back(Exponent<Expression> { Imaginary {}, Real { -1.0 } }.Generalize());
-            }
-            continue;
-        }
-        if (auto var = Variable::Specialize(*denom); var != nullptr) {
-            for (; i < result.size(); i++) {
-                if (auto resIexp = Exponent<Variable, Expression>::Specialize(*result[i]); resIexp != nullptr) {
-                    if (resIexp->GetMostSigOp().Equals(*var)) {
-                        result[i] = Exponent<Expression> { *var, *(Subtract<Expression> { resIexp->GetLeastSigOp(), Real { 1.0 } }.Simplify()) }.Generalize();
-                        break;
-                    }
-                } else if (auto resI = Variable::Specialize(*result[i]); resI != nullptr) {
-                    if (resI->Equals(*var)) {
-                        result[i] = Real { 1.0 }.Generalize();
-                        break;
-                    }
-                }
-            }
-            if (i >= result.size()) {
-                result.push_back(Exponent<Expression> { *var, Real { -1.0 } }.Generalize());
-            }
-            continue;
-        }
-        if (auto var = Exponent<Variable, Expression>::Specialize(*denom); var != nullptr) {
-            for (; i < result.size(); i++) {
-                if (auto resIexp = Exponent<Variable, Expression>::Specialize(*result[i]); resIexp != nullptr) {
-                    if (resIexp->GetMostSigOp().Equals(var->GetMostSigOp())) {
-                        result[i] = Exponent<Expression> { var->GetMostSigOp(), *(Subtract<Expression> { resIexp->GetLeastSigOp(), var->GetLeastSigOp() }.Simplify()) }.Generalize();
-                        break;
-                    }
-                } else if (auto resI = Variable::Specialize(*result[i]); resI != nullptr) {
-                    if (resI->Equals(*var)) {
-                        result[i] = Exponent<Expression> { var->GetMostSigOp(), *(Subtract<Expression> { Real { 1.0 }, var->GetLeastSigOp() }.Simplify()) }.Generalize();
-                    }
-                }
-            }
-            if (i >= result.size()) {
-                result.push_back(Exponent<Expression> { var->GetMostSigOp(), Multiply { Real { -1.0 }, var->GetLeastSigOp() } }.Generalize());
-            }
-            continue;
-        }
-        if (auto expExpr = Exponent<Expression>::Specialize(*denom); expExpr != nullptr) {
-            for (; i < result.size(); i++) {
-                if (auto resExpr = Exponent<Expression, Expression>::Specialize(*result[i]); resExpr != nullptr) {
-                    if (expExpr->GetMostSigOp().Equals(resExpr->GetMostSigOp())) {
-                        result[i] = Exponent { expExpr->GetMostSigOp(), *(Subtract { resExpr->GetLeastSigOp(), expExpr->GetLeastSigOp() }.Simplify()) }.Generalize();
-                        break;
-                    }
-                } else if (result[i]->Equals(expExpr->GetMostSigOp())) {
-                    result[i] = Exponent { expExpr->GetMostSigOp(), *(Subtract { Real { 1.0 }, resExpr->GetLeastSigOp() }.Simplify()) }.Generalize();
-                    break;
-                }
-            }
-            if (i >= result.size()) {
-                result.push_back(Exponent<Expression> { expExpr->GetMostSigOp(), Multiply { Real { -1.0 }, expExpr->GetLeastSigOp() } }.Generalize());
-            }
-            continue;
-        }
-        for (; i < result.size(); i++) {
-            if (auto resExpr = Exponent<Expression, Expression>::Specialize(*result[i]); resExpr != nullptr) {
-                if (denom->Equals(resExpr->GetMostSigOp())) {
-                    result[i] = Exponent { *denom, *(Subtract { resExpr->GetLeastSigOp(), Real { 1.0 } }.Simplify()) }.Generalize();
-                    break;
-                }
-            } else if (result[i]->Equals(*denom)) {
-                result[i] = Real { 1.0 }.Generalize();
-                break;
-            }
-        }
-        if (i >= result.size()) {
-            result.push_back(Exponent<Expression> { *denom, Real { -1.0 } }.Generalize());
+    // A divisor of the dividend in the same single variable is cancelled by long division, which is
+    // much cheaper than finding the greatest common divisor.
+    if (numerator->GetVariables().size() == 1 && numerator->GetVariables() == denominator->GetVariables() && denominator->GetDegree() <= numerator->GetDegree()) {
+        if (auto [quotient, remainder] = Polynomial::DivRem(*numerator, *denominator); remainder.IsZero()) {
+            return quotient.ToExpression(rational);
         }
     }
 
-    // rebuild into tree
-    for (const auto& val : result) {
-        if (auto valI = Real::Specialize(*val); valI != nullptr) {
-            if (valI->GetValue() != 1.0) {
-                numeratorVals.push_back(valI->Generalize());
-            }
-        } else if (auto var = Variable::Specialize(*val); var != nullptr) {
-            numeratorVals.push_back(val->Generalize());
-        } else if (auto img = Imaginary::Specialize(*val); img != nullptr) {
-            numeratorVals.push_back(val->Generalize());
-        } else if (auto expR = Exponent<Expression, Real>::Specialize(*val); expR != nullptr) {
-            if (expR->GetLeastSigOp().GetValue() < 0.0) {
-                denominatorVals.push_back(Exponent { expR->GetMostSigOp(), Real { expR->GetLeastSigOp().GetValue() * -1.0 } }.Generalize());
-            } else {
-                numeratorVals.push_back(val->Generalize());
-            }
-        } else if (auto exp = Exponent<Expression, Multiply<Real, Expression>>::Specialize(*val); exp != nullptr) {
-            if (exp->GetLeastSigOp().GetMostSigOp().GetValue() < 0.0) {
-                denominatorVals.push_back(Exponent { exp->GetMostSigOp(), exp->GetLeastSigOp().GetLeastSigOp() }.Generalize());
-            } else {
-                numeratorVals.push_back(val->Generalize());
-            }
-        } else {
-            numeratorVals.push_back(val->Generalize());
-        }
+    auto reduced = CancelCommonFactors(*numerator, *denominator);
+
+    if (!reduced) {
+        return nullptr;
     }
 
-    // makes expr^1 into expr
-    for (auto& val : numeratorVals) {
-        if (auto exp = Exponent<Expression, Real>::Specialize(*val); exp != nullptr) {
-            if (exp->GetLeastSigOp().GetValue() == 1.0) {
-                val = exp->GetMostSigOp().Generalize();
-            }
-        }
+    if (reduced->second.GetDegree() == 0) {
+        return reduced->first.ToExpression(rational);
     }
 
-    for (auto& val : denominatorVals) {
-        if (auto exp = Exponent<Expression, Real>::Specialize(*val); exp != nullptr) {
-            if (exp->GetLeastSigOp().GetValue() == 1.0) {
-                val = exp->GetMostSigOp().Generalize();
-            }
-        }
+    return Divide<Expression> { *reduced->first.ToExpression(rational), *reduced->second.ToExpression(rational) }.Simplify();
+}
+
+} // namespace
+
+auto Divide<Expression>::ComputeSimplified() const -> std::unique_ptr<Expression>
+{
+    auto simplifiedDividend = mostSigOp->Simplify(); // numerator
+    auto simplifiedDivider = leastSigOp->Simplify(); // denominator
+    Divide simplifiedDivide { std::move(simplifiedDividend), std::move(simplifiedDivider) };
+
+    if (auto result = divideRules.Apply(simplifiedDivide)) {
+        return result;
     }
 
-    auto dividend = numeratorVals.size() == 1 ? std::move(numeratorVals.front()) : BuildFromVector<Multiply>(numeratorVals);
-    auto divisor = denominatorVals.size() == 1 ? std::move(denominatorVals.front()) : BuildFromVector<Multiply>(denominatorVals);
+    // cancels like factors, such as (a*x^n)/(b*x^m) = (a/b)*x^(n-m), however many factors there are
+    ProductNormalizer normalizer;
+    normalizer.MultiplyBy(simplifiedDivide.GetMostSigOp());
+    normalizer.DivideBy(simplifiedDivide.GetLeastSigOp());
 
-    // rebuild subtrees
-    if (!dividend && divisor)
-        return Divide { Real { 1.0 }, *divisor }.Copy();
+    auto quotient = normalizer.BuildQuotient();
 
-    if (dividend && !divisor)
-        return dividend;
+    // cancels common factors that are not written alike, such as (x^2 - 1)/(x - 1) = x + 1
+    if (quotient->Is<Oasis::Divide>()) {
+        if (auto result = CancelPolynomialFactors(quotient->GetOperandAt(0), quotient->GetOperandAt(1))) {
+            return result;
+        }
+    }
 
-    return Divide { *dividend, *divisor }.Copy();
+    return quotient;
 }
 
-auto Divide<Expression>::ToString() const -> std::string
+auto Divide<Expression>::ComputeString() const -> std::string
 {
     return fmt::format("({} / {})", mostSigOp->ToString(), leastSigOp->ToString());
 }
 
-auto Divide<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+auto Divide<Expression>::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
 {
     std::unique_ptr<Expression> simplifiedDividend, simplifiedDivisor;
 
@@ -246,11 +220,11 @@ auto Divide<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_ptr
     // While this task isn't actually parallelized, it exists as a prerequisite for check possible cases in parallel
     tf::Task simplifyTask = subflow.emplace([&simplifiedDivide, &simplifiedDividend, &simplifiedDivisor](tf::Subflow&) {
         if (simplifiedDividend) {
-            simplifiedDivide.SetMostSigOp(*simplifiedDividend);
+            simplifiedDivide.SetMostSigOp(std::move(simplifiedDividend));
         }
 
         if (simplifiedDivisor) {
-            simplifiedDivide.SetLeastSigOp(*simplifiedDivisor);
+            simplifiedDivide.SetLeastSigOp(std::move(simplifiedDivisor));
         }
     });
 
@@ -296,45 +270,24 @@ auto Divide<Expression>::Specialize(const Expression& other, tf::Subflow& subflo
     return std::make_unique<Divide>(dynamic_cast<const Divide&>(*otherGeneralized));
 }
 
-auto Divide<Expression>::Differentiate(const Oasis::Expression& differentiationVariable) -> std::unique_ptr<Expression>
+auto Divide<Expression>::ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression>
 {
     // Single differentiation variable
-    if (auto variable = Variable::Specialize(differentiationVariable); variable != nullptr) {
-        auto simplifiedDiv = this->Simplify();
-
-        // Constant case - differentiation over a divisor
-        if (auto constant = Divide<Expression, Real>::Specialize(*simplifiedDiv); constant != nullptr) {
-            auto exp = constant->GetMostSigOp().Copy();
-            auto num = constant->GetLeastSigOp();
-            auto differentiate = (*exp).Differentiate(differentiationVariable);
-            if (auto add = Expression::Specialize(*differentiate); add != nullptr) {
-                return std::make_unique<Divide<Expression, Real>>(Divide<Expression, Real> { *(add->Simplify()), Real { num.GetValue() } })->Simplify();
-            }
-        }
-        // In case of simplify turning divide into mult
-        if (auto constant = Multiply<Expression, Real>::Specialize(*simplifiedDiv); constant != nullptr) {
-            auto exp = constant->GetMostSigOp().Copy();
-            auto num = constant->GetLeastSigOp();
-            auto differentiate = (*exp).Differentiate(differentiationVariable);
-            if (auto add = Expression::Specialize(*differentiate); add != nullptr) {
-                return std::make_unique<Multiply<Expression, Real>>(Multiply<Expression, Real> { *(add->Simplify()), Real { num.GetValue() } })->Simplify();
-            }
-        }
-        // Quotient Rule: d/dx (f(x)/g(x)) = (g(x)f'(x)-f(x)g'(x))/(g(x)^2)
-        if (auto quotient = Divide<Expression, Expression>::Specialize(*simplifiedDiv); quotient != nullptr) {
-            auto leftexp = quotient->GetMostSigOp().Copy();
-            auto rightexp = quotient->GetLeastSigOp().Copy();
-            auto leftDiff = leftexp->Differentiate(differentiationVariable);
-            auto rightDiff = rightexp->Differentiate(differentiationVariable);
-            auto mult1 = Multiply<Expression, Expression>(Multiply<Expression, Expression> { *(rightexp->Simplify()), *(leftDiff->Simplify()) }).Simplify()->Simplify();
-            auto mult2 = Multiply<Expression, Expression>(Multiply<Expression, Expression> { *(leftexp->Simplify()), *(rightDiff->Simplify()) }).Simplify()->Simplify();
-            auto numerator = Subtract<Expression, Expression>(Subtract<Expression, Expression> { *mult1, *mult2 }).Simplify();
-            auto denominator = Multiply<Expression, Expression>(Multiply<Expression, Expression> { *(rightexp->Simplify()), *(rightexp->Simplify()) }).Simplify();
-            return Divide<Expression, Expression>({ *(numerator->Simplify()), *(denominator->Simplify()) }).Simplify();
-        }
+    if (!differentiationVariable.Is<Variable>()) {
+        return Copy();
+    }
+
+    // Constant case - differentiation over a divisor
+    if (View<Divide<Expression, Real>>::Specialize(*this)) {
+        return std::make_unique<Divide<Expression>>(derivatives.GetOperandAt(0).Copy(), GetLeastSigOp().Copy());
     }
 
-    return Copy();
+    // Quotient Rule: d/dx (f(x)/g(x)) = (g(x)f'(x)-f(x)g'(x))/(g(x)^2)
+    auto numerator = std::make_unique<Subtract<Expression>>(
+        std::make_unique<Multiply<Expression>>(GetLeastSigOp().Copy(), derivatives.GetOperandAt(0).Copy()),
+        std::make_unique<Multiply<Expression>>(GetMostSigOp().Copy(), derivatives.GetOperandAt(1).Copy()));
+    auto denominator = std::make_unique<Multiply<Expression>>(GetLeastSigOp().Copy(), GetLeastSigOp().Copy());
+    return std::make_unique<Divide<Expression>>(std::move(numerator), std::move(denominator));
 }
 
 } // Oasis
\ No newline at end of file
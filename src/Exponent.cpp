@@ -6,6 +6,9 @@
 #include "Oasis/Imaginary.hpp"
 #include "Oasis/Log.hpp"
 #include "Oasis/Multiply.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/RuleTable.hpp"
+#include "Oasis/View.hpp"
 #include <cmath>
 
 namespace Oasis {
@@ -15,52 +18,100 @@ Exponent<Expression>::Exponent(const Expression& base, const Expression& power)
 {
 }
 
-auto Exponent<Expression>::Simplify() const -> std::unique_ptr<Expression>
+Exponent<Expression>::Exponent(std::unique_ptr<Expression>&& base, std::unique_ptr<Expression>&& power)
+    : BinaryExpression(std::move(base), std::move(power))
 {
-    auto simplifiedBase = mostSigOp->Simplify();
-    auto simplifiedPower = leastSigOp->Simplify();
+}
 
-    Exponent simplifiedExponent { *simplifiedBase, *simplifiedPower };
+namespace {
+
+// The most bits an exact power of a rational may have, beyond which it is left unfolded.
+constexpr std::size_t MaxExactPowerBits = std::size_t { 1 } << 20;
+
+// Rules for simplifying a simplified base raised to a simplified power, tried in order.
+const RuleTable<Exponent> exponentRules {
+    // a^n, for rational a and integer n, exactly
+    RuleTable<Exponent>::Make<Exponent<Rational>>([](const auto& rationalCase) -> std::unique_ptr<Expression> {
+        const Fraction& base = rationalCase.GetMostSigOp().GetValue();
+        const Fraction& power = rationalCase.GetLeastSigOp().GetValue();
 
-    if (auto zeroCase = Exponent<Expression, Real>::Specialize(simplifiedExponent); zeroCase != nullptr) {
-        const Real& power = zeroCase->GetLeastSigOp();
+        if (!power.IsInteger() || !power.GetNumerator().FitsInt64()) {
+            return nullptr;
+        }
+
+        const std::int64_t exponent = power.GetNumerator().ToInt64();
+        const BigInt magnitude = power.GetNumerator().Abs();
+        const std::size_t baseBits = base.GetNumerator().GetBitLength() + base.GetDenominator().GetBitLength();
+
+        if ((exponent < 0 && base.IsZero()) || (baseBits > 2 && BigInt { static_cast<std::int64_t>(MaxExactPowerBits / baseBits) } < magnitude)) {
+            return nullptr;
+        }
+
+        return std::make_unique<Rational>(base.Pow(exponent));
+    }),
+    // a^b, for rational a and real b, or real a and rational b
+    RuleTable<Exponent>::Make<Exponent<Rational, Real>>([](const auto& mixedCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Real>(pow(mixedCase.GetMostSigOp().GetValue().ToDouble(), mixedCase.GetLeastSigOp().GetValue()));
+    }),
+    RuleTable<Exponent>::Make<Exponent<Real, Rational>>([](const auto& mixedCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Real>(pow(mixedCase.GetMostSigOp().GetValue(), mixedCase.GetLeastSigOp().GetValue().ToDouble()));
+    }),
+    // x^0 = 1 and x^1 = x
+    RuleTable<Exponent>::Make<Exponent<Expression, Rational>>([](const auto& zeroOneCase) -> std::unique_ptr<Expression> {
+        const Fraction& power = zeroOneCase.GetLeastSigOp().GetValue();
+
+        if (power.IsZero()) {
+            return std::make_unique<Rational>(1, 1);
+        }
+
+        if (power == Fraction { 1 }) {
+            return zeroOneCase.GetMostSigOp().Copy();
+        }
+
+        return nullptr;
+    }),
+    RuleTable<Exponent>::Make<Exponent<Expression, Real>>([](const auto& zeroCase) -> std::unique_ptr<Expression> {
+        const Real& power = zeroCase.GetLeastSigOp();
 
         if (power.GetValue() == 0.0) {
             return std::make_unique<Real>(1.0);
         }
-    }
 
-    if (auto zeroCase = Exponent<Real, Expression>::Specialize(simplifiedExponent); zeroCase != nullptr) {
-        const Real& base = zeroCase->GetMostSigOp();
+        return nullptr;
+    }),
+    RuleTable<Exponent>::Make<Exponent<Real, Expression>>([](const auto& zeroCase) -> std::unique_ptr<Expression> {
+        const Real& base = zeroCase.GetMostSigOp();
 
         if (base.GetValue() == 0.0) {
             return std::make_unique<Real>(0.0);
         }
-    }
 
-    if (auto realCase = Exponent<Real>::Specialize(simplifiedExponent); realCase != nullptr) {
-        const Real& base = realCase->GetMostSigOp();
-        const Real& power = realCase->GetLeastSigOp();
+        return nullptr;
+    }),
+    RuleTable<Exponent>::Make<Exponent<Real>>([](const auto& realCase) -> std::unique_ptr<Expression> {
+        const Real& base = realCase.GetMostSigOp();
+        const Real& power = realCase.GetLeastSigOp();
 
         return std::make_unique<Real>(pow(base.GetValue(), power.GetValue()));
-    }
-
-    if (auto oneCase = Exponent<Expression, Real>::Specialize(simplifiedExponent); oneCase != nullptr) {
-        const Real& power = oneCase->GetLeastSigOp();
+    }),
+    RuleTable<Exponent>::Make<Exponent<Expression, Real>>([](const auto& oneCase) -> std::unique_ptr<Expression> {
+        const Real& power = oneCase.GetLeastSigOp();
         if (power.GetValue() == 1.0) {
-            return oneCase->GetMostSigOp().Copy();
+            return oneCase.GetMostSigOp().Copy();
         }
-    }
 
-    if (auto oneCase = Exponent<Real, Expression>::Specialize(simplifiedExponent); oneCase != nullptr) {
-        const Real& base = oneCase->GetMostSigOp();
+        return nullptr;
+    }),
+    RuleTable<Exponent>::Make<Exponent<Real, Expression>>([](const auto& oneCase) -> std::unique_ptr<Expression> {
+        const Real& base = oneCase.GetMostSigOp();
         if (base.GetValue() == 1.0) {
             return std::make_unique<Real>(1.0);
         }
-    }
 
-    if (auto ImgCase = Exponent<Imaginary, Real>::Specialize(simplifiedExponent); ImgCase != nullptr) {
-        const auto power = std::fmod((ImgCase->GetLeastSigOp()).GetValue(), 4);
+        return nullptr;
+    }),
+    RuleTable<Exponent>::Make<Exponent<Imaginary, Real>>([](const auto& ImgCase) -> std::unique_ptr<Expression> {
+        const auto power = std::fmod((ImgCase.GetLeastSigOp()).GetValue(), 4);
         if (power == 1) {
             return std::make_unique<Imaginary>();
         } else if (power == 2) {
@@ -70,38 +121,55 @@ auto Exponent<Expression>::Simplify() const -> std::unique_ptr<Expression>
         } else if (power == 3) {
             return std::make_unique<Multiply<Real, Imaginary>>(Real { -1 }, Imaginary {});
         }
-    }
 
-    if (auto ImgCase = Exponent<Multiply<Real, Expression>, Real>::Specialize(simplifiedExponent); ImgCase != nullptr) {
-        if (ImgCase->GetMostSigOp().GetMostSigOp().GetValue() < 0 && ImgCase->GetLeastSigOp().GetValue() == 0.5) {
+        return nullptr;
+    }),
+    RuleTable<Exponent>::Make<Exponent<Multiply<Real, Expression>, Real>>([](const auto& ImgCase) -> std::unique_ptr<Expression> {
+        if (ImgCase.GetMostSigOp().GetMostSigOp().GetValue() < 0 && ImgCase.GetLeastSigOp().GetValue() == 0.5) {
             return std::make_unique<Multiply<Expression>>(
-                Multiply<Expression> { Real { pow(std::abs(ImgCase->GetMostSigOp().GetMostSigOp().GetValue()), 0.5) },
-                    Exponent<Expression> { ImgCase->GetMostSigOp().GetLeastSigOp(), Real { 0.5 } } },
+                Multiply<Expression> { Real { pow(std::abs(ImgCase.GetMostSigOp().GetMostSigOp().GetValue()), 0.5) },
+                    Exponent<Expression> { ImgCase.GetMostSigOp().GetLeastSigOp(), Real { 0.5 } } },
                 Imaginary {});
         }
-    }
-
-    if (auto expExpCase = Exponent<Exponent<Expression, Expression>, Expression>::Specialize(simplifiedExponent); expExpCase != nullptr) {
-        return std::make_unique<Exponent<Expression>>(expExpCase->GetMostSigOp().GetMostSigOp(),
-            *(Multiply { expExpCase->GetMostSigOp().GetLeastSigOp(), expExpCase->GetLeastSigOp() }.Simplify()));
-    }
 
+        return nullptr;
+    }),
+    RuleTable<Exponent>::Make<Exponent<Exponent<Expression, Expression>, Expression>>([](const auto& expExpCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Exponent<Expression>>(expExpCase.GetMostSigOp().GetMostSigOp(),
+            *(Multiply { expExpCase.GetMostSigOp().GetLeastSigOp(), expExpCase.GetLeastSigOp() }.Simplify()));
+    }),
     // a^log[a](x) = x - maybe add domain stuff (should only be defined for x >= 0)
-    if (auto logCase = Exponent<Expression, Log<Expression, Expression>>::Specialize(simplifiedExponent); logCase != nullptr) {
-        if (logCase->GetMostSigOp().Equals(logCase->GetLeastSigOp().GetMostSigOp())) {
-            return Expression::Specialize(logCase->GetLeastSigOp().GetLeastSigOp());
+    RuleTable<Exponent>::Make<Exponent<Expression, Log<Expression, Expression>>>([](const auto& logCase) -> std::unique_ptr<Expression> {
+        if (logCase.GetMostSigOp().Equals(logCase.GetLeastSigOp().GetMostSigOp())) {
+            return Expression::Specialize(logCase.GetLeastSigOp().GetLeastSigOp());
         }
+
+        return nullptr;
+    }),
+};
+
+} // namespace
+
+auto Exponent<Expression>::ComputeSimplified() const -> std::unique_ptr<Expression>
+{
+    auto simplifiedBase = mostSigOp->Simplify();
+    auto simplifiedPower = leastSigOp->Simplify();
+
+    Exponent simplifiedExponent { *simplifiedBase, *simplifiedPower };
+
+    if (auto result = exponentRules.Apply(simplifiedExponent)) {
+        return result;
     }
 
     return simplifiedExponent.Copy();
 }
 
-auto Exponent<Expression>::ToString() const -> std::string
+auto Exponent<Expression>::ComputeString() const -> std::string
 {
     return fmt::format("({}^{})", mostSigOp->ToString(), leastSigOp->ToString());
 }
 
-auto Exponent<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+auto Exponent<Expression>::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
 {
     std::unique_ptr<Expression> simplifiedBase, simplifiedPower;
 
@@ -164,22 +232,19 @@ auto Exponent<Expression>::Specialize(const Oasis::Expression& other) -> std::un
     return std::make_unique<Exponent>(dynamic_cast<const Exponent&>(*otherGeneralized));
 }
 
-auto Exponent<Expression>::Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression>
+auto Exponent<Expression>::ComputeDerivative(const Expression& differentiationVariable, const Expression&) const -> std::unique_ptr<Expression>
 {
     // variable diff
     if (auto variable = Variable::Specialize(differentiationVariable); variable != nullptr) {
-        auto simplifiedExponent = this->Simplify();
-
-        std::unique_ptr<Expression> diff;
         // Variable with a constant power
-        if (auto realExponent = Exponent<Variable, Real>::Specialize(*simplifiedExponent); realExponent != nullptr) {
+        if (auto realExponent = View<Exponent<Variable, Real>>::Specialize(*this)) {
             const Variable& expBase = realExponent->GetMostSigOp();
             const Real& expPow = realExponent->GetLeastSigOp();
 
-            if ((*variable).GetName() == expBase.GetName()) {
-                return Multiply<Expression, Expression> { Exponent<Variable, Real> { Variable { (*variable).GetName() }, Real { expPow.GetValue() - 1 } },
-                    Real { expPow.GetValue() } }
-                    .Simplify();
+            if (variable->GetSymbol() == expBase.GetSymbol()) {
+                return std::make_unique<Multiply<Expression>>(
+                    std::make_unique<Exponent<Expression>>(expBase.Copy(), std::make_unique<Real>(expPow.GetValue() - 1)),
+                    std::make_unique<Real>(expPow.GetValue()));
             }
         }
     }
@@ -0,0 +1,108 @@
+#include <cassert>
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Expr.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Subtract.hpp"
+
+namespace Oasis {
+
+Expr::Expr(const Expression& expression)
+    : expression(expression.Copy())
+{
+}
+
+Expr::Expr(std::unique_ptr<Expression>&& expression)
+    : expression(std::move(expression))
+{
+    assert(this->expression != nullptr);
+}
+
+Expr::Expr(std::shared_ptr<Expression> expression)
+    : expression(std::move(expression))
+{
+    assert(this->expression != nullptr);
+}
+
+auto Expr::Differentiate(const Expr& variable) const -> Expr
+{
+    return Expr { expression->Differentiate(*variable.expression) };
+}
+
+auto Expr::Equals(const Expr& other) const -> bool
+{
+    return expression == other.expression || expression->Equals(*other.expression);
+}
+
+auto Expr::Get() const -> const Expression&
+{
+    return *expression;
+}
+
+auto Expr::GetOperand(std::size_t index) const -> Expr
+{
+    return Expr { expression->GetSharedOperandAt(index) };
+}
+
+auto Expr::GetOperandCount() const -> std::size_t
+{
+    return expression->GetOperandCount();
+}
+
+auto Expr::Hash() const -> std::size_t
+{
+    return expression->Hash();
+}
+
+auto Expr::Simplify() const -> Expr
+{
+    return Expr { Expression::SimplifyShared(*expression, expression) };
+}
+
+auto Expr::Substitute(const Expr& var, const Expr& val) const -> Expr
+{
+    return Expr { Expression::SubstituteShared(*expression, expression, *var.expression, *val.expression) };
+}
+
+auto Expr::ToString() const -> std::string
+{
+    return expression->ToString();
+}
+
+auto Expr::operator*() const -> const Expression&
+{
+    return *expression;
+}
+
+auto Expr::operator->() const -> const Expression*
+{
+    return expression.get();
+}
+
+auto Expr::operator==(const Expr& other) const -> bool
+{
+    return Equals(other);
+}
+
+auto operator+(const Expr& lhs, const Expr& rhs) -> Expr
+{
+    return Add { *lhs, *rhs }.Simplify();
+}
+
+auto operator-(const Expr& lhs, const Expr& rhs) -> Expr
+{
+    return Subtract { *lhs, *rhs }.Simplify();
+}
+
+auto operator*(const Expr& lhs, const Expr& rhs) -> Expr
+{
+    return Multiply { *lhs, *rhs }.Simplify();
+}
+
+auto operator/(const Expr& lhs, const Expr& rhs) -> Expr
+{
+    return Divide { *lhs, *rhs }.Simplify();
+}
+
+} // Oasis
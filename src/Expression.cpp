@@ -5,227 +5,735 @@
 #include <Oasis/Add.hpp>
 #include <Oasis/Divide.hpp>
 #include <Oasis/Exponent.hpp>
+#include <Oasis/ExpressionArena.hpp>
+#include <Oasis/FactorTable.hpp>
+#include <Oasis/IntegerPolynomial.hpp>
 #include <Oasis/Multiply.hpp>
+#include <Oasis/Polynomial.hpp>
+#include <Oasis/PolynomialEvaluate.hpp>
+#include <Oasis/PolynomialRoots.hpp>
+#include <Oasis/Rational.hpp>
+#include <Oasis/RealRoots.hpp>
+#include <Oasis/SimplifyCache.hpp>
 #include <Oasis/Subtract.hpp>
+#include <Oasis/Traversal.hpp>
 #include <Oasis/Variable.hpp>
 
-std::vector<long long> getAllFactors(long long n)
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+// The strings of operands converted ahead of their parents by Expression::ToString.
+thread_local std::unordered_map<const Oasis::Expression*, std::string>* operandStrings = nullptr;
+
+// The operands queued for destruction by Expression::ReleaseOperand.
+thread_local std::vector<std::shared_ptr<Oasis::Expression>>* pendingOperands = nullptr;
+
+} // namespace
+
+namespace Oasis {
+
+namespace {
+
+// Candidate zeros are screened modulo primes below 2^32, so that products of residues fit in 64
+// bits, before they are tested exactly.
+constexpr std::array<std::uint64_t, 2> ScreeningPrimes { 4294967291, 4294967279 };
+
+auto GetResidues(const std::vector<BigInt>& coefficients, std::uint64_t prime) -> std::vector<std::uint64_t>
 {
-    std::vector<long long> answer;
-    for (long long i = 1; i * i <= n; i++) {
-        if (n % i == 0) {
-            answer.push_back(i);
-        }
+    std::vector<std::uint64_t> residues;
+    residues.reserve(coefficients.size());
+
+    for (const BigInt& coefficient : coefficients) {
+        const std::int64_t residue = (coefficient % BigInt { static_cast<std::int64_t>(prime) }).ToInt64();
+        residues.push_back(static_cast<std::uint64_t>(residue < 0 ? residue + static_cast<std::int64_t>(prime) : residue));
     }
-    if (std::abs(n) != 1) {
-        answer.push_back(std::abs(n));
+
+    return residues;
+}
+
+// Evaluates q^n f(p/q) modulo a prime by Horner's method, as EvaluateDense does exactly, from the
+// residues of the coefficients of f.
+auto EvaluateModulo(const std::vector<std::uint64_t>& residues, std::uint64_t numerator, bool negative, std::uint64_t denominator, std::uint64_t prime) -> std::uint64_t
+{
+    const std::uint64_t p = negative ? (prime - numerator % prime) % prime : numerator % prime;
+    const std::uint64_t q = denominator % prime;
+    std::uint64_t value = 0;
+    std::uint64_t scale = 1;
+
+    for (std::size_t i = residues.size(); i-- > 0;) {
+        value = (value * p % prime + residues[i] * scale % prime) % prime;
+        scale = scale * q % prime;
     }
-    return answer;
+
+    return value;
 }
 
-long long gcf(long long a, long long b)
+// Finds the rational zeros of a square-free polynomial with integer coefficients, given from its
+// constant term up, by the rational root test, dividing each one out of the polynomial. Each zero
+// is returned as a numerator and a positive denominator.
+auto FindRationalZeros(std::vector<BigInt>& coefficients) -> std::vector<std::pair<long long, long long>>
 {
-    if (b > a) {
-        std::swap(a, b);
+    std::vector<std::pair<long long, long long>> zeros;
+
+    // A square-free polynomial has at most one factor of x.
+    if (coefficients.size() > 1 && coefficients.front().IsZero()) {
+        zeros.emplace_back(0, 1);
+        coefficients.erase(coefficients.begin());
     }
-    while (1) {
-        a %= b;
-        if (a == 0) {
-            return b;
+
+    // Candidates are only enumerated for leading and constant coefficients small enough to factor.
+    if (coefficients.size() <= 1 || !coefficients.front().Abs().FitsInt64() || !coefficients.back().Abs().FitsInt64()) {
+        return zeros;
+    }
+
+    const auto numerators = FactorTable::Global().GetDivisors(static_cast<std::uint64_t>(coefficients.front().Abs().ToInt64()));
+    const auto denominators = FactorTable::Global().GetDivisors(static_cast<std::uint64_t>(coefficients.back().Abs().ToInt64()));
+
+    std::array<std::vector<std::uint64_t>, ScreeningPrimes.size()> residues;
+    const auto updateResidues = [&residues, &coefficients] {
+        for (std::size_t i = 0; i < ScreeningPrimes.size(); ++i) {
+            residues[i] = GetResidues(coefficients, ScreeningPrimes[i]);
         }
-        b %= a;
-        if (b == 0) {
-            return a;
+    };
+    updateResidues();
+
+    for (const std::uint64_t pv : numerators) {
+        for (const std::uint64_t qv : denominators) {
+            if (std::gcd(pv, qv) != 1) {
+                continue;
+            }
+
+            for (const bool negative : { true, false }) {
+                if (coefficients.size() <= 1) {
+                    return zeros;
+                }
+
+                // A zero of f makes q^n f(p/q) vanish modulo every prime, so most candidates are
+                // rejected without leaving 64-bit arithmetic.
+                bool screened = true;
+
+                for (std::size_t i = 0; i < ScreeningPrimes.size() && screened; ++i) {
+                    screened = EvaluateModulo(residues[i], pv, negative, qv, ScreeningPrimes[i]) == 0;
+                }
+
+                if (!screened) {
+                    continue;
+                }
+
+                const BigInt numerator { negative ? -static_cast<std::int64_t>(pv) : static_cast<std::int64_t>(pv) };
+                const BigInt denominator { static_cast<std::int64_t>(qv) };
+
+                if (!EvaluateDense(coefficients, numerator, denominator).IsZero()) {
+                    continue;
+                }
+
+                coefficients = DivideDenseExact(coefficients, std::vector { -numerator, denominator });
+                updateResidues();
+                zeros.emplace_back(numerator.ToInt64(), denominator.ToInt64());
+            }
         }
     }
+
+    return zeros;
 }
 
-namespace Oasis {
+// Scales the coefficients of a polynomial by the least common multiple of their denominators, which
+// leaves its zeros unchanged, so that they become integers.
+auto ScaleToIntegers(const std::vector<Fraction>& fractions) -> std::vector<BigInt>
+{
+    BigInt scale { 1 };
+    for (const Fraction& coefficient : fractions) {
+        const BigInt denominator = coefficient.GetDenominator();
+        scale = scale / BigInt::Gcd(scale, denominator) * denominator;
+    }
+
+    std::vector<BigInt> integers;
+    integers.reserve(fractions.size());
+    for (const Fraction& coefficient : fractions) {
+        integers.push_back(coefficient.GetNumerator() * (scale / coefficient.GetDenominator()));
+    }
+
+    return integers;
+}
+
+// Finds the zeros of a linear or quadratic polynomial, given from its constant term up, by formula.
+auto FindLowDegreeZeros(const std::vector<std::unique_ptr<Expression>>& coefficents, std::size_t multiplicity, std::vector<std::pair<std::unique_ptr<Expression>, std::size_t>>& results) -> void
+{
+    if (coefficents.size() == 2) {
+        results.emplace_back(Divide(Multiply(Real(-1), *coefficents[0]), *coefficents[1]).Simplify(), multiplicity);
+    } else if (coefficents.size() == 3) {
+        auto& a = coefficents[2];
+        auto& b = coefficents[1];
+        auto& c = coefficents[0];
+        auto negB = Multiply(Real(-1.0), *b).Simplify();
+        auto sqrt = Exponent(*Add(Multiply(*b, *b), Multiply(Real(-4), Multiply(*a, *c))).Simplify(), Divide(Real(1), Real(2))).Copy();
+        auto twoA = Multiply(Real(2), *a).Simplify();
+        results.emplace_back(Divide(Add(*negB, *sqrt), *twoA).Copy(), multiplicity);
+        results.emplace_back(Divide(Subtract(*negB, *sqrt), *twoA).Copy(), multiplicity);
+    }
+}
+
+} // namespace
+
+auto Expression::Expand() const -> std::unique_ptr<Expression>
+{
+    // Marks the nodes that are polynomials, bottom up, so that only the largest of them are
+    // converted.
+    std::unordered_set<const Expression*> polynomials;
+    std::vector<bool> isPolynomial;
+
+    // Whether each node visited so far is a polynomial, so that shared operands are visited once.
+    std::unordered_map<const Expression*, bool> visited;
+
+    PostOrder(
+        *this,
+        [&visited, &isPolynomial](const Expression& node) {
+            if (auto it = visited.find(&node); it != visited.end()) {
+                isPolynomial.push_back(it->second);
+                return false;
+            }
+
+            return true;
+        },
+        [&polynomials, &isPolynomial, &visited](const Expression& node) {
+            const std::size_t operandCount = node.GetOperandCount();
+            const auto operands = isPolynomial.end() - static_cast<std::ptrdiff_t>(operandCount);
+            const bool operandsArePolynomials = std::all_of(operands, isPolynomial.end(), [](bool operand) { return operand; });
+
+            bool result = false;
+
+            switch (node.GetType()) {
+            case ExpressionType::Real:
+            case ExpressionType::Rational:
+            case ExpressionType::Variable:
+                result = true;
+                break;
+            case ExpressionType::Add:
+            case ExpressionType::Subtract:
+            case ExpressionType::Multiply:
+            case ExpressionType::Negate:
+            case ExpressionType::Sum:
+            case ExpressionType::Product:
+                result = operandsArePolynomials;
+                break;
+            case ExpressionType::Divide:
+                result = operandsArePolynomials && (node.GetOperandAt(1).Is<Real>() || node.GetOperandAt(1).Is<Rational>());
+                break;
+            case ExpressionType::Exponent:
+                if (node.GetOperandAt(1).Is<Real>()) {
+                    const double exponent = static_cast<const Real&>(node.GetOperandAt(1)).GetValue();
+                    result = operands[0] && exponent >= 0.0 && exponent == std::trunc(exponent);
+                } else if (node.GetOperandAt(1).Is<Rational>()) {
+                    const Fraction& exponent = static_cast<const Rational&>(node.GetOperandAt(1)).GetValue();
+                    result = operands[0] && !exponent.IsNegative() && exponent.IsInteger();
+                }
+                break;
+            default:
+                break;
+            }
+
+            isPolynomial.erase(operands, isPolynomial.end());
+            isPolynomial.push_back(result);
+            visited.emplace(&node, result);
+
+            if (result && operandCount > 0) {
+                polynomials.insert(&node);
+            }
+        });
+
+    return Transform(
+        *this,
+        [&polynomials](const Expression& node, const std::shared_ptr<Expression>&) -> std::shared_ptr<Expression> {
+            if (!polynomials.contains(&node)) {
+                return nullptr;
+            }
+
+            // A quotient by zero is not a polynomial, so its operands are expanded instead.
+            const auto polynomial = Polynomial::FromExpression(node);
+
+            if (!polynomial) {
+                return nullptr;
+            }
+
+            bool rational = false;
+
+            PreOrder(node, [&rational](const Expression& leaf) {
+                rational = rational || leaf.Is<Rational>();
+                return !rational;
+            });
+
+            return ExpressionArena::Share(polynomial->ToExpression(rational));
+        },
+        [](const Expression&, const std::shared_ptr<Expression>& rebuilt) { return rebuilt; })
+        ->Copy();
+}
 
-// currently only supports polynomials of one variable.
-/**
- * The FindZeros function finds all rational zeros of a polynomial. Currently assumes an expression of the form a+bx+cx^2+dx^3+... where a, b, c, d are a integers.
- *
- * @tparam origonalExpresion The expression for which all the factors will be found.
- */
 auto Expression::FindZeros() const -> std::vector<std::unique_ptr<Expression>>
 {
     std::vector<std::unique_ptr<Expression>> results;
-    std::vector<std::unique_ptr<Expression>> termsE;
-    if (auto addCase = Add<Expression>::Specialize(*this); addCase != nullptr) {
-        addCase->Flatten(termsE);
+
+    for (auto& [zero, multiplicity] : FindZerosWithMultiplicity()) {
+        results.push_back(std::move(zero));
+    }
+
+    return results;
+}
+
+auto Expression::FindZerosWithMultiplicity() const -> std::vector<std::pair<std::unique_ptr<Expression>, std::size_t>>
+{
+    std::vector<std::pair<std::unique_ptr<Expression>, std::size_t>> results;
+    std::vector<std::unique_ptr<Expression>> coefficents;
+
+    // A polynomial in one variable is expanded straight into its coefficients, scaled to integers.
+    // Other expressions, such as those with negative powers or imaginary coefficients, are matched
+    // term by term.
+    if (const auto polynomial = Polynomial::FromExpression(*this); polynomial && polynomial->GetVariables().size() == 1) {
+        for (const BigInt& coefficient : ScaleToIntegers(polynomial->GetDenseFractions())) {
+            coefficents.push_back(std::make_unique<Rational>(Fraction { coefficient, BigInt { 1 } }));
+        }
     } else {
-        termsE.push_back(Copy());
-    }
-    std::string varName = "";
-    std::vector<std::unique_ptr<Expression>> posCoefficents;
-    std::vector<std::unique_ptr<Expression>> negCoefficents;
-    for (const auto& i : termsE) {
-        std::unique_ptr<Expression> coefficent;
-        std::string variableName;
-        double exponent;
-        if (auto variableCase = Variable::Specialize(*i); variableCase != nullptr) {
-            coefficent = Real(1).Copy();
-            variableName = variableCase->GetName();
-            exponent = 1;
-        } else if (auto expCase = Exponent<Variable, Real>::Specialize(*i); expCase != nullptr) {
-            coefficent = Real(1).Copy();
-            variableName = expCase->GetMostSigOp().GetName();
-            exponent = expCase->GetLeastSigOp().GetValue();
-        } else if (auto prodCase = Multiply<Expression, Variable>::Specialize(*i); prodCase != nullptr) {
-            coefficent = prodCase->GetMostSigOp().Copy();
-            variableName = prodCase->GetLeastSigOp().GetName();
-            exponent = 1;
-        } else if (auto prodExpCase = Multiply<Expression, Exponent<Variable, Real>>::Specialize(*i); prodExpCase != nullptr) {
-            coefficent = prodExpCase->GetMostSigOp().Copy();
-            variableName = prodExpCase->GetLeastSigOp().GetMostSigOp().GetName();
-            exponent = prodExpCase->GetLeastSigOp().GetLeastSigOp().GetValue();
-        } else if (auto divCase = Divide<Expression, Variable>::Specialize(*i); divCase != nullptr) {
-            coefficent = divCase->GetMostSigOp().Copy();
-            variableName = divCase->GetLeastSigOp().GetName();
-            exponent = -1;
-        } else if (auto divExpCase = Divide<Expression, Exponent<Variable, Real>>::Specialize(*i); divExpCase != nullptr) {
-            coefficent = divExpCase->GetMostSigOp().Copy();
-            variableName = divExpCase->GetLeastSigOp().GetMostSigOp().GetName();
-            exponent = -divExpCase->GetLeastSigOp().GetLeastSigOp().GetValue();
+        std::vector<std::unique_ptr<Expression>> termsE;
+        if (auto addCase = Add<Expression>::Specialize(*this); addCase != nullptr) {
+            addCase->Flatten(termsE);
         } else {
-            coefficent = i->Copy();
-            variableName = varName;
-            exponent = 0;
-        }
-        if (varName == "") {
-            varName = variableName;
-        }
-        if (exponent != round(exponent) || varName != variableName) {
-            return {};
+            termsE.push_back(Copy());
         }
-        if (exponent >= 0) {
-            while (posCoefficents.size() <= exponent) {
-                posCoefficents.push_back(Real(0).Copy());
+        std::string varName = "";
+        std::vector<std::unique_ptr<Expression>> posCoefficents;
+        std::vector<std::unique_ptr<Expression>> negCoefficents;
+        for (const auto& i : termsE) {
+            std::unique_ptr<Expression> coefficent;
+            std::string variableName;
+            double exponent;
+            if (auto variableCase = Variable::Specialize(*i); variableCase != nullptr) {
+                coefficent = Real(1).Copy();
+                variableName = variableCase->GetName();
+                exponent = 1;
+            } else if (auto expCase = Exponent<Variable, Real>::Specialize(*i); expCase != nullptr) {
+                coefficent = Real(1).Copy();
+                variableName = expCase->GetMostSigOp().GetName();
+                exponent = expCase->GetLeastSigOp().GetValue();
+            } else if (auto prodCase = Multiply<Expression, Variable>::Specialize(*i); prodCase != nullptr) {
+                coefficent = prodCase->GetMostSigOp().Copy();
+                variableName = prodCase->GetLeastSigOp().GetName();
+                exponent = 1;
+            } else if (auto prodExpCase = Multiply<Expression, Exponent<Variable, Real>>::Specialize(*i); prodExpCase != nullptr) {
+                coefficent = prodExpCase->GetMostSigOp().Copy();
+                variableName = prodExpCase->GetLeastSigOp().GetMostSigOp().GetName();
+                exponent = prodExpCase->GetLeastSigOp().GetLeastSigOp().GetValue();
+            } else if (auto divCase = Divide<Expression, Variable>::Specialize(*i); divCase != nullptr) {
+                coefficent = divCase->GetMostSigOp().Copy();
+                variableName = divCase->GetLeastSigOp().GetName();
+                exponent = -1;
+            } else if (auto divExpCase = Divide<Expression, Exponent<Variable, Real>>::Specialize(*i); divExpCase != nullptr) {
+                coefficent = divExpCase->GetMostSigOp().Copy();
+                variableName = divExpCase->GetLeastSigOp().GetMostSigOp().GetName();
+                exponent = -divExpCase->GetLeastSigOp().GetLeastSigOp().GetValue();
+            } else {
+                coefficent = i->Copy();
+                variableName = varName;
+                exponent = 0;
             }
-            posCoefficents[lround(exponent)] = Add<Expression>(*coefficent, *posCoefficents[lround(exponent)]).Copy();
-        } else {
-            exponent *= -1;
-            while (negCoefficents.size() <= exponent) {
-                negCoefficents.push_back(Real(0).Copy());
+            if (varName == "") {
+                varName = variableName;
+            }
+            if (exponent != round(exponent) || varName != variableName) {
+                return {};
+            }
+            if (exponent >= 0) {
+                while (posCoefficents.size() <= exponent) {
+                    posCoefficents.push_back(Real(0).Copy());
+                }
+                posCoefficents[lround(exponent)] = Add<Expression>(*coefficent, *posCoefficents[lround(exponent)]).Copy();
+            } else {
+                exponent *= -1;
+                while (negCoefficents.size() <= exponent) {
+                    negCoefficents.push_back(Real(0).Copy());
+                }
+                negCoefficents[lround(exponent)] = Add<Expression>(*coefficent, *negCoefficents[lround(exponent)]).Copy();
             }
-            negCoefficents[lround(exponent)] = Add<Expression>(*coefficent, *negCoefficents[lround(exponent)]).Copy();
         }
-    }
-    while (negCoefficents.size() > 0 && Real::Specialize(*negCoefficents.back()) != nullptr && Real::Specialize(*negCoefficents.back())->GetValue() == 0) {
-        negCoefficents.pop_back();
-    }
-    while (posCoefficents.size() > 0 && Real::Specialize(*posCoefficents.back()) != nullptr && Real::Specialize(*posCoefficents.back())->GetValue() == 0) {
-        posCoefficents.pop_back();
-    }
-    std::vector<std::unique_ptr<Expression>> coefficents;
-    for (size_t i = negCoefficents.size(); i > 1; i--) {
-        coefficents.push_back(negCoefficents[i - 1]->Simplify());
-    }
-    for (const std::unique_ptr<Expression>& i : posCoefficents) {
-        coefficents.push_back(i->Simplify());
+        while (negCoefficents.size() > 0 && Real::Specialize(*negCoefficents.back()) != nullptr && Real::Specialize(*negCoefficents.back())->GetValue() == 0) {
+            negCoefficents.pop_back();
+        }
+        while (posCoefficents.size() > 0 && Real::Specialize(*posCoefficents.back()) != nullptr && Real::Specialize(*posCoefficents.back())->GetValue() == 0) {
+            posCoefficents.pop_back();
+        }
+        for (size_t i = negCoefficents.size(); i > 1; i--) {
+            coefficents.push_back(negCoefficents[i - 1]->Simplify());
+        }
+        for (const std::unique_ptr<Expression>& i : posCoefficents) {
+            coefficents.push_back(i->Simplify());
+        }
     }
     if (coefficents.size() <= 1) {
         return {};
     }
-    std::vector<long long> termsC;
+    // The coefficients are converted exactly, so that the arithmetic below cannot overflow, however
+    // large they or their intermediate values are.
+    std::vector<BigInt> termsC;
     for (auto& i : coefficents) {
-        auto realCase = Real::Specialize(*i);
-        if (realCase == nullptr) {
-            break;
+        std::optional<Fraction> value;
+        if (auto realCase = Real::Specialize(*i); realCase != nullptr && std::isfinite(realCase->GetValue())) {
+            value = Fraction::FromDouble(realCase->GetValue());
+        } else if (auto rationalCase = Rational::Specialize(*i); rationalCase != nullptr) {
+            value = rationalCase->GetValue();
         }
-        double value = realCase->GetValue();
-        if (value != round(value)) {
+        if (!value || !value->IsInteger()) {
             break;
         } else {
-            termsC.push_back(lround(value));
+            termsC.push_back(value->GetNumerator());
         }
     }
-    if (termsC.size() == coefficents.size()) {
-        std::reverse(termsC.begin(), termsC.end());
-        for (auto pv : getAllFactors(termsC.back())) {
-            for (auto qv : getAllFactors(termsC.front())) {
-                if (gcf(pv, qv) == 1) {
-                    for (long long sign : { -1, 1 }) {
-                        bool doAdd = true;
-                        while (true) {
-                            long long mpv = pv * sign;
-                            std::vector<long long> newTermsC;
-                            long long h = 0;
-                            for (long long i : termsC) {
-                                h *= mpv;
-                                if (h % qv != 0) {
-                                    break;
-                                }
-                                h /= qv;
-                                h += i;
-                                newTermsC.push_back(h);
-                            }
-                            if (newTermsC.size() == termsC.size() && newTermsC.back() == 0) {
-                                termsC = newTermsC;
-                                if (doAdd) {
-                                    results.push_back(std::make_unique<Divide<Real>>(Real(1.0 * mpv), Real(1.0 * qv)));
-                                    doAdd = false;
-                                }
-                                do {
-                                    termsC.pop_back();
-                                    std::cout << mpv << "/" << qv << '\n';
-                                } while (termsC.back() == 0);
-                                if (termsC.size() <= 1) {
-                                    break;
-                                }
-                            } else {
-                                break;
-                            }
-                        }
-                    }
-                }
-                if (termsC.size() <= 1) {
-                    break;
-                }
-            }
-            if (termsC.size() <= 1) {
-                break;
-            }
+    if (termsC.size() != coefficents.size()) {
+        FindLowDegreeZeros(coefficents, 1, results);
+        return results;
+    }
+    // Each zero of a square-free factor is simple, so each candidate is tested once per factor
+    // instead of once per repetition, and the index of the factor gives the multiplicity.
+    const auto factors = SquareFreeDecomposition(termsC);
+    for (std::size_t i = 0; i < factors.size(); ++i) {
+        std::vector<BigInt> factor = factors[i];
+        for (const auto& [numerator, denominator] : FindRationalZeros(factor)) {
+            results.emplace_back(std::make_unique<Divide<Real>>(Real(1.0 * numerator), Real(1.0 * denominator)), i + 1);
         }
-        coefficents.clear();
-        std::reverse(termsC.begin(), termsC.end());
-        std::cout << termsC.size() << '\n';
-        for (auto i : termsC) {
-            coefficents.push_back(Real(i * 1.0).Copy());
+        std::vector<std::unique_ptr<Expression>> remaining;
+        for (const auto& coefficient : factor) {
+            remaining.push_back(Real(coefficient.ToDouble()).Copy());
         }
+        FindLowDegreeZeros(remaining, i + 1, results);
     }
-    std::cout << coefficents.size() << '\n';
-    if (coefficents.size() == 2) {
-        results.push_back(Divide(Multiply(Real(-1), *coefficents[0]), *coefficents[1]).Simplify());
-    } else if (coefficents.size() == 3) {
-        std::cout << "hi\n";
-        auto& a = coefficents[2];
-        auto& b = coefficents[1];
-        auto& c = coefficents[0];
-        auto negB = Multiply(Real(-1.0), *b).Simplify();
-        auto sqrt = Exponent(*Add(Multiply(*b, *b), Multiply(Real(-4), Multiply(*a, *c))).Simplify(), Divide(Real(1), Real(2))).Copy();
-        auto twoA = Multiply(Real(2), *a).Simplify();
-        results.push_back(Divide(Add(*negB, *sqrt), *twoA).Copy());
-        results.push_back(Divide(Subtract(*negB, *sqrt), *twoA).Copy());
-    }
-    std::cout << results.size() << '\n';
     return results;
 }
 
+auto Expression::FindZerosNumeric(double tolerance, bool polish) const -> std::vector<std::complex<double>>
+{
+    const auto polynomial = Polynomial::FromExpression(*this);
+
+    if (!polynomial || polynomial->GetVariables().size() != 1) {
+        return {};
+    }
+
+    const std::vector<double> coefficients = polynomial->GetDenseCoefficients();
+
+    if (std::ranges::all_of(coefficients, [](double coefficient) { return coefficient == 0.0; })) {
+        return {};
+    }
+
+    return FindRoots(coefficients, tolerance, polish);
+}
+
+auto Expression::FindRealZeros(double lower, double upper, double tolerance) const -> std::vector<double>
+{
+    const auto polynomial = Polynomial::FromExpression(*this);
+
+    if (!polynomial || polynomial->GetVariables().size() != 1) {
+        return {};
+    }
+
+    // The zeros are isolated from the exact coefficients, since rounding them to doubles can move,
+    // merge, or split zeros. Only the isolated zeros are rounded.
+    const std::vector<BigInt> coefficients = ScaleToIntegers(polynomial->GetDenseFractions());
+
+    if (std::ranges::all_of(coefficients, [](const BigInt& coefficient) { return coefficient.IsZero(); })) {
+        return {};
+    }
+
+    return FindRealRoots(coefficients, lower, upper, tolerance);
+}
+
+auto Expression::EvaluateAt(std::span<const double> points) const -> std::optional<std::vector<double>>
+{
+    const auto polynomial = Polynomial::FromExpression(*this);
+
+    if (!polynomial || polynomial->GetVariables().size() > 1) {
+        return std::nullopt;
+    }
+
+    return EvaluateMultipoint(polynomial->GetDenseCoefficients(), points);
+}
+
+Expression::Expression()
+    : arenaAllocated(ExpressionArena::ClaimExpression(this))
+{
+}
+
+Expression::Expression(const Expression& other)
+    : hash(other.hash.load(std::memory_order_relaxed))
+    , simplified(other.simplified.load(std::memory_order_relaxed))
+    , arenaAllocated(ExpressionArena::ClaimExpression(this))
+{
+}
+
+auto Expression::operator=(const Expression& other) -> Expression&
+{
+    hash.store(other.hash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    simplified.store(other.simplified.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
 auto Expression::GetCategory() const -> uint32_t
 {
     return 0;
 }
-auto Expression::Differentiate(const Expression&) -> std::unique_ptr<Expression>
+auto Expression::Differentiate(const Expression& differentiationVariable) const -> std::unique_ptr<Expression>
+{
+    // The rules match simplified expressions, so the whole expression is simplified once up front
+    // rather than once per node. Each node then finds the derivatives of its operands in the node
+    // rebuilt from them, and the derivative is simplified once at the end.
+    const auto simplified = SimplifyShared(*this, nullptr);
+
+    return Transform(
+        *simplified,
+        simplified,
+        [](const Expression&, const std::shared_ptr<Expression>&) -> std::shared_ptr<Expression> {
+            return nullptr;
+        },
+        [&differentiationVariable](const Expression& node, const std::shared_ptr<Expression>& derivatives) -> std::shared_ptr<Expression> {
+            return ExpressionArena::Share(node.ComputeDerivative(differentiationVariable, *derivatives));
+        })
+        ->Simplify();
+}
+
+auto Expression::ComputeDerivative(const Expression&, const Expression&) const -> std::unique_ptr<Expression>
 {
     return Copy();
 }
+
+auto Expression::DifferentiateNode(const Expression& node, const Expression& differentiationVariable, const Expression& derivatives) -> std::unique_ptr<Expression>
+{
+    return node.ComputeDerivative(differentiationVariable, derivatives);
+}
 auto Expression::GetType() const -> ExpressionType
 {
     return ExpressionType::None;
 }
 
+auto Expression::Hash() const -> std::size_t
+{
+    // A hash of zero marks the hash as not yet computed. Racing threads compute the same value, so
+    // storing it without synchronization is harmless.
+    if (const auto cached = hash.load(std::memory_order_relaxed); cached != 0) {
+        return cached;
+    }
+
+    // Operands are hashed first, so that computing the hash of a node never recurses into them.
+    PostOrder(
+        *this,
+        [](const Expression& node) {
+            return node.hash.load(std::memory_order_relaxed) == 0;
+        },
+        [](const Expression& node) {
+            const auto computed = node.ComputeHash();
+            node.hash.store(computed == 0 ? 1 : computed, std::memory_order_relaxed);
+        });
+
+    return hash.load(std::memory_order_relaxed);
+}
+
+auto Expression::IsSimplified() const -> bool
+{
+    return simplified.load(std::memory_order_relaxed);
+}
+
+auto Expression::ComputeHash() const -> std::size_t
+{
+    return MixHash(static_cast<std::size_t>(GetType()) + 1);
+}
+
+auto Expression::Invalidate() -> void
+{
+    hash.store(0, std::memory_order_relaxed);
+    simplified.store(false, std::memory_order_relaxed);
+}
+
+auto Expression::SubstituteAll(const Expression& expression, const Expression& var, const Expression& val) -> std::unique_ptr<Expression>
+{
+    return SubstituteShared(expression, nullptr, var, val)->Copy();
+}
+
+auto Expression::SubstituteShared(const Expression& expression, const std::shared_ptr<Expression>& owner, const Expression& var, const Expression& val) -> std::shared_ptr<Expression>
+{
+    return Transform(
+        expression,
+        owner,
+        [](const Expression&, const std::shared_ptr<Expression>&) -> std::shared_ptr<Expression> {
+            return nullptr;
+        },
+        [&var, &val](const Expression& node, const std::shared_ptr<Expression>& rebuilt) -> std::shared_ptr<Expression> {
+            if (node.GetOperandCount() == 0) {
+                if (!node.Is<Variable>()) {
+                    return rebuilt;
+                }
+
+                // Variable::Substitute reports substituting for something other than a variable.
+                if (!var.Is<Variable>()) {
+                    return rebuilt->Substitute(var, val);
+                }
+
+                return node.Equals(var) ? ExpressionArena::Share(val.Copy()) : rebuilt;
+            }
+
+            return SimplifyShared(*rebuilt, rebuilt);
+        });
+}
+
+auto Expression::ReleaseOperand(std::shared_ptr<Expression> operand) -> void
+{
+    if (!operand || operand.use_count() > 1 || operand->GetOperandCount() == 0) {
+        return;
+    }
+
+    // Destroying an operand destroys its own operands in turn, which would recurse once per level
+    // of the expression. Instead, operands are queued and destroyed one at a time by the outermost
+    // call.
+    if (pendingOperands != nullptr) {
+        pendingOperands->push_back(std::move(operand));
+        return;
+    }
+
+    std::vector<std::shared_ptr<Expression>> pending { std::move(operand) };
+    pendingOperands = &pending;
+
+    while (!pending.empty()) {
+        auto next = std::move(pending.back());
+        pending.pop_back();
+        next.reset();
+    }
+
+    pendingOperands = nullptr;
+}
+
+auto Expression::CombineHash(std::size_t seed, std::size_t value) -> std::size_t
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+}
+
+auto Expression::OperandsEqual(const Expression& lhs, const Expression& rhs) -> bool
+{
+    std::vector<std::pair<const Expression*, const Expression*>> stack { { &lhs, &rhs } };
+
+    while (!stack.empty()) {
+        const auto [left, right] = stack.back();
+        stack.pop_back();
+
+        if (left->GetOperandCount() != right->GetOperandCount()) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < left->GetOperandCount(); ++i) {
+            const Expression& leftOperand = left->GetOperandAt(i);
+            const Expression& rightOperand = right->GetOperandAt(i);
+
+            if (&leftOperand == &rightOperand) {
+                continue;
+            }
+
+            if (leftOperand.GetType() != rightOperand.GetType() || leftOperand.Hash() != rightOperand.Hash()) {
+                return false;
+            }
+
+            if (leftOperand.GetOperandCount() == 0 || (leftOperand.GetCategory() & Associative)) {
+                if (!leftOperand.Equals(rightOperand)) {
+                    return false;
+                }
+
+                continue;
+            }
+
+            stack.emplace_back(&leftOperand, &rightOperand);
+        }
+    }
+
+    return true;
+}
+
+auto Expression::TermsEqual(std::span<const Expression* const> lhs, std::span<const Expression* const> rhs, bool commutative) -> bool
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+
+    const auto termsEqual = [](const Expression& left, const Expression& right) {
+        return &left == &right || (left.Hash() == right.Hash() && left.Equals(right));
+    };
+
+    // The terms that differ from the term of the other expression in the same position.
+    std::vector<const Expression*> unmatchedLeft, unmatchedRight;
+
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        if (!termsEqual(*lhs[i], *rhs[i])) {
+            unmatchedLeft.push_back(lhs[i]);
+            unmatchedRight.push_back(rhs[i]);
+        }
+    }
+
+    if (unmatchedLeft.empty()) {
+        return true;
+    }
+
+    if (!commutative) {
+        return false;
+    }
+
+    // Each term of the other expression may only be matched once, so that repeated terms are
+    // counted.
+    std::vector<bool> matched(unmatchedRight.size(), false);
+
+    for (const Expression* left : unmatchedLeft) {
+        bool found = false;
+
+        for (std::size_t i = 0; i < unmatchedRight.size(); ++i) {
+            if (!matched[i] && termsEqual(*left, *unmatchedRight[i])) {
+                matched[i] = found = true;
+                break;
+            }
+        }
+
+        if (!found) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto Expression::MixHash(std::size_t value) -> std::size_t
+{
+    // The SplitMix64 finalizer.
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+}
+
+auto Expression::GetOperandCount() const -> std::size_t
+{
+    return 0;
+}
+
+auto Expression::GetOperandAt(std::size_t) const -> const Expression&
+{
+    throw std::out_of_range("Expression has no operands.");
+}
+
+auto Expression::GetSharedOperandAt(std::size_t) const -> std::shared_ptr<Expression>
+{
+    throw std::out_of_range("Expression has no operands.");
+}
+
+auto Expression::WithOperands(std::span<const std::shared_ptr<Expression>>) const -> std::unique_ptr<Expression>
+{
+    return Copy();
+}
+
 auto Expression::Generalize() const -> std::unique_ptr<Expression>
 {
     return Copy();
@@ -248,14 +756,131 @@ auto Expression::Specialize(const Expression& other, tf::Subflow& subflow) -> st
 
 auto Expression::Simplify() const -> std::unique_ptr<Expression>
 {
-    return Copy();
+    if (IsSimplified()) {
+        return Copy();
+    }
+
+    return SimplifyShared(*this, nullptr)->Copy();
 }
 
 auto Expression::Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+{
+    if (IsSimplified()) {
+        return Copy(subflow);
+    }
+
+    SimplifyCache* cache = SimplifyCache::IsCacheable(*this) ? SimplifyCache::GetCurrent() : nullptr;
+
+    if (cache != nullptr) {
+        if (auto cached = cache->Find(*this)) {
+            return cached;
+        }
+    }
+
+    // The asynchronous rules are weaker than the synchronous ones, so the result is neither flagged
+    // as simplified nor stored in the cache, which only holds fully simplified expressions.
+    return ComputeSimplified(subflow);
+}
+
+auto Expression::SimplifyShared(const Expression& expression, const std::shared_ptr<Expression>& owner) -> std::shared_ptr<Expression>
+{
+    SimplifyCache* cache = SimplifyCache::GetCurrent();
+
+    // Operands are simplified first, so that simplifying a node finds them already simplified
+    // instead of recursing into them. Operands that are already simplified are shared with the
+    // result rather than copied.
+    const auto enter = [cache](const Expression& node, const std::shared_ptr<Expression>& owner) -> std::shared_ptr<Expression> {
+        if (node.IsSimplified()) {
+            return owner ? owner : ExpressionArena::Share(node.Copy());
+        }
+
+        if (cache != nullptr && SimplifyCache::IsCacheable(node)) {
+            return cache->Find(node);
+        }
+
+        return nullptr;
+    };
+
+    return Transform(expression, owner, enter, [cache](const Expression& node, const std::shared_ptr<Expression>& rebuilt) -> std::shared_ptr<Expression> {
+        std::shared_ptr<Expression> result = ExpressionArena::Share(rebuilt->ComputeSimplified());
+        result->simplified.store(true, std::memory_order_relaxed);
+
+        if (cache != nullptr && SimplifyCache::IsCacheable(node)) {
+            cache->Insert(node, *result);
+        }
+
+        return result;
+    });
+}
+
+auto Expression::ToString() const -> std::string
+{
+    if (operandStrings != nullptr) {
+        if (auto it = operandStrings->find(this); it != operandStrings->end()) {
+            auto string = std::move(it->second);
+            operandStrings->erase(it);
+            return string;
+        }
+
+        return ComputeString();
+    }
+
+    if (GetOperandCount() == 0) {
+        return ComputeString();
+    }
+
+    // Operands are converted first, so that converting a node finds the strings of its operands
+    // instead of recursing into them. Each string is discarded once its parent has used it.
+    std::unordered_map<const Expression*, std::string> strings;
+    operandStrings = &strings;
+
+    struct Restore {
+        ~Restore() { operandStrings = nullptr; }
+    } restore;
+
+    PostOrder(
+        *this,
+        [](const Expression& node) {
+            return node.GetOperandCount() > 0;
+        },
+        [this, &strings](const Expression& node) {
+            if (&node != this) {
+                strings.insert_or_assign(&node, node.ComputeString());
+            }
+        });
+
+    return ComputeString();
+}
+
+auto Expression::ComputeSimplified() const -> std::unique_ptr<Expression>
+{
+    return Copy();
+}
+
+auto Expression::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
 {
     return Copy(subflow);
 }
 
+auto Expression::operator new(std::size_t size) -> void*
+{
+    return ExpressionArena::AllocateExpression(size);
+}
+
+auto Expression::operator delete(Expression* expression, std::destroying_delete_t) -> void
+{
+    const bool arenaAllocated = expression->arenaAllocated;
+    void* ptr = dynamic_cast<void*>(expression);
+
+    expression->~Expression();
+    ExpressionArena::DeallocateExpression(ptr, arenaAllocated);
+}
+
+auto Expression::operator delete(void* ptr) -> void
+{
+    ExpressionArena::DeallocateUnconstructed(ptr);
+}
+
 auto Expression::SimplifyAsync() const -> std::unique_ptr<Expression>
 {
     static tf::Executor executor;
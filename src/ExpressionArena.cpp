@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <new>
+#include <stdexcept>
+
+#include "Oasis/ExpressionArena.hpp"
+#include "Oasis/Traversal.hpp"
+
+namespace {
+
+thread_local Oasis::ExpressionArena* currentArena = nullptr;
+
+// The number of arena scopes open on any thread. While there are none, allocating an expression
+// goes straight to the heap without looking up the active arena.
+std::atomic<std::size_t> openScopes = 0;
+
+// Every expression allocated from an arena is prefixed with a header recording the arena, so that
+// it can be freed from any thread. Expressions allocated from the heap carry no header.
+struct alignas(std::max_align_t) AllocationHeader {
+    Oasis::ExpressionArena* arena;
+};
+
+// The expressions allocated from an arena on this thread whose constructors have not yet run, most
+// recent last. Allocating an expression can be interleaved with allocating the arguments of its
+// constructor, but each constructor runs after those of its arguments.
+thread_local std::vector<const void*> pendingExpressions;
+
+auto AlignSize(std::size_t size) -> std::size_t
+{
+    constexpr auto alignment = alignof(std::max_align_t);
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+}
+
+namespace Oasis {
+
+ExpressionArena::Scope::Scope(ExpressionArena& arena)
+    : previous(currentArena)
+{
+    currentArena = &arena;
+    ++openScopes;
+}
+
+ExpressionArena::Scope::~Scope()
+{
+    currentArena = previous;
+    --openScopes;
+}
+
+ExpressionArena::ExpressionArena(std::size_t blockSize)
+    : blockSize(AlignSize(blockSize))
+{
+}
+
+ExpressionArena::~ExpressionArena()
+{
+    // Freeing the blocks would leave the live expressions, or the next expressions allocated on
+    // this thread, dangling, so there is no safe way to continue.
+    if (liveCount != 0 || currentArena == this) {
+        std::terminate();
+    }
+}
+
+auto ExpressionArena::Allocate(std::size_t size) -> void*
+{
+    size = AlignSize(size);
+
+    while (currentBlock < blocks.size() && offset + size > blocks[currentBlock].size) {
+        ++currentBlock;
+        offset = 0;
+    }
+
+    if (currentBlock == blocks.size()) {
+        const auto newBlockSize = std::max(blockSize, size);
+        blocks.push_back({ std::make_unique<std::byte[]>(newBlockSize), newBlockSize });
+        offset = 0;
+    }
+
+    void* ptr = blocks[currentBlock].memory.get() + offset;
+    offset += size;
+    bytesAllocated += size;
+
+    return ptr;
+}
+
+auto ExpressionArena::Detach(const Expression& expression) const -> std::unique_ptr<Expression>
+{
+    assert(currentArena != this && "Detaching an expression into the arena it is detached from");
+
+    // Nodes from this arena are copied once their operands are detached, and other nodes are shared
+    // as is. The root is always traversed, since it may have operands from this arena even if it
+    // is not from this arena itself.
+    const auto detached = Transform(
+        expression,
+        [this](const Expression& node, const std::shared_ptr<Expression>& owner) -> std::shared_ptr<Expression> {
+            return owner && !Owns(node) ? owner : nullptr;
+        },
+        [this](const Expression&, const std::shared_ptr<Expression>& rebuilt) -> std::shared_ptr<Expression> {
+            return Owns(*rebuilt) ? std::shared_ptr<Expression> { rebuilt->Copy() } : rebuilt;
+        });
+
+    return detached->Copy();
+}
+
+auto ExpressionArena::GetBytesAllocated() const -> std::size_t
+{
+    return bytesAllocated;
+}
+
+auto ExpressionArena::GetLiveCount() const -> std::size_t
+{
+    return liveCount;
+}
+
+auto ExpressionArena::GetActiveArenaOf(const Expression& expression) -> ExpressionArena*
+{
+    if (!expression.arenaAllocated || currentArena == nullptr) {
+        return nullptr;
+    }
+
+    const auto* header = static_cast<const AllocationHeader*>(dynamic_cast<const void*>(&expression)) - 1;
+    return header->arena == currentArena ? currentArena : nullptr;
+}
+
+auto ExpressionArena::Owns(const Expression& expression) const -> bool
+{
+    return OwnsAddress(dynamic_cast<const void*>(&expression));
+}
+
+auto ExpressionArena::OwnsAddress(const void* ptr) const -> bool
+{
+    const auto* address = static_cast<const std::byte*>(ptr);
+
+    return std::any_of(blocks.begin(), blocks.end(), [address](const Block& block) {
+        return address >= block.memory.get() && address < block.memory.get() + block.size;
+    });
+}
+
+auto ExpressionArena::Reset() -> bool
+{
+    if (liveCount != 0) {
+        return false;
+    }
+
+    currentBlock = 0;
+    offset = 0;
+    bytesAllocated = 0;
+
+    return true;
+}
+
+auto ExpressionArena::Simplify(const Expression& expression) -> std::unique_ptr<Expression>
+{
+    if (liveCount != 0) {
+        throw std::logic_error("Simplifying through an arena that still has live expressions");
+    }
+
+    std::unique_ptr<Expression> simplified;
+
+    {
+        Scope scope { *this };
+        simplified = expression.Simplify();
+    }
+
+    auto result = Owns(*simplified) ? Detach(*simplified) : std::move(simplified);
+    simplified.reset();
+
+    if (!Reset()) {
+        throw std::runtime_error("An expression allocated while simplifying outlived the simplification");
+    }
+
+    return result;
+}
+
+auto ExpressionArena::GetCurrent() -> ExpressionArena*
+{
+    return currentArena;
+}
+
+auto ExpressionArena::AllocateExpression(std::size_t size) -> void*
+{
+    if (openScopes.load(std::memory_order_relaxed) == 0 || currentArena == nullptr) {
+        return ::operator new(size);
+    }
+
+    ++currentArena->liveCount;
+
+    auto* header = new (currentArena->Allocate(sizeof(AllocationHeader) + size)) AllocationHeader { currentArena };
+    void* ptr = header + 1;
+    pendingExpressions.push_back(ptr);
+
+    return ptr;
+}
+
+auto ExpressionArena::ClaimExpression(const void* ptr) -> bool
+{
+    if (openScopes.load(std::memory_order_relaxed) == 0 || pendingExpressions.empty() || pendingExpressions.back() != ptr) {
+        return false;
+    }
+
+    pendingExpressions.pop_back();
+    return true;
+}
+
+auto ExpressionArena::DeallocateExpression(void* ptr, bool arenaAllocated) -> void
+{
+    if (!ptr) {
+        return;
+    }
+
+    if (!arenaAllocated) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    --(static_cast<AllocationHeader*>(ptr) - 1)->arena->liveCount;
+}
+
+auto ExpressionArena::DeallocateUnconstructed(void* ptr) -> void
+{
+    if (!ptr) {
+        return;
+    }
+
+    // A constructor that threw ran on the thread that allocated the expression, within the scope of
+    // the arena it may have been allocated from, and may or may not have claimed it.
+    if (ClaimExpression(ptr) || (currentArena != nullptr && currentArena->OwnsAddress(ptr))) {
+        DeallocateExpression(ptr, true);
+        return;
+    }
+
+    ::operator delete(ptr);
+}
+
+} // Oasis
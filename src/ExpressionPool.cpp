@@ -0,0 +1,496 @@
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <numbers>
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Derivative.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/ExpressionPool.hpp"
+#include "Oasis/Imaginary.hpp"
+#include "Oasis/Log.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Negate.hpp"
+#include "Oasis/Product.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Sum.hpp"
+#include "Oasis/Traversal.hpp"
+#include "Oasis/Undefined.hpp"
+#include "Oasis/Variable.hpp"
+
+namespace {
+
+// These mirror the hashing of the expression hierarchy, so that a node hashes the same as the
+// expression it was imported from.
+auto CombineHash(std::size_t seed, std::size_t value) -> std::size_t
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+}
+
+auto MixHash(std::size_t value) -> std::size_t
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+}
+
+auto IsAssociative(Oasis::ExpressionType type) -> bool
+{
+    return type == Oasis::ExpressionType::Add || type == Oasis::ExpressionType::Multiply;
+}
+
+}
+
+namespace Oasis {
+
+auto ExpressionPool::Clear() -> void
+{
+    types.clear();
+    mostSigOps.clear();
+    leastSigOps.clear();
+    values.clear();
+    symbols.clear();
+    hashes.clear();
+    rationals.clear();
+}
+
+auto ExpressionPool::Differentiate(Index index, SymbolTable::Id variable) -> Index
+{
+    const auto reachable = Reachable(index);
+    std::vector<Index> derivatives(index + 1, NoIndex);
+
+    const Index zero = MakeReal(0.0);
+    const Index one = MakeReal(1.0);
+
+    const auto add = [this](Index lhs, Index rhs) {
+        return IsReal(lhs, 0.0) ? rhs : IsReal(rhs, 0.0) ? lhs : MakeNode(ExpressionType::Add, lhs, rhs);
+    };
+
+    const auto subtract = [this](Index lhs, Index rhs) {
+        if (IsReal(rhs, 0.0)) {
+            return lhs;
+        }
+
+        return IsReal(lhs, 0.0) ? MakeNode(ExpressionType::Negate, rhs) : MakeNode(ExpressionType::Subtract, lhs, rhs);
+    };
+
+    const auto multiply = [this, zero](Index lhs, Index rhs) {
+        if (IsReal(lhs, 0.0) || IsReal(rhs, 0.0)) {
+            return zero;
+        }
+
+        return IsReal(lhs, 1.0) ? rhs : IsReal(rhs, 1.0) ? lhs : MakeNode(ExpressionType::Multiply, lhs, rhs);
+    };
+
+    const auto divide = [this](Index lhs, Index rhs) {
+        return IsReal(lhs, 0.0) || IsReal(rhs, 1.0) ? lhs : MakeNode(ExpressionType::Divide, lhs, rhs);
+    };
+
+    const auto ln = [this](Index operand) {
+        return MakeNode(ExpressionType::Log, MakeReal(std::numbers::e), operand);
+    };
+
+    const auto square = [this](Index operand) {
+        return MakeNode(ExpressionType::Exponent, operand, MakeReal(2.0));
+    };
+
+    for (Index i = 0; i <= index; ++i) {
+        if (!reachable[i]) {
+            continue;
+        }
+
+        const Index lhs = mostSigOps[i], rhs = leastSigOps[i];
+        const Index dLhs = lhs != NoIndex ? derivatives[lhs] : NoIndex;
+        const Index dRhs = rhs != NoIndex ? derivatives[rhs] : NoIndex;
+
+        switch (types[i]) {
+        case ExpressionType::Variable:
+            derivatives[i] = symbols[i] == variable ? one : zero;
+            break;
+        case ExpressionType::Add:
+            derivatives[i] = add(dLhs, dRhs);
+            break;
+        case ExpressionType::Subtract:
+            derivatives[i] = subtract(dLhs, dRhs);
+            break;
+        case ExpressionType::Multiply:
+            derivatives[i] = add(multiply(lhs, dRhs), multiply(dLhs, rhs));
+            break;
+        case ExpressionType::Divide:
+            derivatives[i] = divide(subtract(multiply(dLhs, rhs), multiply(lhs, dRhs)), square(rhs));
+            break;
+        case ExpressionType::Exponent:
+            if (!IsReal(dRhs, 0.0)) {
+                // d(f^g) = f^g * (g' * ln(f) + g * f' / f)
+                derivatives[i] = multiply(i, add(multiply(dRhs, ln(lhs)), divide(multiply(rhs, dLhs), lhs)));
+                break;
+            }
+
+            if (IsReal(dLhs, 0.0)) {
+                derivatives[i] = zero;
+                break;
+            }
+
+            {
+                // d(f^c) = c * f^(c - 1) * f'
+                const Index power = types[rhs] == ExpressionType::Real ? MakeReal(values[rhs] - 1.0) : MakeNode(ExpressionType::Subtract, rhs, one);
+                derivatives[i] = multiply(multiply(rhs, MakeNode(ExpressionType::Exponent, lhs, power)), dLhs);
+            }
+            break;
+        case ExpressionType::Log:
+            if (IsReal(dLhs, 0.0)) {
+                // d(log_b(f)) = f' / (f * ln(b))
+                derivatives[i] = divide(dRhs, multiply(rhs, ln(lhs)));
+                break;
+            }
+
+            // d(ln(f) / ln(g)) by the quotient rule
+            derivatives[i] = divide(subtract(multiply(divide(dRhs, rhs), ln(lhs)), multiply(ln(rhs), divide(dLhs, lhs))), square(ln(lhs)));
+            break;
+        case ExpressionType::Negate:
+            derivatives[i] = IsReal(dLhs, 0.0) ? zero : MakeNode(ExpressionType::Negate, dLhs);
+            break;
+        case ExpressionType::Derivative:
+            derivatives[i] = MakeNode(ExpressionType::Derivative, i, MakeVariable(variable));
+            break;
+        default:
+            derivatives[i] = zero;
+            break;
+        }
+    }
+
+    return derivatives[index];
+}
+
+auto ExpressionPool::Evaluate(Index index, const std::unordered_map<SymbolTable::Id, double>& bindings) const -> double
+{
+    const auto reachable = Reachable(index);
+    std::vector<double> results(index + 1);
+
+    for (Index i = 0; i <= index; ++i) {
+        if (!reachable[i]) {
+            continue;
+        }
+
+        const double lhs = mostSigOps[i] != NoIndex ? results[mostSigOps[i]] : 0.0;
+        const double rhs = leastSigOps[i] != NoIndex ? results[leastSigOps[i]] : 0.0;
+
+        switch (types[i]) {
+        case ExpressionType::Real:
+        case ExpressionType::Rational:
+            results[i] = values[i];
+            break;
+        case ExpressionType::Variable:
+            if (auto it = bindings.find(symbols[i]); it != bindings.end()) {
+                results[i] = it->second;
+            } else {
+                results[i] = std::numeric_limits<double>::quiet_NaN();
+            }
+            break;
+        case ExpressionType::Add:
+            results[i] = lhs + rhs;
+            break;
+        case ExpressionType::Subtract:
+            results[i] = lhs - rhs;
+            break;
+        case ExpressionType::Multiply:
+            results[i] = lhs * rhs;
+            break;
+        case ExpressionType::Divide:
+            results[i] = lhs / rhs;
+            break;
+        case ExpressionType::Exponent:
+            results[i] = std::pow(lhs, rhs);
+            break;
+        case ExpressionType::Log:
+            results[i] = std::log(rhs) / std::log(lhs);
+            break;
+        case ExpressionType::Negate:
+            results[i] = -lhs;
+            break;
+        default:
+            results[i] = std::numeric_limits<double>::quiet_NaN();
+            break;
+        }
+    }
+
+    return results[index];
+}
+
+auto ExpressionPool::Export(Index index) const -> std::unique_ptr<Expression>
+{
+    const auto reachable = Reachable(index);
+    std::vector<std::unique_ptr<Expression>> results(index + 1);
+
+    for (Index i = 0; i <= index; ++i) {
+        if (!reachable[i]) {
+            continue;
+        }
+
+        // Copies are shallow, so parents share the nodes of their operands' subtrees.
+        const Expression* lhs = mostSigOps[i] != NoIndex ? results[mostSigOps[i]].get() : nullptr;
+        const Expression* rhs = leastSigOps[i] != NoIndex ? results[leastSigOps[i]].get() : nullptr;
+
+        switch (types[i]) {
+        case ExpressionType::Real:
+            results[i] = std::make_unique<Real>(values[i]);
+            break;
+        case ExpressionType::Rational:
+            results[i] = std::make_unique<Rational>(rationals.at(i));
+            break;
+        case ExpressionType::Imaginary:
+            results[i] = std::make_unique<Imaginary>();
+            break;
+        case ExpressionType::Variable:
+            results[i] = std::make_unique<Variable>(SymbolTable::Global().GetName(symbols[i]));
+            break;
+        case ExpressionType::Add:
+            results[i] = std::make_unique<Add<Expression>>(*lhs, *rhs);
+            break;
+        case ExpressionType::Subtract:
+            results[i] = std::make_unique<Subtract<Expression>>(*lhs, *rhs);
+            break;
+        case ExpressionType::Multiply:
+            results[i] = std::make_unique<Multiply<Expression>>(*lhs, *rhs);
+            break;
+        case ExpressionType::Divide:
+            results[i] = std::make_unique<Divide<Expression>>(*lhs, *rhs);
+            break;
+        case ExpressionType::Exponent:
+            results[i] = std::make_unique<Exponent<Expression>>(*lhs, *rhs);
+            break;
+        case ExpressionType::Log:
+            results[i] = std::make_unique<Log<Expression>>(*lhs, *rhs);
+            break;
+        case ExpressionType::Derivative:
+            results[i] = std::make_unique<Derivative<Expression>>(*lhs, *rhs);
+            break;
+        case ExpressionType::Negate:
+            results[i] = std::make_unique<Negate<Expression>>(*lhs);
+            break;
+        default:
+            results[i] = std::make_unique<Undefined>();
+            break;
+        }
+    }
+
+    return std::move(results[index]);
+}
+
+auto ExpressionPool::Hash(Index index) const -> std::size_t
+{
+    assert(index < hashes.size());
+    return hashes[index];
+}
+
+auto ExpressionPool::Import(const Expression& expression) -> Index
+{
+    std::vector<Index> results;
+
+    PostOrder(
+        expression,
+        [](const Expression&) { return true; },
+        [this, &results](const Expression& node) {
+            const std::size_t operandCount = node.GetOperandCount();
+            const auto operands = results.end() - static_cast<std::ptrdiff_t>(operandCount);
+            Index result;
+
+            switch (operandCount) {
+            case 0:
+                if (node.Is<Real>()) {
+                    result = MakeReal(static_cast<const Real&>(node).GetValue());
+                } else if (node.Is<Rational>()) {
+                    result = MakeRational(static_cast<const Rational&>(node).GetValue());
+                } else if (node.Is<Variable>()) {
+                    result = MakeVariable(static_cast<const Variable&>(node).GetSymbol());
+                } else {
+                    result = MakeNode(node.GetType());
+                }
+                break;
+            case 1:
+                result = MakeNode(node.GetType(), operands[0]);
+                break;
+            default: {
+                // N-ary expressions are folded into a chain of binary nodes.
+                const ExpressionType type = node.Is<Sum>() ? ExpressionType::Add : node.Is<Product>() ? ExpressionType::Multiply : node.GetType();
+                result = operands[0];
+
+                for (std::size_t i = 1; i < operandCount; ++i) {
+                    result = MakeNode(type, result, operands[static_cast<std::ptrdiff_t>(i)]);
+                }
+                break;
+            }
+            }
+
+            results.erase(operands, results.end());
+            results.push_back(result);
+        });
+
+    assert(results.size() == 1);
+    return results.back();
+}
+
+auto ExpressionPool::MakeNode(ExpressionType type, Index mostSigOp, Index leastSigOp) -> Index
+{
+    assert(mostSigOp == NoIndex || mostSigOp < types.size());
+    assert(leastSigOp == NoIndex || leastSigOp < types.size());
+    return Append(type, mostSigOp, leastSigOp, 0.0, 0);
+}
+
+auto ExpressionPool::MakeRational(const Fraction& value) -> Index
+{
+    // The exact value goes in first, since the node is hashed as soon as it is appended.
+    const auto index = static_cast<Index>(types.size());
+    rationals.insert_or_assign(index, value);
+    return Append(ExpressionType::Rational, NoIndex, NoIndex, value.ToDouble(), 0);
+}
+
+auto ExpressionPool::MakeReal(double value) -> Index
+{
+    return Append(ExpressionType::Real, NoIndex, NoIndex, value, 0);
+}
+
+auto ExpressionPool::MakeVariable(SymbolTable::Id symbol) -> Index
+{
+    return Append(ExpressionType::Variable, NoIndex, NoIndex, 0.0, symbol);
+}
+
+auto ExpressionPool::Reserve(std::size_t capacity) -> void
+{
+    types.reserve(capacity);
+    mostSigOps.reserve(capacity);
+    leastSigOps.reserve(capacity);
+    values.reserve(capacity);
+    symbols.reserve(capacity);
+    hashes.reserve(capacity);
+}
+
+auto ExpressionPool::GetLeastSigOp(Index index) const -> Index
+{
+    assert(index < types.size());
+    return leastSigOps[index];
+}
+
+auto ExpressionPool::GetMostSigOp(Index index) const -> Index
+{
+    assert(index < types.size());
+    return mostSigOps[index];
+}
+
+auto ExpressionPool::GetRational(Index index) const -> const Fraction&
+{
+    assert(index < types.size() && types[index] == ExpressionType::Rational);
+    return rationals.at(index);
+}
+
+auto ExpressionPool::GetSize() const -> std::size_t
+{
+    return types.size();
+}
+
+auto ExpressionPool::GetSymbol(Index index) const -> SymbolTable::Id
+{
+    assert(index < types.size());
+    return symbols[index];
+}
+
+auto ExpressionPool::GetType(Index index) const -> ExpressionType
+{
+    assert(index < types.size());
+    return types[index];
+}
+
+auto ExpressionPool::GetValue(Index index) const -> double
+{
+    assert(index < types.size());
+    return values[index];
+}
+
+auto ExpressionPool::Append(ExpressionType type, Index mostSigOp, Index leastSigOp, double value, SymbolTable::Id symbol) -> Index
+{
+    assert(types.size() < NoIndex);
+    const auto index = static_cast<Index>(types.size());
+
+    types.push_back(type);
+    mostSigOps.push_back(mostSigOp);
+    leastSigOps.push_back(leastSigOp);
+    values.push_back(value);
+    symbols.push_back(symbol);
+
+    // Operands are always added first, so the hash can be computed right away.
+    const auto hash = ComputeHash(index);
+    hashes.push_back(hash == 0 ? 1 : hash);
+
+    return index;
+}
+
+auto ExpressionPool::ComputeHash(Index index) const -> std::size_t
+{
+    const ExpressionType type = types[index];
+    const auto seed = MixHash(static_cast<std::size_t>(type) + 1);
+    const Index lhs = mostSigOps[index], rhs = leastSigOps[index];
+
+    switch (type) {
+    case ExpressionType::Real:
+        return CombineHash(seed, std::hash<double> {}(values[index] == 0.0 ? 0.0 : values[index]));
+    case ExpressionType::Rational:
+        return CombineHash(seed, rationals.at(index).Hash());
+    case ExpressionType::Variable:
+        return CombineHash(seed, std::hash<SymbolTable::Id> {}(symbols[index]));
+    default:
+        break;
+    }
+
+    if (lhs == NoIndex) {
+        return seed;
+    }
+
+    if (rhs == NoIndex) {
+        return CombineHash(seed, hashes[lhs]);
+    }
+
+    if (!IsAssociative(type)) {
+        return CombineHash(CombineHash(seed, hashes[lhs]), hashes[rhs]);
+    }
+
+    const auto contribution = [this, type, seed](Index op) -> std::size_t {
+        return types[op] == type ? hashes[op] - seed : MixHash(hashes[op]);
+    };
+
+    return seed + contribution(lhs) + contribution(rhs);
+}
+
+auto ExpressionPool::IsReal(Index index, double value) const -> bool
+{
+    return types[index] == ExpressionType::Real && values[index] == value;
+}
+
+auto ExpressionPool::Reachable(Index root) const -> std::vector<bool>
+{
+    assert(root < types.size());
+
+    // Operands always precede their parents, so one backwards sweep marks every reachable node.
+    std::vector<bool> reachable(root + 1, false);
+    reachable[root] = true;
+
+    for (Index i = root + 1; i-- > 0;) {
+        if (!reachable[i]) {
+            continue;
+        }
+
+        if (mostSigOps[i] != NoIndex) {
+            reachable[mostSigOps[i]] = true;
+        }
+
+        if (leastSigOps[i] != NoIndex) {
+            reachable[leastSigOps[i]] = true;
+        }
+    }
+
+    return reachable;
+}
+
+} // Oasis
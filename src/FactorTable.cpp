@@ -0,0 +1,324 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <mutex>
+#include <numeric>
+
+#include "Oasis/FactorTable.hpp"
+
+namespace Oasis {
+
+namespace {
+
+// Trial division removes every prime factor below this bound before Pollard's rho algorithm runs.
+constexpr std::uint64_t TrialDivisionBound = 128;
+
+// Multiplies two 64-bit integers into the high 64 bits of their 128-bit product, and its low 64
+// bits, from 32-bit halves, since not every compiler has a 128-bit integer.
+auto MultiplyWide(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& low) -> std::uint64_t
+{
+    const std::uint64_t lhsLow = lhs & 0xFFFFFFFF, lhsHigh = lhs >> 32;
+    const std::uint64_t rhsLow = rhs & 0xFFFFFFFF, rhsHigh = rhs >> 32;
+
+    const std::uint64_t lowLow = lhsLow * rhsLow;
+    const std::uint64_t lowHigh = lhsLow * rhsHigh;
+    const std::uint64_t highLow = lhsHigh * rhsLow;
+    const std::uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+
+    low = middle << 32 | (lowLow & 0xFFFFFFFF);
+    return lhsHigh * rhsHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+}
+
+// Arithmetic modulo an odd integer in Montgomery form, where x is represented by xR mod n with
+// R = 2^64, so that products are reduced by multiplications and shifts instead of divisions.
+class Montgomery {
+public:
+    explicit Montgomery(std::uint64_t modulus)
+        : modulus(modulus)
+    {
+        // Each Newton step doubles the number of correct low bits of the inverse, starting from 3.
+        for (int i = 0; i < 5; ++i) {
+            inverse *= 2 - modulus * inverse;
+        }
+
+        // R mod n, doubled 64 times, is R^2 mod n.
+        one = (0 - modulus) % modulus;
+        rSquared = one;
+
+        for (int i = 0; i < 64; ++i) {
+            rSquared = Add(rSquared, rSquared);
+        }
+    }
+
+    [[nodiscard]] auto Add(std::uint64_t lhs, std::uint64_t rhs) const -> std::uint64_t
+    {
+        return lhs >= modulus - rhs ? lhs - (modulus - rhs) : lhs + rhs;
+    }
+
+    [[nodiscard]] auto GetOne() const -> std::uint64_t
+    {
+        return one;
+    }
+
+    [[nodiscard]] auto Multiply(std::uint64_t lhs, std::uint64_t rhs) const -> std::uint64_t
+    {
+        std::uint64_t low = 0;
+        const std::uint64_t high = MultiplyWide(lhs, rhs, low);
+        return Reduce(high, low);
+    }
+
+    [[nodiscard]] auto Pow(std::uint64_t base, std::uint64_t exponent) const -> std::uint64_t
+    {
+        std::uint64_t result = one;
+
+        while (exponent > 0) {
+            if (exponent & 1) {
+                result = Multiply(result, base);
+            }
+
+            base = Multiply(base, base);
+            exponent >>= 1;
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] auto To(std::uint64_t value) const -> std::uint64_t
+    {
+        return Multiply(value % modulus, rSquared);
+    }
+
+private:
+    // Computes TR^-1 mod n for T < nR. Since m = T n^-1 mod R makes T - mn divisible by R, the low
+    // halves cancel exactly, and (T - mn) / R lies strictly between -n and n.
+    [[nodiscard]] auto Reduce(std::uint64_t high, std::uint64_t low) const -> std::uint64_t
+    {
+        std::uint64_t productLow = 0;
+        const std::uint64_t productHigh = MultiplyWide(low * inverse, modulus, productLow);
+        return high >= productHigh ? high - productHigh : high + (modulus - productHigh);
+    }
+
+    std::uint64_t modulus;
+    std::uint64_t inverse = modulus;
+    std::uint64_t one = 0;
+    std::uint64_t rSquared = 0;
+};
+
+// Finds a nontrivial factor of an odd composite integer with no factors below the trial division
+// bound, by Pollard's rho algorithm with Brent's cycle detection. The differences of each batch of
+// steps are multiplied together, so that a batch needs only one gcd.
+auto FindFactor(std::uint64_t n) -> std::uint64_t
+{
+    constexpr std::uint64_t BatchSize = 128;
+    const Montgomery montgomery { n };
+
+    const auto difference = [](std::uint64_t lhs, std::uint64_t rhs) { return lhs > rhs ? lhs - rhs : rhs - lhs; };
+
+    // A sequence that cycles without splitting n is retried with another increment.
+    for (std::uint64_t c = 1;; ++c) {
+        const std::uint64_t increment = montgomery.To(c);
+        const auto step = [&montgomery, increment](std::uint64_t x) { return montgomery.Add(montgomery.Multiply(x, x), increment); };
+
+        std::uint64_t y = montgomery.To(2);
+        std::uint64_t x = y;
+        std::uint64_t saved = y;
+        std::uint64_t product = montgomery.GetOne();
+        std::uint64_t divisor = 1;
+
+        // The gcd of a value in Montgomery form with n is the gcd of the value itself, since R is
+        // coprime to n.
+        for (std::uint64_t length = 1; divisor == 1; length *= 2) {
+            x = y;
+
+            for (std::uint64_t i = 0; i < length; ++i) {
+                y = step(y);
+            }
+
+            for (std::uint64_t k = 0; k < length && divisor == 1; k += BatchSize) {
+                saved = y;
+
+                for (std::uint64_t i = 0; i < std::min(BatchSize, length - k); ++i) {
+                    y = step(y);
+                    product = montgomery.Multiply(product, difference(x, y));
+                }
+
+                divisor = std::gcd(product, n);
+            }
+        }
+
+        // The batch overshot into a multiple of n, so its steps are retraced one at a time.
+        if (divisor == n) {
+            do {
+                saved = step(saved);
+                divisor = std::gcd(difference(x, saved), n);
+            } while (divisor == 1);
+        }
+
+        if (divisor != n) {
+            return divisor;
+        }
+    }
+}
+
+} // namespace
+
+FactorTable::FactorTable(std::size_t capacity)
+    : capacity(capacity)
+{
+}
+
+auto FactorTable::Global() -> FactorTable&
+{
+    static FactorTable table;
+    return table;
+}
+
+auto FactorTable::IsPrime(std::uint64_t n) -> bool
+{
+    // These bases decide every integer below 3.3 * 10^24, and so every 64-bit integer.
+    constexpr std::array<std::uint64_t, 12> Bases { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+
+    if (n < 2) {
+        return false;
+    }
+
+    for (const std::uint64_t base : Bases) {
+        if (n % base == 0) {
+            return n == base;
+        }
+    }
+
+    // n - 1 = d 2^s, with d odd.
+    const int s = std::countr_zero(n - 1);
+    const std::uint64_t d = (n - 1) >> s;
+    const Montgomery montgomery { n };
+    const std::uint64_t one = montgomery.GetOne();
+    const std::uint64_t minusOne = montgomery.To(n - 1);
+
+    for (const std::uint64_t base : Bases) {
+        std::uint64_t x = montgomery.Pow(montgomery.To(base), d);
+
+        if (x == one || x == minusOne) {
+            continue;
+        }
+
+        bool witness = true;
+
+        for (int i = 1; i < s && witness; ++i) {
+            x = montgomery.Multiply(x, x);
+            witness = x != minusOne;
+        }
+
+        if (witness) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto FactorTable::Clear() -> void
+{
+    std::unique_lock lock { mutex };
+    factorizations.clear();
+}
+
+auto FactorTable::Factorize(std::uint64_t n) -> PrimeFactors
+{
+    {
+        std::shared_lock lock { mutex };
+
+        if (auto it = factorizations.find(n); it != factorizations.end()) {
+            return it->second;
+        }
+    }
+
+    std::vector<std::uint64_t> primes;
+    std::uint64_t remaining = n;
+
+    for (std::uint64_t p = 2; p < TrialDivisionBound && remaining > 1; p += p == 2 ? 1 : 2) {
+        while (remaining % p == 0) {
+            primes.push_back(p);
+            remaining /= p;
+        }
+    }
+
+    // What is left is 1, a prime, or a product of primes that are each at least the bound.
+    std::vector<std::uint64_t> pending;
+
+    if (remaining > 1) {
+        pending.push_back(remaining);
+    }
+
+    while (!pending.empty()) {
+        const std::uint64_t current = pending.back();
+        pending.pop_back();
+
+        if (current < TrialDivisionBound * TrialDivisionBound || IsPrime(current)) {
+            primes.push_back(current);
+            continue;
+        }
+
+        const std::uint64_t factor = FindFactor(current);
+        pending.push_back(factor);
+        pending.push_back(current / factor);
+    }
+
+    std::ranges::sort(primes);
+    PrimeFactors factors;
+
+    for (const std::uint64_t prime : primes) {
+        if (!factors.empty() && factors.back().first == prime) {
+            ++factors.back().second;
+        } else {
+            factors.emplace_back(prime, 1);
+        }
+    }
+
+    std::unique_lock lock { mutex };
+
+    if (factorizations.size() >= capacity) {
+        factorizations.clear();
+    }
+
+    factorizations.emplace(n, factors);
+    return factors;
+}
+
+auto FactorTable::GetCapacity() const -> std::size_t
+{
+    return capacity;
+}
+
+auto FactorTable::GetDivisors(std::uint64_t n) -> std::vector<std::uint64_t>
+{
+    if (n == 0) {
+        return {};
+    }
+
+    std::vector<std::uint64_t> divisors { 1 };
+
+    for (const auto& [prime, exponent] : Factorize(n)) {
+        const std::size_t count = divisors.size();
+        std::uint64_t power = 1;
+
+        for (unsigned i = 0; i < exponent; ++i) {
+            power *= prime;
+
+            for (std::size_t j = 0; j < count; ++j) {
+                divisors.push_back(divisors[j] * power);
+            }
+        }
+    }
+
+    std::ranges::sort(divisors);
+    return divisors;
+}
+
+auto FactorTable::GetSize() const -> std::size_t
+{
+    std::shared_lock lock { mutex };
+    return factorizations.size();
+}
+
+} // Oasis
@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "Oasis/Fraction.hpp"
+
+namespace Oasis {
+
+namespace {
+
+constexpr std::int64_t Min = std::numeric_limits<std::int64_t>::min();
+constexpr std::int64_t Max = std::numeric_limits<std::int64_t>::max();
+
+// Adds two integers, failing if the sum overflows or is the most negative integer.
+auto CheckedAdd(std::int64_t lhs, std::int64_t rhs, std::int64_t& result) -> bool
+{
+    if ((rhs > 0 && lhs > Max - rhs) || (rhs < 0 && lhs <= Min - rhs)) {
+        return false;
+    }
+
+    result = lhs + rhs;
+    return true;
+}
+
+// Multiplies two integers, failing if the product overflows or is the most negative integer.
+auto CheckedMultiply(std::int64_t lhs, std::int64_t rhs, std::int64_t& result) -> bool
+{
+    // Neither operand is the most negative integer, so comparing magnitudes is safe.
+    if (lhs != 0 && std::abs(rhs) > Max / std::abs(lhs)) {
+        return false;
+    }
+
+    result = lhs * rhs;
+    return true;
+}
+
+auto CombineHash(std::size_t seed, std::size_t value) -> std::size_t
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+}
+
+} // namespace
+
+Fraction::Fraction(std::int64_t numerator, std::int64_t denominator)
+{
+    if (denominator == 0) {
+        throw std::domain_error("Fraction has a zero denominator.");
+    }
+
+    if (numerator == Min || denominator == Min) {
+        *this = Normalize(numerator, denominator);
+        return;
+    }
+
+    if (denominator < 0) {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    const std::int64_t divisor = std::gcd(numerator, denominator);
+    this->numerator = numerator / divisor;
+    this->denominator = denominator / divisor;
+}
+
+Fraction::Fraction(const BigInt& numerator, const BigInt& denominator)
+{
+    *this = Normalize(numerator, denominator);
+}
+
+auto Fraction::FromDouble(double value) -> Fraction
+{
+    if (!std::isfinite(value)) {
+        throw std::domain_error("Fraction cannot represent an infinite or NaN value.");
+    }
+
+    // value = mantissa * 2^exponent, where the mantissa is an integer of at most 53 bits.
+    int exponent = 0;
+    const double significand = std::frexp(value, &exponent);
+    const auto mantissa = static_cast<std::int64_t>(std::ldexp(significand, 53));
+    exponent -= 53;
+
+    if (exponent >= 0) {
+        return { BigInt { mantissa } * BigInt { 2 }.Pow(static_cast<std::uint64_t>(exponent)), BigInt { 1 } };
+    }
+
+    return { BigInt { mantissa }, BigInt { 2 }.Pow(static_cast<std::uint64_t>(-exponent)) };
+}
+
+auto Fraction::GetDenominator() const -> BigInt
+{
+    return spilled ? spilled->denominator : BigInt { denominator };
+}
+
+auto Fraction::GetNumerator() const -> BigInt
+{
+    return spilled ? spilled->numerator : BigInt { numerator };
+}
+
+auto Fraction::Hash() const -> std::size_t
+{
+    if (spilled) {
+        return CombineHash(spilled->numerator.Hash(), spilled->denominator.Hash());
+    }
+
+    return CombineHash(std::hash<std::int64_t> {}(numerator), std::hash<std::int64_t> {}(denominator));
+}
+
+auto Fraction::IsInline() const -> bool
+{
+    return !spilled;
+}
+
+auto Fraction::IsInteger() const -> bool
+{
+    return spilled ? spilled->denominator == BigInt { 1 } : denominator == 1;
+}
+
+auto Fraction::IsNegative() const -> bool
+{
+    return spilled ? spilled->numerator.IsNegative() : numerator < 0;
+}
+
+auto Fraction::IsZero() const -> bool
+{
+    // Zero always fits inline.
+    return !spilled && numerator == 0;
+}
+
+auto Fraction::Pow(std::int64_t exponent) const -> Fraction
+{
+    if (exponent < 0 && IsZero()) {
+        throw std::domain_error("Zero cannot be raised to a negative power.");
+    }
+
+    Fraction base = exponent < 0 ? Fraction { 1 } / *this : *this;
+    auto magnitude = exponent < 0 ? std::uint64_t { 0 } - static_cast<std::uint64_t>(exponent) : static_cast<std::uint64_t>(exponent);
+    Fraction result { 1 };
+
+    while (magnitude > 0) {
+        if (magnitude & 1) {
+            result = result * base;
+        }
+
+        magnitude >>= 1;
+
+        if (magnitude > 0) {
+            base = base * base;
+        }
+    }
+
+    return result;
+}
+
+auto Fraction::ToDouble() const -> double
+{
+    constexpr std::int64_t exactLimit = std::int64_t { 1 } << 53;
+
+    // Integers of at most 53 bits convert exactly, so that their quotient is rounded only once.
+    if (!spilled && numerator > -exactLimit && numerator < exactLimit && denominator < exactLimit) {
+        return static_cast<double>(numerator) / static_cast<double>(denominator);
+    }
+
+    // The quotient is scaled to at least 65 bits and truncated, with an inexact quotient made odd,
+    // so that rounding it to a double rounds the exact value.
+    const BigInt magnitude = GetNumerator().Abs();
+    const BigInt divisor = GetDenominator();
+    const long shift = 66 - static_cast<long>(magnitude.GetBitLength()) + static_cast<long>(divisor.GetBitLength());
+    const BigInt two { 2 };
+
+    auto [quotient, remainder] = BigInt::DivRem(shift > 0 ? magnitude * two.Pow(static_cast<std::uint64_t>(shift)) : magnitude, shift < 0 ? divisor * two.Pow(static_cast<std::uint64_t>(-shift)) : divisor);
+
+    if (!remainder.IsZero() && (quotient % two).IsZero()) {
+        quotient = quotient + BigInt { 1 };
+    }
+
+    const double result = std::ldexp(quotient.ToDouble(), static_cast<int>(std::clamp<long>(-shift, -4096, 4096)));
+    return IsNegative() ? -result : result;
+}
+
+auto Fraction::ToString() const -> std::string
+{
+    if (IsInteger()) {
+        return GetNumerator().ToString();
+    }
+
+    return GetNumerator().ToString() + "/" + GetDenominator().ToString();
+}
+
+auto Fraction::operator+(const Fraction& other) const -> Fraction
+{
+    if (!spilled && !other.spilled) {
+        // a/b + c/d = (a (d/g) + c (b/g)) / (b (d/g)), where g = gcd(b, d), after which only a
+        // factor of g can be left in common.
+        const std::int64_t divisor = std::gcd(denominator, other.denominator);
+        const std::int64_t lhsScale = other.denominator / divisor;
+        const std::int64_t rhsScale = denominator / divisor;
+        std::int64_t lhs, rhs, sum, product;
+
+        if (CheckedMultiply(numerator, lhsScale, lhs) && CheckedMultiply(other.numerator, rhsScale, rhs) && CheckedAdd(lhs, rhs, sum) && CheckedMultiply(denominator, lhsScale, product)) {
+            if (sum == 0) {
+                return {};
+            }
+
+            const std::int64_t common = std::gcd(sum, divisor);
+
+            Fraction result;
+            result.numerator = sum / common;
+            result.denominator = product / common;
+            return result;
+        }
+    }
+
+    return Normalize(GetNumerator() * other.GetDenominator() + other.GetNumerator() * GetDenominator(), GetDenominator() * other.GetDenominator());
+}
+
+auto Fraction::operator-(const Fraction& other) const -> Fraction
+{
+    return *this + -other;
+}
+
+auto Fraction::operator-() const -> Fraction
+{
+    if (spilled) {
+        return Normalize(-spilled->numerator, spilled->denominator);
+    }
+
+    Fraction result = *this;
+    result.numerator = -numerator;
+    return result;
+}
+
+auto Fraction::operator*(const Fraction& other) const -> Fraction
+{
+    if (IsZero() || other.IsZero()) {
+        return {};
+    }
+
+    if (!spilled && !other.spilled) {
+        // Common factors are cancelled before multiplying, so the product is in lowest terms.
+        const std::int64_t lhsDivisor = std::gcd(numerator, other.denominator);
+        const std::int64_t rhsDivisor = std::gcd(other.numerator, denominator);
+        std::int64_t product, productDenominator;
+
+        if (CheckedMultiply(numerator / lhsDivisor, other.numerator / rhsDivisor, product) && CheckedMultiply(denominator / rhsDivisor, other.denominator / lhsDivisor, productDenominator)) {
+            Fraction result;
+            result.numerator = product;
+            result.denominator = productDenominator;
+            return result;
+        }
+    }
+
+    return Normalize(GetNumerator() * other.GetNumerator(), GetDenominator() * other.GetDenominator());
+}
+
+auto Fraction::operator/(const Fraction& other) const -> Fraction
+{
+    if (other.IsZero()) {
+        throw std::domain_error("Division by zero.");
+    }
+
+    if (other.spilled) {
+        return *this * Normalize(other.spilled->denominator, other.spilled->numerator);
+    }
+
+    Fraction reciprocal;
+    reciprocal.numerator = other.numerator < 0 ? -other.denominator : other.denominator;
+    reciprocal.denominator = other.numerator < 0 ? -other.numerator : other.numerator;
+    return *this * reciprocal;
+}
+
+auto Fraction::operator==(const Fraction& other) const -> bool
+{
+    if (!spilled && !other.spilled) {
+        return numerator == other.numerator && denominator == other.denominator;
+    }
+
+    // A fraction that fits is never spilled, so only two spilled fractions can be equal.
+    return spilled && other.spilled && spilled->numerator == other.spilled->numerator && spilled->denominator == other.spilled->denominator;
+}
+
+auto Fraction::operator<=>(const Fraction& other) const -> std::strong_ordering
+{
+    // a/b <=> c/d has the order of ad <=> cb, since the denominators are positive.
+    if (!spilled && !other.spilled) {
+        std::int64_t lhs, rhs;
+
+        if (CheckedMultiply(numerator, other.denominator, lhs) && CheckedMultiply(other.numerator, denominator, rhs)) {
+            return lhs <=> rhs;
+        }
+    }
+
+    return GetNumerator() * other.GetDenominator() <=> other.GetNumerator() * GetDenominator();
+}
+
+auto Fraction::Normalize(BigInt numerator, BigInt denominator) -> Fraction
+{
+    if (denominator.IsZero()) {
+        throw std::domain_error("Fraction has a zero denominator.");
+    }
+
+    if (denominator.IsNegative()) {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    if (const BigInt divisor = BigInt::Gcd(numerator, denominator); divisor != BigInt { 1 }) {
+        numerator = numerator / divisor;
+        denominator = denominator / divisor;
+    }
+
+    Fraction result;
+
+    if (numerator.FitsInt64() && numerator != BigInt { Min } && denominator.FitsInt64()) {
+        result.numerator = numerator.ToInt64();
+        result.denominator = denominator.ToInt64();
+    } else {
+        result.spilled = std::make_shared<const Spilled>(Spilled { std::move(numerator), std::move(denominator) });
+    }
+
+    return result;
+}
+
+} // Oasis
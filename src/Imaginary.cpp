@@ -9,10 +9,10 @@ namespace Oasis {
 
 auto Imaginary::Equals(const Expression& other) const -> bool
 {
-    return other.Is<Imaginary>() == dynamic_cast<const Imaginary&>(other).Is<Imaginary>();
+    return other.Is<Imaginary>();
 }
 
-auto Imaginary::ToString() const -> std::string
+auto Imaginary::ComputeString() const -> std::string
 {
     return "i";
 }
@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "Oasis/IntegerPolynomial.hpp"
+
+namespace Oasis {
+
+namespace {
+
+auto Trimmed(std::span<const BigInt> coefficients) -> std::vector<BigInt>
+{
+    std::vector<BigInt> result { coefficients.begin(), coefficients.end() };
+
+    while (!result.empty() && result.back().IsZero()) {
+        result.pop_back();
+    }
+
+    return result;
+}
+
+auto SubtractDense(std::span<const BigInt> lhs, std::span<const BigInt> rhs) -> std::vector<BigInt>
+{
+    std::vector<BigInt> result { lhs.begin(), lhs.end() };
+    result.resize(std::max(lhs.size(), rhs.size()));
+
+    for (std::size_t i = 0; i < rhs.size(); ++i) {
+        result[i] = result[i] - rhs[i];
+    }
+
+    return Trimmed(result);
+}
+
+// Computes a multiple of the remainder of lhs divided by rhs, where rhs is nonzero, without leaving
+// the integers. Each step cancels the leading term of the remainder by scaling it with only as much
+// of the leading coefficient of rhs as it needs.
+auto PseudoRemainder(std::span<const BigInt> lhs, std::span<const BigInt> rhs) -> std::vector<BigInt>
+{
+    std::vector<BigInt> remainder = Trimmed(lhs);
+
+    while (remainder.size() >= rhs.size()) {
+        const BigInt divisor = BigInt::Gcd(remainder.back(), rhs.back());
+        const BigInt scale = rhs.back() / divisor;
+        const BigInt factor = remainder.back() / divisor;
+        const std::size_t shift = remainder.size() - rhs.size();
+
+        for (auto& coefficient : remainder) {
+            coefficient = coefficient * scale;
+        }
+
+        for (std::size_t i = 0; i < rhs.size(); ++i) {
+            remainder[shift + i] = remainder[shift + i] - factor * rhs[i];
+        }
+
+        remainder = Trimmed(remainder);
+    }
+
+    return remainder;
+}
+
+} // namespace
+
+auto DifferentiateDense(std::span<const BigInt> coefficients) -> std::vector<BigInt>
+{
+    std::vector<BigInt> derivative;
+    derivative.reserve(coefficients.empty() ? 0 : coefficients.size() - 1);
+
+    for (std::size_t i = 1; i < coefficients.size(); ++i) {
+        derivative.push_back(coefficients[i] * BigInt { static_cast<std::int64_t>(i) });
+    }
+
+    return Trimmed(derivative);
+}
+
+auto DivideDenseExact(std::span<const BigInt> dividend, std::span<const BigInt> divisor) -> std::vector<BigInt>
+{
+    std::vector<BigInt> remainder = Trimmed(dividend);
+    const std::vector<BigInt> trimmedDivisor = Trimmed(divisor);
+
+    if (trimmedDivisor.empty()) {
+        throw std::domain_error("Division by the zero polynomial.");
+    }
+
+    if (remainder.empty()) {
+        return {};
+    }
+
+    if (remainder.size() < trimmedDivisor.size()) {
+        throw std::domain_error("Polynomial does not divide the dividend exactly.");
+    }
+
+    std::vector<BigInt> quotient(remainder.size() - trimmedDivisor.size() + 1);
+
+    for (std::size_t k = quotient.size(); k-- > 0;) {
+        auto [term, termRemainder] = BigInt::DivRem(remainder[k + trimmedDivisor.size() - 1], trimmedDivisor.back());
+
+        if (!termRemainder.IsZero()) {
+            throw std::domain_error("Polynomial does not divide the dividend exactly.");
+        }
+
+        for (std::size_t i = 0; i < trimmedDivisor.size(); ++i) {
+            remainder[k + i] = remainder[k + i] - term * trimmedDivisor[i];
+        }
+
+        quotient[k] = std::move(term);
+    }
+
+    if (std::ranges::any_of(remainder, [](const BigInt& coefficient) { return !coefficient.IsZero(); })) {
+        throw std::domain_error("Polynomial does not divide the dividend exactly.");
+    }
+
+    return quotient;
+}
+
+auto EvaluateDense(std::span<const BigInt> coefficients, const BigInt& numerator, const BigInt& denominator) -> BigInt
+{
+    // q^n f(p/q) = (...((c_n p + c_{n-1} q) p + c_{n-2} q^2) p + ...) + c_0 q^n
+    BigInt value;
+    BigInt scale { 1 };
+
+    for (std::size_t i = coefficients.size(); i-- > 0;) {
+        value = value * numerator + coefficients[i] * scale;
+        scale = scale * denominator;
+    }
+
+    return value;
+}
+
+auto GcdDense(std::span<const BigInt> lhs, std::span<const BigInt> rhs) -> std::vector<BigInt>
+{
+    const BigInt content = BigInt::Gcd(GetContent(lhs), GetContent(rhs));
+    std::vector<BigInt> current = GetPrimitivePart(lhs);
+    std::vector<BigInt> next = GetPrimitivePart(rhs);
+
+    if (current.size() < next.size()) {
+        std::swap(current, next);
+    }
+
+    // Taking the primitive part of each remainder keeps its coefficients from growing exponentially.
+    while (!next.empty()) {
+        std::vector<BigInt> remainder = GetPrimitivePart(PseudoRemainder(current, next));
+        current = std::move(next);
+        next = std::move(remainder);
+    }
+
+    for (auto& coefficient : current) {
+        coefficient = coefficient * content;
+    }
+
+    return current;
+}
+
+auto GetContent(std::span<const BigInt> coefficients) -> BigInt
+{
+    BigInt content;
+
+    for (const BigInt& coefficient : coefficients) {
+        content = BigInt::Gcd(content, coefficient);
+    }
+
+    return content;
+}
+
+auto GetPrimitivePart(std::span<const BigInt> coefficients) -> std::vector<BigInt>
+{
+    std::vector<BigInt> result = Trimmed(coefficients);
+
+    if (result.empty()) {
+        return result;
+    }
+
+    const BigInt content = result.back().IsNegative() ? -GetContent(result) : GetContent(result);
+
+    for (auto& coefficient : result) {
+        coefficient = coefficient / content;
+    }
+
+    return result;
+}
+
+auto SquareFreeDecomposition(std::span<const BigInt> coefficients) -> std::vector<std::vector<BigInt>>
+{
+    const std::vector<BigInt> polynomial = GetPrimitivePart(coefficients);
+
+    if (polynomial.size() <= 1) {
+        return {};
+    }
+
+    // With f = a_1 a_2^2 a_3^3 ..., gcd(f, f') = a_2 a_3^2 ..., so b = f / gcd(f, f') = a_1 a_2 a_3 ...
+    // is the product of the factors, and d = f' / gcd(f, f') - b' = a_1 (a_2' a_3 ... + 2 a_2 a_3' ...)
+    // is divisible by a_1 but shares no factor with a_2 a_3 .... Each step takes a_1 = gcd(b, d) and
+    // continues with the remaining factors. By Gauss's lemma, each quotient has integer
+    // coefficients, since each divisor is primitive.
+    const std::vector<BigInt> derivative = DifferentiateDense(polynomial);
+    const std::vector<BigInt> repeated = GcdDense(polynomial, derivative);
+
+    std::vector<BigInt> product = DivideDenseExact(polynomial, repeated);
+    std::vector<BigInt> difference = SubtractDense(DivideDenseExact(derivative, repeated), DifferentiateDense(product));
+    std::vector<std::vector<BigInt>> factors;
+
+    while (product.size() > 1) {
+        std::vector<BigInt> factor = GcdDense(product, difference);
+        product = DivideDenseExact(product, factor);
+        difference = SubtractDense(DivideDenseExact(difference, factor), DifferentiateDense(product));
+        factors.push_back(std::move(factor));
+    }
+
+    return factors;
+}
+
+} // Oasis
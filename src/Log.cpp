@@ -8,6 +8,7 @@
 #include "Oasis/Expression.hpp"
 #include "Oasis/Multiply.hpp"
 #include "Oasis/Undefined.hpp"
+#include "Oasis/View.hpp"
 #include <cmath>
 
 namespace Oasis {
@@ -16,7 +17,12 @@ Log<Expression>::Log(const Expression& base, const Expression& argument)
 {
 }
 
-auto Log<Expression>::Simplify() const -> std::unique_ptr<Expression>
+Log<Expression>::Log(std::unique_ptr<Expression>&& base, std::unique_ptr<Expression>&& argument)
+    : BinaryExpression(std::move(base), std::move(argument))
+{
+}
+
+auto Log<Expression>::ComputeSimplified() const -> std::unique_ptr<Expression>
 {
     const auto simplifiedBase = mostSigOp ? mostSigOp->Simplify() : nullptr;
     const auto simplifiedArgument = leastSigOp ? leastSigOp->Simplify() : nullptr;
@@ -27,13 +33,13 @@ auto Log<Expression>::Simplify() const -> std::unique_ptr<Expression>
 
     const Log simplifiedLog { *simplifiedBase, *simplifiedArgument };
 
-    if (const auto realBaseCase = Log<Real, Expression>::Specialize(simplifiedLog); realBaseCase != nullptr) {
+    if (const auto realBaseCase = View<Log<Real, Expression>>::Specialize(simplifiedLog)) {
         if (const Real& b = realBaseCase->GetMostSigOp(); b.GetValue() <= 0.0 || b.GetValue() == 1) {
             return std::make_unique<Undefined>();
         }
     }
 
-    if (const auto realExponentCase = Log<Expression, Real>::Specialize(simplifiedLog); realExponentCase != nullptr) {
+    if (const auto realExponentCase = View<Log<Expression, Real>>::Specialize(simplifiedLog)) {
         const Real& argument = realExponentCase->GetLeastSigOp();
 
         if (argument.GetValue() <= 0.0) {
@@ -45,7 +51,12 @@ auto Log<Expression>::Simplify() const -> std::unique_ptr<Expression>
         }
     }
 
-    if (const auto realCase = Log<Real>::Specialize(simplifiedLog); realCase != nullptr) {
+    // log[a](a) = 1, exactly rather than by dividing logarithms
+    if (simplifiedBase->Equals(*simplifiedArgument)) {
+        return std::make_unique<Real>(1.0);
+    }
+
+    if (const auto realCase = View<Log<Real>>::Specialize(simplifiedLog)) {
         const Real& base = realCase->GetMostSigOp();
         const Real& argument = realCase->GetLeastSigOp();
 
@@ -53,7 +64,7 @@ auto Log<Expression>::Simplify() const -> std::unique_ptr<Expression>
     }
 
     // log[a](b^x) = x * log[a](b)
-    if (const auto expCase = Log<Expression, Exponent<>>::Specialize(simplifiedLog); expCase != nullptr) {
+    if (const auto expCase = View<Log<Expression, Exponent<>>>::Specialize(simplifiedLog)) {
         const auto exponent = expCase->GetLeastSigOp();
         const IExpression auto& log = Log<Expression>(expCase->GetMostSigOp(), exponent.GetMostSigOp()); // might need to check that it isnt nullptr
         const IExpression auto& factor = exponent.GetLeastSigOp();
@@ -63,12 +74,12 @@ auto Log<Expression>::Simplify() const -> std::unique_ptr<Expression>
     return simplifiedLog.Copy();
 }
 
-auto Log<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+auto Log<Expression>::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
 {
     return Copy(subflow);
 }
 
-auto Log<Expression>::ToString() const -> std::string
+auto Log<Expression>::ComputeString() const -> std::string
 {
     return fmt::format("log({}, {})", mostSigOp->ToString(), leastSigOp->ToString());
 }
@@ -6,266 +6,98 @@
 #include "Oasis/Add.hpp"
 #include "Oasis/Exponent.hpp"
 #include "Oasis/Imaginary.hpp"
+#include "Oasis/ProductNormalizer.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/RuleTable.hpp"
+#include "Oasis/View.hpp"
 
 namespace Oasis {
 
-auto Multiply<Expression>::Simplify() const -> std::unique_ptr<Expression>
-{
-    auto simplifiedMultiplicand = mostSigOp->Simplify();
-    auto simplifiedMultiplier = leastSigOp->Simplify();
+namespace {
 
-    Multiply simplifiedMultiply { *simplifiedMultiplicand, *simplifiedMultiplier };
-    if (auto onezerocase = Multiply<Real, Expression>::Specialize(simplifiedMultiply); onezerocase != nullptr) {
-        const Real& multiplicand = onezerocase->GetMostSigOp();
-        const Expression& multiplier = onezerocase->GetLeastSigOp();
+// Rules for simplifying the product of two simplified operands, tried in order.
+const RuleTable<Multiply> multiplyRules {
+    RuleTable<Multiply>::Make<Multiply<Real, Expression>>([](const auto& onezerocase) -> std::unique_ptr<Expression> {
+        const Real& multiplicand = onezerocase.GetMostSigOp();
+        const Expression& multiplier = onezerocase.GetLeastSigOp();
         if (multiplicand.GetValue() == 0) {
             return std::make_unique<Real>(Real { 0 });
         }
         if (multiplicand.GetValue() == 1) {
             return multiplier.Simplify();
         }
-    }
-    if (auto realCase = Multiply<Real>::Specialize(simplifiedMultiply); realCase != nullptr) {
-        const Real& multiplicand = realCase->GetMostSigOp();
-        const Real& multiplier = realCase->GetLeastSigOp();
-        return std::make_unique<Real>(multiplicand.GetValue() * multiplier.GetValue());
-    }
-
-    if (auto ImgCase = Multiply<Imaginary>::Specialize(simplifiedMultiply); ImgCase != nullptr) {
-        return std::make_unique<Real>(-1.0);
-    }
-    if (auto exprCase = Multiply<Expression>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().Equals(exprCase->GetLeastSigOp())) {
-            return std::make_unique<Exponent<Expression, Expression>>(exprCase->GetMostSigOp(), Real { 2.0 });
-        }
-    }
-
-    if (auto exprCase = Multiply<Expression, Exponent<Expression, Expression>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().Equals(exprCase->GetLeastSigOp().GetMostSigOp())) {
-            return std::make_unique<Exponent<Expression>>(exprCase->GetMostSigOp(),
-                *(Add<Expression> { exprCase->GetLeastSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()));
-        }
-    }
 
-    // x*x^n
-    if (auto exprCase = Multiply<Expression, Exponent<Expression>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().Equals(exprCase->GetLeastSigOp().GetMostSigOp())) {
-            return std::make_unique<Exponent<Expression>>(exprCase->GetMostSigOp(),
-                *(Add<Expression> { exprCase->GetLeastSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()));
-        }
-    }
-
-    if (auto exprCase = Multiply<Exponent<Expression>, Expression>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetLeastSigOp().Equals(exprCase->GetMostSigOp().GetMostSigOp())) {
-            return std::make_unique<Exponent<Expression>>(exprCase->GetLeastSigOp(),
-                *(Add<Expression> { exprCase->GetMostSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()));
-        }
-    }
-
-    // x^n*x^m
-    if (auto exprCase = Multiply<Exponent<Expression>, Exponent<Expression>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetMostSigOp().Equals(exprCase->GetLeastSigOp().GetMostSigOp())) {
-            return std::make_unique<Exponent<Expression>>(exprCase->GetMostSigOp().GetMostSigOp(),
-                *(Add<Expression> { exprCase->GetMostSigOp().GetLeastSigOp(), exprCase->GetLeastSigOp().GetLeastSigOp() }.Simplify()));
-        }
-    }
+        return nullptr;
+    }),
+    RuleTable<Multiply>::Make<Multiply<Real>>([](const auto& realCase) -> std::unique_ptr<Expression> {
+        const Real& multiplicand = realCase.GetMostSigOp();
+        const Real& multiplier = realCase.GetLeastSigOp();
+        return std::make_unique<Real>(multiplicand.GetValue() * multiplier.GetValue());
+    }),
+    // ab, for rational a and b, exactly
+    RuleTable<Multiply>::Make<Multiply<Rational>>([](const auto& rationalCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Rational>(rationalCase.GetMostSigOp().GetValue() * rationalCase.GetLeastSigOp().GetValue());
+    }),
+    // ab, for rational a and real b
+    RuleTable<Multiply>::Make<Multiply<Rational, Real>>([](const auto& mixedCase) -> std::unique_ptr<Expression> {
+        return std::make_unique<Real>(mixedCase.GetMostSigOp().GetValue().ToDouble() * mixedCase.GetLeastSigOp().GetValue());
+    }),
+    // 0x = 0 and 1x = x
+    RuleTable<Multiply>::Make<Multiply<Rational, Expression>>([](const auto& oneZeroCase) -> std::unique_ptr<Expression> {
+        const Fraction& multiplicand = oneZeroCase.GetMostSigOp().GetValue();
 
-    // a*x*x
-    if (auto exprCase = Multiply<Multiply<Expression>, Expression>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().Equals(exprCase->GetLeastSigOp())) {
-            return std::make_unique<Multiply<Expression, Expression>>(exprCase->GetMostSigOp().GetMostSigOp(),
-                Exponent<Expression> { exprCase->GetMostSigOp().GetLeastSigOp(), Real { 2.0 } });
+        if (multiplicand.IsZero()) {
+            return std::make_unique<Rational>();
         }
-    }
 
-    // a*x*b*x
-    if (auto exprCase = Multiply<Multiply<Expression>, Multiply<Expression>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().Equals(exprCase->GetLeastSigOp().GetLeastSigOp())) {
-            return std::make_unique<Multiply<Expression>>(
-                *(Multiply<Expression> { exprCase->GetMostSigOp().GetMostSigOp(), exprCase->GetLeastSigOp().GetMostSigOp() }.Simplify()),
-                *(Exponent<Expression> { exprCase->GetMostSigOp().GetLeastSigOp(), Real { 2.0 } }.Simplify()));
+        if (multiplicand == Fraction { 1 }) {
+            return oneZeroCase.GetLeastSigOp().Simplify();
         }
-    }
 
-    // a*x^n*x
-    if (auto exprCase = Multiply<Multiply<Expression, Exponent<Expression>>, Expression>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().GetMostSigOp().Equals(exprCase->GetLeastSigOp())) {
-            return std::make_unique<Multiply<Expression>>(exprCase->GetMostSigOp().GetMostSigOp(),
-                Exponent<Expression> { exprCase->GetMostSigOp().GetLeastSigOp().GetMostSigOp(),
-                    *(Add<Expression> { exprCase->GetMostSigOp().GetLeastSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()) });
-        }
-    }
+        return nullptr;
+    }),
+    RuleTable<Multiply>::Make<Multiply<Imaginary>>([](const auto&) -> std::unique_ptr<Expression> {
+        return std::make_unique<Real>(-1.0);
+    }),
+};
 
-    // a*x*x^n
-    if (auto exprCase = Multiply<Multiply<Expression>, Exponent<Expression>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().Equals(exprCase->GetLeastSigOp().GetMostSigOp())) {
-            return std::make_unique<Multiply<Expression>>(exprCase->GetMostSigOp().GetMostSigOp(),
-                Exponent<Expression> { exprCase->GetMostSigOp().GetLeastSigOp(),
-                    *(Add<Expression> { exprCase->GetLeastSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()) });
-        }
-        if (exprCase->GetMostSigOp().GetMostSigOp().Equals(exprCase->GetLeastSigOp().GetMostSigOp())) {
-            return std::make_unique<Multiply<Expression>>(exprCase->GetMostSigOp().GetLeastSigOp(),
-                Exponent<Expression> { exprCase->GetMostSigOp().GetMostSigOp(),
-                    *(Add<Expression> { exprCase->GetLeastSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()) });
-        }
-    }
+} // namespace
 
-    // a*x^n*b*x
-    if (auto exprCase = Multiply<Multiply<Expression>, Multiply<Expression, Exponent<Expression>>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().Equals(exprCase->GetLeastSigOp().GetLeastSigOp().GetMostSigOp())) {
-            return std::make_unique<Multiply<Expression>>(
-                *(Multiply<Expression> { exprCase->GetMostSigOp().GetMostSigOp(), exprCase->GetLeastSigOp().GetMostSigOp() }.Simplify()),
-                Exponent<Expression> { exprCase->GetMostSigOp().GetLeastSigOp(),
-                    *(Add<Expression> { exprCase->GetLeastSigOp().GetLeastSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()) });
-        }
-    }
+auto Multiply<Expression>::ComputeSimplified() const -> std::unique_ptr<Expression>
+{
+    auto simplifiedMultiplicand = mostSigOp->Simplify();
+    auto simplifiedMultiplier = leastSigOp->Simplify();
 
-    if (auto exprCase = Multiply<Multiply<Expression>, Multiply<Exponent<Expression>, Expression>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().Equals(exprCase->GetLeastSigOp().GetMostSigOp().GetMostSigOp())) {
-            return std::make_unique<Multiply<Expression>>(
-                *(Multiply<Expression> { exprCase->GetMostSigOp().GetMostSigOp(), exprCase->GetLeastSigOp().GetLeastSigOp() }.Simplify()),
-                Exponent<Expression> { exprCase->GetMostSigOp().GetLeastSigOp(),
-                    *(Add<Expression> { exprCase->GetLeastSigOp().GetMostSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()) });
-        }
-    }
+    Multiply simplifiedMultiply { std::move(simplifiedMultiplicand), std::move(simplifiedMultiplier) };
 
-    if (auto exprCase = Multiply<Multiply<Expression, Exponent<Expression>>, Multiply<Expression>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().GetMostSigOp().Equals(exprCase->GetLeastSigOp().GetLeastSigOp())) {
-            return std::make_unique<Multiply<Expression>>(
-                *(Multiply<Expression> { exprCase->GetMostSigOp().GetMostSigOp(), exprCase->GetLeastSigOp().GetLeastSigOp() }.Simplify()),
-                Exponent<Expression> { exprCase->GetLeastSigOp().GetLeastSigOp(),
-                    *(Add<Expression> { exprCase->GetMostSigOp().GetLeastSigOp().GetLeastSigOp(), Real { 1.0 } }.Simplify()) });
-        }
+    if (auto result = multiplyRules.Apply(simplifiedMultiply)) {
+        return result;
     }
 
-    // a*x^n*x^m
-    if (auto exprCase = Multiply<Multiply<Expression, Exponent<Expression>>, Exponent<Expression>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().GetMostSigOp().Equals(exprCase->GetLeastSigOp().GetLeastSigOp())) {
-            return std::make_unique<Multiply<Expression>>(
-                exprCase->GetMostSigOp().GetMostSigOp(),
-                Exponent<Expression> { exprCase->GetMostSigOp().GetLeastSigOp().GetMostSigOp(),
-                    *(Add<Expression> { exprCase->GetLeastSigOp().GetMostSigOp(), exprCase->GetMostSigOp().GetLeastSigOp().GetLeastSigOp() }.Simplify()) });
-        }
-    }
+    // combines like factors, such as a*x^n*b*x^m = ab*x^(n+m), however many factors there are
+    ProductNormalizer normalizer;
+    normalizer.MultiplyBy(simplifiedMultiply);
 
-    // a*x^n*b*x^m
-    if (auto exprCase = Multiply<Multiply<Expression, Exponent<Expression>>, Multiply<Expression, Exponent<Expression>>>::Specialize(simplifiedMultiply); exprCase != nullptr) {
-        if (exprCase->GetMostSigOp().GetLeastSigOp().GetMostSigOp().Equals(exprCase->GetLeastSigOp().GetLeastSigOp().GetMostSigOp())) {
-            return std::make_unique<Multiply<Expression>>(
-                *(Multiply<Expression> { exprCase->GetMostSigOp().GetMostSigOp(), exprCase->GetLeastSigOp().GetMostSigOp() }.Simplify()),
-                Exponent<Expression> { exprCase->GetMostSigOp().GetLeastSigOp().GetMostSigOp(),
-                    *(Add<Expression> { exprCase->GetLeastSigOp().GetLeastSigOp().GetLeastSigOp(), exprCase->GetMostSigOp().GetLeastSigOp().GetLeastSigOp() }.Simplify()) });
-        }
-    }
+    return normalizer.BuildProduct();
+}
 
-    // multiply add like terms
-    std::vector<std::unique_ptr<Expression>> multiplies;
-    std::vector<std::unique_ptr<Expression>> vals;
-    simplifiedMultiply.Flatten(multiplies);
-    for (const auto& multiplicand : multiplies) {
-        size_t i = 0;
-        if (auto real = Real::Specialize(*multiplicand); real != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Real::Specialize(*vals[i]); valI != nullptr) {
-                    vals[i] = Real { valI->GetValue() * real->GetValue() }.Generalize();
-                    break;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(multiplicand->Generalize());
-            }
-            continue;
-        }
-        // single i
-        if (auto img = Imaginary::Specialize(*multiplicand); img != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Exponent<Imaginary, Expression>::Specialize(*vals[i]); valI != nullptr) {
-                    vals[i] = Exponent<Expression> { Imaginary {}, *(Add<Expression> { valI->GetLeastSigOp(), Real { 1.0 } }.Simplify()) }.Generalize();
-                    break;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(Exponent<Expression> { Imaginary {}, Real { 1.0 } }.Generalize());
-            }
-            continue;
-        }
-        // i^n
-        if (auto img = Exponent<Imaginary, Expression>::Specialize(*multiplicand); img != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Exponent<Imaginary, Expression>::Specialize(*vals[i]); valI != nullptr) {
-                    vals[i] = Exponent<Expression> { Imaginary {}, *(Add<Expression> { valI->GetLeastSigOp(), img->GetLeastSigOp() }.Simplify()) }.Generalize();
-                    break;
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                // vals.push_back(Multiply<Expression> { img->GetMostSigOp(), Imaginary {} }.Generalize());
-                vals.push_back(img->Generalize());
-            }
-            continue;
-        }
-        // expr^n
-        if (auto expr = Exponent<Expression, Expression>::Specialize(*multiplicand); expr != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Exponent<Expression, Expression>::Specialize(*vals[i]); valI != nullptr) {
-                    if (valI->GetMostSigOp().Equals(expr->GetMostSigOp())) {
-                        vals[i] = Exponent<Expression> { valI->GetMostSigOp(), *(Add<Expression> { valI->GetLeastSigOp(), expr->GetLeastSigOp() }.Simplify()) }.Generalize();
-                        break;
-                    }
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                // vals.push_back(Multiply<Expression> { img->GetMostSigOp(), Imaginary {} }.Generalize());
-                vals.push_back(expr->Generalize());
-            }
-            continue;
-        }
-        // single expr
-        if (auto expr = Expression::Specialize(*multiplicand); expr != nullptr) {
-            for (; i < vals.size(); i++) {
-                if (auto valI = Exponent<Expression, Expression>::Specialize(*vals[i]); valI != nullptr) {
-                    if (valI->GetMostSigOp().Equals(*expr)) {
-                        vals[i] = Exponent<Expression> { valI->GetMostSigOp(), *(Add<Expression> { valI->GetLeastSigOp(), Real { 1.0 } }.Simplify()) }.Generalize();
-                        break;
-                    }
-                }
-            }
-            if (i >= vals.size()) {
-                // check to make sure it is one thing only
-                vals.push_back(Exponent<Expression> { *expr, Real { 1.0 } }.Generalize());
-            }
-            continue;
-        }
-    }
+auto Multiply<Expression>::CombineLikeFactors(const std::vector<std::unique_ptr<Expression>>& factors) -> std::vector<std::unique_ptr<Expression>>
+{
+    ProductNormalizer normalizer;
 
-    // makes all expr^1 into expr
-    for (auto& val : vals) {
-        if (auto exp = Exponent<Expression, Real>::Specialize(*val); exp != nullptr) {
-            if (exp->GetLeastSigOp().GetValue() == 1.0) {
-                val = exp->GetMostSigOp().Generalize();
-            }
-        }
-        if (auto mul = Multiply<Real, Expression>::Specialize(*val); mul != nullptr) {
-            if (mul->GetMostSigOp().GetValue() == 1.0) {
-                val = mul->GetLeastSigOp().Generalize();
-            }
-        }
+    for (const auto& factor : factors) {
+        normalizer.MultiplyBy(*factor);
     }
 
-    return BuildFromVector<Multiply>(vals);
-
-    // return simplifiedMultiply.Copy();
+    return normalizer.BuildFactors();
 }
 
-auto Multiply<Expression>::ToString() const -> std::string
+auto Multiply<Expression>::ComputeString() const -> std::string
 {
     return fmt::format("({} * {})", mostSigOp->ToString(), leastSigOp->ToString());
 }
 
-auto Multiply<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+auto Multiply<Expression>::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
 {
     std::unique_ptr<Expression> simplifiedMultiplicand, simplifiedMultiplier;
 
@@ -290,11 +122,11 @@ auto Multiply<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_p
     // While this task isn't actually parallelized, it exists as a prerequisite for check possible cases in parallel
     tf::Task simplifyTask = subflow.emplace([&simplifiedMultiply, &simplifiedMultiplicand, &simplifiedMultiplier](tf::Subflow&) {
         if (simplifiedMultiplicand) {
-            simplifiedMultiply.SetMostSigOp(*simplifiedMultiplicand);
+            simplifiedMultiply.SetMostSigOp(std::move(simplifiedMultiplicand));
         }
 
         if (simplifiedMultiplier) {
-            simplifiedMultiply.SetLeastSigOp(*simplifiedMultiplier);
+            simplifiedMultiply.SetLeastSigOp(std::move(simplifiedMultiplier));
         }
     });
 
@@ -340,41 +172,22 @@ auto Multiply<Expression>::Specialize(const Expression& other, tf::Subflow& subf
     return std::make_unique<Multiply>(dynamic_cast<const Multiply&>(*otherGeneralized));
 }
 
-auto Multiply<Expression>::Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression>
+auto Multiply<Expression>::ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression>
 {
     // Single integration variable
-    if (auto variable = Variable::Specialize(differentiationVariable); variable != nullptr) {
-        auto simplifiedMult = this->Simplify();
-
-        // Constant case - Constant number multiplied by differentiate
-        if (auto constant = Multiply<Real, Expression>::Specialize(*simplifiedMult); constant != nullptr) {
-            auto exp = constant->GetLeastSigOp().Copy();
-            auto num = constant->GetMostSigOp();
-            auto differentiate = (*exp).Differentiate(differentiationVariable);
-            if (auto add = Expression::Specialize(*differentiate); add != nullptr) {
-                return std::make_unique<Multiply<Real, Expression>>(Multiply<Real, Expression> { Real { num.GetValue() }, *(add->Simplify()) })->Simplify();
-            }
+    if (!differentiationVariable.Is<Variable>()) {
+        return Copy();
+    }
 
-        }
-        // Product rule: d/dx (f(x)*g(x)) = f'(x)*g(x) + f(x)*g'(x)
-        else if (auto product = Multiply<Expression, Expression>::Specialize(*simplifiedMult); product != nullptr) {
-            auto left = product->GetMostSigOp().Copy();
-            auto right = product->GetLeastSigOp().Copy();
-            auto ld = left->Differentiate(differentiationVariable);
-            auto rd = right->Differentiate(differentiationVariable);
-            auto add = Expression::Specialize(*ld);
-            auto add2 = Expression::Specialize(*rd);
-            if ((add != nullptr && add2 != nullptr)) {
-                return std::make_unique<Add<Multiply<Expression, Expression>,
-                    Multiply<Expression, Expression>>>(Add<Multiply<Expression, Expression>, Multiply<Expression, Expression>> { Multiply<Expression, Expression> { *add,
-                                                                                                                                     *right },
-                                                           Multiply<Expression, Expression> { *add2, *left } })
-                    ->Simplify();
-            }
-        }
+    // Constant case - Constant number multiplied by differentiate
+    if (auto constant = View<Multiply<Real, Expression>>::Specialize(*this)) {
+        return std::make_unique<Multiply<Expression>>(constant->GetMostSigOp().Copy(), derivatives.GetOperandAt(1).Copy());
     }
 
-    return Copy();
+    // Product rule: d/dx (f(x)*g(x)) = f'(x)*g(x) + f(x)*g'(x)
+    return std::make_unique<Add<Expression>>(
+        std::make_unique<Multiply<Expression>>(derivatives.GetOperandAt(0).Copy(), GetLeastSigOp().Copy()),
+        std::make_unique<Multiply<Expression>>(derivatives.GetOperandAt(1).Copy(), GetMostSigOp().Copy()));
 }
 
 } // Oasis
\ No newline at end of file
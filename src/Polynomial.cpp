@@ -0,0 +1,719 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Polynomial.hpp"
+#include "Oasis/PolynomialDivide.hpp"
+#include "Oasis/PolynomialMultiply.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Traversal.hpp"
+#include "Oasis/Variable.hpp"
+
+namespace Oasis {
+
+namespace {
+
+// Gets the value of a polynomial with no terms other than a constant term.
+auto GetConstant(const Polynomial& polynomial) -> std::optional<Fraction>
+{
+    const auto& terms = polynomial.GetTerms();
+
+    if (terms.empty()) {
+        return Fraction {};
+    }
+
+    if (terms.size() == 1 && terms.front().monomial == 0) {
+        return terms.front().coefficient;
+    }
+
+    return std::nullopt;
+}
+
+// Converts a coefficient into a number, which is a Real only if that is allowed and exact.
+auto ToNumber(const Fraction& value, bool rational) -> std::unique_ptr<Expression>
+{
+    if (!rational) {
+        const double approximation = value.ToDouble();
+
+        if (std::isfinite(approximation) && Fraction::FromDouble(approximation) == value) {
+            return std::make_unique<Real>(approximation);
+        }
+    }
+
+    return std::make_unique<Rational>(value);
+}
+
+// Gets the coefficients of a polynomial in at most one variable as integers, if each is an integer
+// that fits in 64 bits.
+auto GetIntegerCoefficients(const Polynomial& polynomial) -> std::optional<std::vector<std::int64_t>>
+{
+    const auto& terms = polynomial.GetTerms();
+
+    if (terms.empty()) {
+        return std::vector<std::int64_t> {};
+    }
+
+    std::vector<std::int64_t> coefficients(static_cast<std::size_t>(terms.front().monomial) + 1, 0);
+
+    for (const auto& [monomial, coefficient] : terms) {
+        if (!coefficient.IsInline() || !coefficient.IsInteger()) {
+            return std::nullopt;
+        }
+
+        coefficients[static_cast<std::size_t>(monomial)] = coefficient.GetNumerator().ToInt64();
+    }
+
+    return coefficients;
+}
+
+// Gets the coefficients of a polynomial in one variable as integers, if at least half of them are
+// nonzero, so that the dense kernels are worth their while.
+auto GetDenseIntegers(const Polynomial& polynomial) -> std::optional<std::vector<std::int64_t>>
+{
+    const auto& terms = polynomial.GetTerms();
+
+    if (terms.empty() || 2 * terms.size() < terms.front().monomial + 1) {
+        return std::nullopt;
+    }
+
+    return GetIntegerCoefficients(polynomial);
+}
+
+} // namespace
+
+Polynomial::Polynomial(std::vector<SymbolTable::Id> variables)
+    : variables(std::move(variables))
+{
+    const SymbolTable& symbols = SymbolTable::Global();
+
+    std::ranges::sort(this->variables, [&symbols](SymbolTable::Id lhs, SymbolTable::Id rhs) { return symbols.GetName(lhs) < symbols.GetName(rhs); });
+    this->variables.erase(std::ranges::unique(this->variables).begin(), this->variables.end());
+
+    if (this->variables.size() > MaxVariables) {
+        throw std::invalid_argument("Polynomial has too many variables.");
+    }
+}
+
+auto Polynomial::AddTerm(std::span<const std::uint32_t> exponents, const Fraction& coefficient) -> void
+{
+    assert(exponents.size() == variables.size());
+
+    if (coefficient.IsZero()) {
+        return;
+    }
+
+    terms.push_back({ Pack(exponents), coefficient });
+    Normalize();
+}
+
+auto Polynomial::AddTerm(std::span<const std::uint32_t> exponents, double coefficient) -> void
+{
+    AddTerm(exponents, Fraction::FromDouble(coefficient));
+}
+
+auto Polynomial::DivRem(const Polynomial& dividend, const Polynomial& divisor) -> std::pair<Polynomial, Polynomial>
+{
+    if (divisor.IsZero()) {
+        throw std::domain_error("Division by the zero polynomial.");
+    }
+
+    auto [lhs, rhs] = Unify(dividend, divisor);
+
+    Polynomial quotient;
+    quotient.variables = lhs.variables;
+    Polynomial remainder;
+    remainder.variables = lhs.variables;
+
+    // A monomial in one variable is its exponent, so the coefficients of long quotients by monic
+    // divisors with integer coefficients can come straight from `DivRemNewton`.
+    if (lhs.variables.size() == 1 && lhs.terms.size() > 0 && lhs.terms.front().monomial >= rhs.terms.front().monomial) {
+        const std::size_t quotientLength = static_cast<std::size_t>(lhs.terms.front().monomial - rhs.terms.front().monomial) + 1;
+        const std::size_t divisorLength = static_cast<std::size_t>(rhs.terms.front().monomial) + 1;
+        const Fraction& leading = rhs.terms.front().coefficient;
+
+        if (quotientLength >= NewtonDivisionThreshold && divisorLength >= NewtonDivisorThreshold && (leading == Fraction { 1 } || leading == Fraction { -1 })) {
+            const auto integerDividend = GetIntegerCoefficients(lhs);
+            const auto integerDivisor = GetIntegerCoefficients(rhs);
+            const auto result = integerDividend && integerDivisor ? DivRemNewton(*integerDividend, *integerDivisor) : std::nullopt;
+
+            if (result) {
+                const auto fill = [](Polynomial& polynomial, const std::vector<std::int64_t>& coefficients) {
+                    for (std::size_t i = coefficients.size(); i-- > 0;) {
+                        if (coefficients[i] != 0) {
+                            polynomial.terms.push_back({ i, Fraction { coefficients[i] } });
+                        }
+                    }
+                };
+
+                fill(quotient, result->first);
+                fill(remainder, result->second);
+                return { std::move(quotient), std::move(remainder) };
+            }
+        }
+    }
+
+    // The leading term of the divisor divides a monomial if subtracting it borrows from none of the
+    // guard bits, the most significant bits of the fields, which are clear in every monomial.
+    const unsigned width = lhs.GetFieldWidth();
+    Monomial guards = 0;
+
+    for (std::size_t i = 0; i < lhs.variables.size(); ++i) {
+        guards |= Monomial { 1 } << (i * width + width - 1);
+    }
+
+    const Term& lead = rhs.terms.front();
+    const std::span<const Term> tail { rhs.terms.begin() + 1, rhs.terms.end() };
+
+    // What remains of the dividend is kept in decreasing order of its monomials, so that each
+    // multiple of the divisor is subtracted term by term instead of by rebuilding all of it.
+    std::map<Monomial, Fraction, std::greater<>> rest;
+
+    for (auto& [monomial, coefficient] : lhs.terms) {
+        rest.emplace(monomial, std::move(coefficient));
+    }
+
+    while (!rest.empty()) {
+        // The leading term is removed rather than cancelled, since it would cancel exactly. Every
+        // other term of the multiple of the divisor is smaller.
+        auto top = rest.extract(rest.begin());
+        const Monomial difference = (top.key() | guards) - lead.monomial;
+
+        if ((difference & guards) != guards) {
+            remainder.terms.push_back({ top.key(), std::move(top.mapped()) });
+            continue;
+        }
+
+        const Term term { difference & ~guards, top.mapped() / lead.coefficient };
+
+        for (const auto& [monomial, coefficient] : tail) {
+            const Monomial product = term.monomial + monomial;
+
+            if (product & guards) {
+                throw std::overflow_error("Exponent does not fit in a monomial.");
+            }
+
+            const auto [entry, inserted] = rest.try_emplace(product);
+            entry->second = entry->second - term.coefficient * coefficient;
+
+            if (entry->second.IsZero()) {
+                rest.erase(entry);
+            }
+        }
+
+        quotient.terms.push_back(term);
+    }
+
+    return { std::move(quotient), std::move(remainder) };
+}
+
+auto Polynomial::FromConstant(const Fraction& value) -> Polynomial
+{
+    Polynomial result;
+    result.AddTerm({}, value);
+    return result;
+}
+
+auto Polynomial::FromConstant(double value) -> Polynomial
+{
+    return FromConstant(Fraction::FromDouble(value));
+}
+
+auto Polynomial::FromExpression(const Expression& expression) -> std::optional<Polynomial>
+{
+    std::vector<SymbolTable::Id> symbols;
+
+    PreOrder(expression, [&symbols](const Expression& node) {
+        if (node.Is<Variable>()) {
+            symbols.push_back(static_cast<const Variable&>(node).GetSymbol());
+        }
+
+        return true;
+    });
+
+    // Every intermediate polynomial is built over all of the variables, so no operation needs to
+    // convert its operands to a common set of variables.
+    const Polynomial zero { std::move(symbols) };
+    const std::vector<std::uint32_t> noExponents(zero.variables.size(), 0);
+
+    std::vector<Polynomial> results;
+    bool failed = false;
+
+    PostOrder(
+        expression,
+        [&failed](const Expression&) { return !failed; },
+        [&](const Expression& node) {
+            if (failed) {
+                return;
+            }
+
+            const std::size_t operandCount = node.GetOperandCount();
+            const auto operands = results.end() - static_cast<std::ptrdiff_t>(operandCount);
+            Polynomial result = zero;
+
+            switch (node.GetType()) {
+            case ExpressionType::Real: {
+                const double value = static_cast<const Real&>(node).GetValue();
+                failed = !std::isfinite(value);
+
+                if (!failed) {
+                    result.AddTerm(noExponents, value);
+                }
+                break;
+            }
+            case ExpressionType::Rational:
+                result.AddTerm(noExponents, static_cast<const Rational&>(node).GetValue());
+                break;
+            case ExpressionType::Variable: {
+                const auto variable = std::ranges::find(zero.variables, static_cast<const Variable&>(node).GetSymbol());
+                auto exponents = noExponents;
+                exponents[static_cast<std::size_t>(variable - zero.variables.begin())] = 1;
+                result.AddTerm(exponents, Fraction { 1 });
+                break;
+            }
+            case ExpressionType::Add:
+            case ExpressionType::Sum:
+                for (auto operand = operands; operand != results.end(); ++operand) {
+                    result = result + *operand;
+                }
+                break;
+            case ExpressionType::Subtract:
+                result = operands[0] - operands[1];
+                break;
+            case ExpressionType::Negate:
+                result = -operands[0];
+                break;
+            case ExpressionType::Multiply:
+            case ExpressionType::Product:
+                result = operands[0];
+
+                for (auto operand = operands + 1; operand != results.end(); ++operand) {
+                    result = result * *operand;
+                }
+                break;
+            case ExpressionType::Divide: {
+                const auto divisor = GetConstant(operands[1]);
+                failed = !divisor || divisor->IsZero();
+
+                if (!failed) {
+                    result = operands[0] * (Fraction { 1 } / *divisor);
+                }
+                break;
+            }
+            case ExpressionType::Exponent: {
+                const auto exponent = GetConstant(operands[1]);
+                failed = !exponent || !exponent->IsInteger() || exponent->IsNegative() || *exponent > Fraction { std::numeric_limits<std::uint32_t>::max() };
+
+                if (!failed) {
+                    result = operands[0].Pow(static_cast<std::uint32_t>(exponent->GetNumerator().ToInt64()));
+                }
+                break;
+            }
+            default:
+                failed = true;
+                break;
+            }
+
+            results.erase(operands, results.end());
+            results.push_back(std::move(result));
+        });
+
+    if (failed) {
+        return std::nullopt;
+    }
+
+    assert(results.size() == 1);
+    return std::move(results.back());
+}
+
+auto Polynomial::FromVariable(SymbolTable::Id variable) -> Polynomial
+{
+    Polynomial result { { variable } };
+    result.terms.push_back({ result.Pack(std::vector<std::uint32_t> { 1 }), Fraction { 1 } });
+    return result;
+}
+
+auto Polynomial::GetDenseCoefficients() const -> std::vector<double>
+{
+    const auto fractions = GetDenseFractions();
+
+    std::vector<double> coefficients;
+    coefficients.reserve(fractions.size());
+
+    for (const Fraction& fraction : fractions) {
+        coefficients.push_back(fraction.ToDouble());
+    }
+
+    return coefficients;
+}
+
+auto Polynomial::GetDenseFractions() const -> std::vector<Fraction>
+{
+    if (variables.size() > 1) {
+        throw std::logic_error("Polynomial has more than one variable.");
+    }
+
+    if (terms.empty()) {
+        return {};
+    }
+
+    // The first term has the highest degree.
+    std::vector<Fraction> coefficients(static_cast<std::size_t>(terms.front().monomial) + 1);
+
+    for (const auto& [monomial, coefficient] : terms) {
+        coefficients[static_cast<std::size_t>(monomial)] = coefficient;
+    }
+
+    return coefficients;
+}
+
+auto Polynomial::GetDegree() const -> long
+{
+    long degree = -1;
+
+    for (const auto& term : terms) {
+        long termDegree = 0;
+
+        for (const std::uint32_t exponent : GetExponents(term.monomial)) {
+            termDegree += exponent;
+        }
+
+        degree = std::max(degree, termDegree);
+    }
+
+    return degree;
+}
+
+auto Polynomial::GetExponents(Monomial monomial) const -> std::vector<std::uint32_t>
+{
+    const unsigned width = GetFieldWidth();
+    const Monomial mask = (Monomial { 1 } << width) - 1;
+
+    std::vector<std::uint32_t> exponents(variables.size());
+
+    for (std::size_t i = variables.size(); i-- > 0;) {
+        exponents[i] = static_cast<std::uint32_t>(monomial & mask);
+        monomial >>= width;
+    }
+
+    return exponents;
+}
+
+auto Polynomial::GetFieldWidth() const -> unsigned
+{
+    // A field is at most 33 bits wide, so that any exponent that fits in it also fits in 32 bits.
+    return variables.empty() ? 33 : std::min(33U, static_cast<unsigned>(64 / variables.size()));
+}
+
+auto Polynomial::GetTerms() const -> const std::vector<Term>&
+{
+    return terms;
+}
+
+auto Polynomial::GetVariables() const -> const std::vector<SymbolTable::Id>&
+{
+    return variables;
+}
+
+auto Polynomial::IsZero() const -> bool
+{
+    return terms.empty();
+}
+
+auto Polynomial::Normalize() -> void
+{
+    std::ranges::sort(terms, [](const Term& lhs, const Term& rhs) { return lhs.monomial > rhs.monomial; });
+
+    std::size_t size = 0;
+
+    for (std::size_t i = 0; i < terms.size(); ++i) {
+        if (size > 0 && terms[size - 1].monomial == terms[i].monomial) {
+            terms[size - 1].coefficient = terms[size - 1].coefficient + terms[i].coefficient;
+        } else {
+            terms[size++] = terms[i];
+        }
+    }
+
+    terms.resize(size);
+    std::erase_if(terms, [](const Term& term) { return term.coefficient.IsZero(); });
+}
+
+auto Polynomial::Pack(std::span<const std::uint32_t> exponents) const -> Monomial
+{
+    // The most significant bit of each field is kept clear, so that a carry out of the field when
+    // monomials are multiplied can be detected instead of corrupting the next field.
+    const unsigned width = GetFieldWidth();
+    const Monomial limit = Monomial { 1 } << (width - 1);
+
+    Monomial monomial = 0;
+
+    for (const std::uint32_t exponent : exponents) {
+        if (exponent >= limit) {
+            throw std::overflow_error("Exponent does not fit in a monomial.");
+        }
+
+        monomial = monomial << width | exponent;
+    }
+
+    return monomial;
+}
+
+auto Polynomial::Pow(std::uint32_t exponent) const -> Polynomial
+{
+    Polynomial result = FromConstant(Fraction { 1 }).WithVariables(variables);
+    Polynomial base = *this;
+
+    while (exponent > 0) {
+        if (exponent & 1) {
+            result = result * base;
+        }
+
+        exponent >>= 1;
+
+        if (exponent > 0) {
+            base = base * base;
+        }
+    }
+
+    return result;
+}
+
+auto Polynomial::ToExpression(bool rational) const -> std::unique_ptr<Expression>
+{
+    if (terms.empty()) {
+        return ToNumber({}, rational);
+    }
+
+    const SymbolTable& symbols = SymbolTable::Global();
+    std::vector<std::unique_ptr<Expression>> addends;
+    addends.reserve(terms.size());
+
+    for (const auto& [monomial, coefficient] : terms) {
+        std::vector<std::unique_ptr<Expression>> factors;
+        const auto exponents = GetExponents(monomial);
+
+        if (coefficient != Fraction { 1 } || monomial == 0) {
+            factors.push_back(ToNumber(coefficient, rational));
+        }
+
+        for (std::size_t i = 0; i < variables.size(); ++i) {
+            if (exponents[i] == 0) {
+                continue;
+            }
+
+            auto variable = std::make_unique<Variable>(symbols.GetName(variables[i]));
+
+            if (exponents[i] == 1) {
+                factors.push_back(std::move(variable));
+            } else {
+                factors.push_back(std::make_unique<Exponent<Expression>>(std::move(variable), std::make_unique<Real>(exponents[i])));
+            }
+        }
+
+        addends.push_back(factors.size() == 1 ? std::move(factors.front()) : BuildFromVector<Multiply>(std::move(factors)));
+    }
+
+    return addends.size() == 1 ? std::move(addends.front()) : BuildFromVector<Add>(std::move(addends));
+}
+
+auto Polynomial::Unify(const Polynomial& lhs, const Polynomial& rhs) -> std::pair<Polynomial, Polynomial>
+{
+    if (lhs.variables == rhs.variables) {
+        return { lhs, rhs };
+    }
+
+    std::vector<SymbolTable::Id> allVariables = lhs.variables;
+    allVariables.insert(allVariables.end(), rhs.variables.begin(), rhs.variables.end());
+
+    const std::vector<SymbolTable::Id> unified = Polynomial { std::move(allVariables) }.variables;
+    return { lhs.WithVariables(unified), rhs.WithVariables(unified) };
+}
+
+auto Polynomial::WithVariables(const std::vector<SymbolTable::Id>& newVariables) const -> Polynomial
+{
+    Polynomial result;
+    result.variables = newVariables;
+
+    if (newVariables == variables) {
+        result.terms = terms;
+        return result;
+    }
+
+    // The position of each of this polynomial's variables among the new variables.
+    std::vector<std::size_t> positions;
+    positions.reserve(variables.size());
+
+    for (const SymbolTable::Id variable : variables) {
+        const auto position = std::ranges::find(newVariables, variable);
+        assert(position != newVariables.end());
+        positions.push_back(static_cast<std::size_t>(position - newVariables.begin()));
+    }
+
+    result.terms.reserve(terms.size());
+    std::vector<std::uint32_t> newExponents(newVariables.size());
+
+    for (const auto& [monomial, coefficient] : terms) {
+        const auto exponents = GetExponents(monomial);
+        std::ranges::fill(newExponents, 0);
+
+        for (std::size_t i = 0; i < exponents.size(); ++i) {
+            newExponents[positions[i]] = exponents[i];
+        }
+
+        result.terms.push_back({ result.Pack(newExponents), coefficient });
+    }
+
+    result.Normalize();
+    return result;
+}
+
+auto Polynomial::operator+(const Polynomial& other) const -> Polynomial
+{
+    auto [lhs, rhs] = Unify(*this, other);
+
+    // Both sides are sorted, so they are merged in linear time.
+    Polynomial result;
+    result.variables = std::move(lhs.variables);
+    result.terms.reserve(lhs.terms.size() + rhs.terms.size());
+
+    auto left = lhs.terms.begin();
+    auto right = rhs.terms.begin();
+
+    while (left != lhs.terms.end() || right != rhs.terms.end()) {
+        if (right == rhs.terms.end() || (left != lhs.terms.end() && left->monomial > right->monomial)) {
+            result.terms.push_back(*left++);
+        } else if (left == lhs.terms.end() || right->monomial > left->monomial) {
+            result.terms.push_back(*right++);
+        } else {
+            if (Fraction sum = left->coefficient + right->coefficient; !sum.IsZero()) {
+                result.terms.push_back({ left->monomial, std::move(sum) });
+            }
+
+            ++left;
+            ++right;
+        }
+    }
+
+    return result;
+}
+
+auto Polynomial::operator-(const Polynomial& other) const -> Polynomial
+{
+    return *this + -other;
+}
+
+auto Polynomial::operator-() const -> Polynomial
+{
+    return *this * Fraction { -1 };
+}
+
+auto Polynomial::operator*(const Polynomial& other) const -> Polynomial
+{
+    auto [lhs, rhs] = Unify(*this, other);
+
+    // Dense polynomials in one variable with integer coefficients are multiplied exactly by the dense
+    // kernel, which is subquadratic for long operands.
+    if (lhs.variables.size() == 1) {
+        const auto lhsDense = GetDenseIntegers(lhs);
+        const auto rhsDense = GetDenseIntegers(rhs);
+
+        if (lhsDense && rhsDense && DenseProductFits(*lhsDense, *rhsDense)) {
+            const auto product = MultiplyDense(*lhsDense, *rhsDense);
+
+            if (product.size() - 1 >= Monomial { 1 } << (lhs.GetFieldWidth() - 1)) {
+                throw std::overflow_error("Exponent does not fit in a monomial.");
+            }
+
+            Polynomial result;
+            result.variables = std::move(lhs.variables);
+
+            for (std::size_t i = product.size(); i-- > 0;) {
+                if (product[i] != 0) {
+                    result.terms.push_back({ i, Fraction { product[i] } });
+                }
+            }
+
+            return result;
+        }
+    }
+
+    Monomial guards = 0;
+
+    if (!lhs.variables.empty()) {
+        const unsigned width = lhs.GetFieldWidth();
+
+        for (std::size_t i = 0; i < lhs.variables.size(); ++i) {
+            guards |= Monomial { 1 } << (i * width + width - 1);
+        }
+    }
+
+    std::unordered_map<Monomial, Fraction> products;
+    products.reserve(lhs.terms.size() * rhs.terms.size());
+
+    for (const auto& left : lhs.terms) {
+        for (const auto& right : rhs.terms) {
+            // The exponents are added field by field. A sum that does not fit in its field sets the
+            // field's most significant bit.
+            const Monomial monomial = left.monomial + right.monomial;
+
+            if (monomial & guards) {
+                throw std::overflow_error("Exponent does not fit in a monomial.");
+            }
+
+            Fraction& product = products[monomial];
+            product = product + left.coefficient * right.coefficient;
+        }
+    }
+
+    Polynomial result;
+    result.variables = std::move(lhs.variables);
+    result.terms.reserve(products.size());
+
+    for (auto& [monomial, coefficient] : products) {
+        if (!coefficient.IsZero()) {
+            result.terms.push_back({ monomial, std::move(coefficient) });
+        }
+    }
+
+    std::ranges::sort(result.terms, [](const Term& left, const Term& right) { return left.monomial > right.monomial; });
+    return result;
+}
+
+auto Polynomial::operator*(const Fraction& scalar) const -> Polynomial
+{
+    Polynomial result;
+    result.variables = variables;
+
+    if (scalar.IsZero()) {
+        return result;
+    }
+
+    result.terms = terms;
+
+    for (auto& term : result.terms) {
+        term.coefficient = term.coefficient * scalar;
+    }
+
+    return result;
+}
+
+auto Polynomial::operator*(double scalar) const -> Polynomial
+{
+    return *this * Fraction::FromDouble(scalar);
+}
+
+auto Polynomial::operator==(const Polynomial& other) const -> bool
+{
+    const auto [lhs, rhs] = Unify(*this, other);
+    return lhs.terms == rhs.terms;
+}
+
+} // Oasis
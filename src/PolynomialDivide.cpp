@@ -0,0 +1,241 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Oasis/PolynomialDivide.hpp"
+#include "Oasis/PolynomialMultiply.hpp"
+
+namespace Oasis {
+
+namespace {
+
+// Coefficients within this bound can be added or subtracted in pairs without overflowing.
+constexpr std::int64_t SafeMagnitude = std::int64_t { 1 } << 62;
+
+template <typename T>
+auto Trim(std::vector<T>& coefficients) -> void
+{
+    while (!coefficients.empty() && coefficients.back() == T {}) {
+        coefficients.pop_back();
+    }
+}
+
+template <typename T>
+auto Trimmed(std::span<const T> coefficients) -> std::span<const T>
+{
+    while (!coefficients.empty() && coefficients.back() == T {}) {
+        coefficients = coefficients.first(coefficients.size() - 1);
+    }
+
+    return coefficients;
+}
+
+auto IsSafe(std::int64_t value) -> bool
+{
+    return value > -SafeMagnitude && value < SafeMagnitude;
+}
+
+auto MultiplyChecked(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::optional<std::vector<std::int64_t>>
+{
+    if (!DenseProductFits(lhs, rhs)) {
+        return std::nullopt;
+    }
+
+    return MultiplyDense(lhs, rhs);
+}
+
+// Converts coefficients to integers, if each is an integer that a double represents exactly.
+auto ToIntegers(std::span<const double> coefficients) -> std::optional<std::vector<std::int64_t>>
+{
+    constexpr double limit = 9'007'199'254'740'992.0; // 2^53
+
+    std::vector<std::int64_t> integers;
+    integers.reserve(coefficients.size());
+
+    for (const double coefficient : coefficients) {
+        if (coefficient != std::trunc(coefficient) || std::abs(coefficient) > limit) {
+            return std::nullopt;
+        }
+
+        integers.push_back(static_cast<std::int64_t>(coefficient));
+    }
+
+    return integers;
+}
+
+auto ToDoubles(std::span<const std::int64_t> coefficients) -> std::vector<double>
+{
+    return { coefficients.begin(), coefficients.end() };
+}
+
+} // namespace
+
+auto DivRemDense(std::span<const double> dividend, std::span<const double> divisor) -> std::pair<std::vector<double>, std::vector<double>>
+{
+    dividend = Trimmed(dividend);
+    divisor = Trimmed(divisor);
+
+    if (divisor.empty()) {
+        throw std::domain_error("Division by the zero polynomial.");
+    }
+
+    const std::size_t quotientLength = dividend.size() < divisor.size() ? 0 : dividend.size() - divisor.size() + 1;
+
+    if (quotientLength >= NewtonDivisionThreshold && divisor.size() >= NewtonDivisorThreshold && std::abs(divisor.back()) == 1.0) {
+        const auto integerDividend = ToIntegers(dividend);
+        const auto integerDivisor = ToIntegers(divisor);
+
+        if (integerDividend && integerDivisor) {
+            if (const auto result = DivRemNewton(*integerDividend, *integerDivisor)) {
+                return { ToDoubles(result->first), ToDoubles(result->second) };
+            }
+        }
+    }
+
+    return DivRemSchoolbook(dividend, divisor);
+}
+
+auto DivRemSchoolbook(std::span<const double> dividend, std::span<const double> divisor) -> std::pair<std::vector<double>, std::vector<double>>
+{
+    dividend = Trimmed(dividend);
+    divisor = Trimmed(divisor);
+
+    if (divisor.empty()) {
+        throw std::domain_error("Division by the zero polynomial.");
+    }
+
+    std::vector<double> remainder { dividend.begin(), dividend.end() };
+
+    if (dividend.size() < divisor.size()) {
+        return { {}, std::move(remainder) };
+    }
+
+    std::vector<double> quotient(dividend.size() - divisor.size() + 1);
+
+    for (std::size_t k = quotient.size(); k-- > 0;) {
+        const double term = remainder[k + divisor.size() - 1] / divisor.back();
+
+        // The leading coefficient is cancelled exactly, whatever the rounding of the others.
+        remainder[k + divisor.size() - 1] = 0.0;
+
+        for (std::size_t i = 0; i + 1 < divisor.size(); ++i) {
+            remainder[k + i] -= term * divisor[i];
+        }
+
+        quotient[k] = term;
+    }
+
+    remainder.resize(divisor.size() - 1);
+    Trim(quotient);
+    Trim(remainder);
+
+    return { std::move(quotient), std::move(remainder) };
+}
+
+auto DivRemNewton(std::span<const std::int64_t> dividend, std::span<const std::int64_t> divisor) -> std::optional<std::pair<std::vector<std::int64_t>, std::vector<std::int64_t>>>
+{
+    dividend = Trimmed(dividend);
+    divisor = Trimmed(divisor);
+
+    if (divisor.empty() || (divisor.back() != 1 && divisor.back() != -1)) {
+        throw std::domain_error("Divisor must have a leading coefficient of 1 or -1.");
+    }
+
+    if (dividend.size() < divisor.size()) {
+        return std::pair { std::vector<std::int64_t> {}, std::vector<std::int64_t> { dividend.begin(), dividend.end() } };
+    }
+
+    // If a(x) = b(x) q(x) + r(x), with a of degree m + n and b of degree n, then reversing the
+    // coefficients gives rev(a) = rev(b) rev(q) + x^(m + 1) rev(r), so rev(q) = rev(a) / rev(b) modulo
+    // x^(m + 1).
+    const std::size_t quotientLength = dividend.size() - divisor.size() + 1;
+    const std::vector<std::int64_t> reversedDivisor { divisor.rbegin(), divisor.rend() };
+    const auto reciprocal = InvertSeries(reversedDivisor, quotientLength);
+
+    if (!reciprocal) {
+        return std::nullopt;
+    }
+
+    const std::vector<std::int64_t> reversedDividend { dividend.rbegin(), dividend.rbegin() + static_cast<std::ptrdiff_t>(quotientLength) };
+    auto quotient = MultiplyChecked(reversedDividend, *reciprocal);
+
+    if (!quotient) {
+        return std::nullopt;
+    }
+
+    quotient->resize(quotientLength);
+    std::ranges::reverse(*quotient);
+
+    const auto product = MultiplyChecked(divisor, *quotient);
+
+    if (!product) {
+        return std::nullopt;
+    }
+
+    // The terms of the product of degree n and higher equal those of the dividend.
+    std::vector<std::int64_t> remainder(divisor.size() - 1);
+
+    for (std::size_t i = 0; i < remainder.size(); ++i) {
+        if (!IsSafe(dividend[i]) || !IsSafe((*product)[i])) {
+            return std::nullopt;
+        }
+
+        remainder[i] = dividend[i] - (*product)[i];
+    }
+
+    Trim(*quotient);
+    Trim(remainder);
+
+    return std::pair { std::move(*quotient), std::move(remainder) };
+}
+
+auto InvertSeries(std::span<const std::int64_t> coefficients, std::size_t length) -> std::optional<std::vector<std::int64_t>>
+{
+    if (coefficients.empty() || (coefficients.front() != 1 && coefficients.front() != -1)) {
+        throw std::domain_error("Power series must have a constant term of 1 or -1.");
+    }
+
+    if (length == 0) {
+        return std::vector<std::int64_t> {};
+    }
+
+    // 1 / 1 = 1 and 1 / -1 = -1.
+    std::vector<std::int64_t> reciprocal { coefficients.front() };
+
+    // If g f = 1 + x^k e modulo x^2k, then g (1 - x^k e) f = 1 modulo x^2k, so the next k
+    // coefficients of the reciprocal are those of -g e.
+    while (reciprocal.size() < length) {
+        const std::size_t known = reciprocal.size();
+        const std::size_t next = std::min(2 * known, length);
+
+        const auto product = MultiplyChecked(coefficients.first(std::min(coefficients.size(), next)), reciprocal);
+
+        if (!product) {
+            return std::nullopt;
+        }
+
+        std::vector<std::int64_t> error { product->begin() + static_cast<std::ptrdiff_t>(std::min(known, product->size())), product->begin() + static_cast<std::ptrdiff_t>(std::min(next, product->size())) };
+        Trim(error);
+
+        if (error.empty()) {
+            reciprocal.resize(next, 0);
+            continue;
+        }
+
+        const auto correction = MultiplyChecked(reciprocal, error);
+
+        if (!correction) {
+            return std::nullopt;
+        }
+
+        reciprocal.resize(next, 0);
+
+        for (std::size_t i = known; i < next && i - known < correction->size(); ++i) {
+            reciprocal[i] = -(*correction)[i - known];
+        }
+    }
+
+    return reciprocal;
+}
+
+} // Oasis
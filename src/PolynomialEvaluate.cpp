@@ -0,0 +1,39 @@
+#include <algorithm>
+#include <array>
+
+#include "Oasis/PolynomialEvaluate.hpp"
+
+namespace Oasis {
+
+auto EvaluateMultipoint(std::span<const double> coefficients, std::span<const double> points) -> std::vector<double>
+{
+    std::vector<double> values(points.size(), 0.0);
+
+    if (coefficients.empty()) {
+        return values;
+    }
+
+    for (std::size_t start = 0; start < points.size(); start += EvaluationBlockSize) {
+        const std::size_t count = std::min(EvaluationBlockSize, points.size() - start);
+
+        // A full block has a fixed length, which lets the compiler unroll and vectorize its loop.
+        std::array<double, EvaluationBlockSize> block {};
+        std::array<double, EvaluationBlockSize> results {};
+        std::copy_n(points.begin() + static_cast<std::ptrdiff_t>(start), count, block.begin());
+        results.fill(coefficients.back());
+
+        for (std::size_t i = coefficients.size() - 1; i-- > 0;) {
+            const double coefficient = coefficients[i];
+
+            for (std::size_t j = 0; j < EvaluationBlockSize; ++j) {
+                results[j] = results[j] * block[j] + coefficient;
+            }
+        }
+
+        std::copy_n(results.begin(), count, values.begin() + static_cast<std::ptrdiff_t>(start));
+    }
+
+    return values;
+}
+
+} // Oasis
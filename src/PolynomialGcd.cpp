@@ -0,0 +1,607 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "Oasis/BigInt.hpp"
+#include "Oasis/Fraction.hpp"
+#include "Oasis/PolynomialGcd.hpp"
+
+namespace Oasis {
+
+namespace {
+
+// The number of evaluation points the heuristic GCD tries before giving way to the subresultant
+// remainder sequence.
+constexpr int MaxHeuristicAttempts = 6;
+
+using Exponents = std::vector<std::uint32_t>;
+
+struct IntegerTerm {
+    Exponents exponents;
+    BigInt coefficient;
+};
+
+// A sparse polynomial with integer coefficients, whose terms have nonzero coefficients and are sorted
+// in decreasing lexicographic order of their exponents, like those of a Polynomial. The algorithms
+// below work on one variable at a time, from the first, and a polynomial at the level of a variable
+// involves only that variable and the ones after it, so its first term is of the highest degree in
+// that variable.
+using IntegerSparse = std::vector<IntegerTerm>;
+
+auto Normalize(IntegerSparse& polynomial) -> void
+{
+    std::ranges::sort(polynomial, std::ranges::greater {}, &IntegerTerm::exponents);
+    IntegerSparse merged;
+    merged.reserve(polynomial.size());
+
+    for (auto& term : polynomial) {
+        if (!merged.empty() && merged.back().exponents == term.exponents) {
+            merged.back().coefficient = merged.back().coefficient + term.coefficient;
+            continue;
+        }
+
+        if (!merged.empty() && merged.back().coefficient.IsZero()) {
+            merged.pop_back();
+        }
+
+        merged.push_back(std::move(term));
+    }
+
+    if (!merged.empty() && merged.back().coefficient.IsZero()) {
+        merged.pop_back();
+    }
+
+    polynomial = std::move(merged);
+}
+
+auto Constant(const BigInt& value, std::size_t width) -> IntegerSparse
+{
+    if (value.IsZero()) {
+        return {};
+    }
+
+    return { { Exponents(width, 0), value } };
+}
+
+auto IsConstant(const IntegerSparse& polynomial) -> bool
+{
+    return polynomial.empty() || (polynomial.size() == 1 && std::ranges::all_of(polynomial.front().exponents, [](std::uint32_t exponent) { return exponent == 0; }));
+}
+
+// Gets the degree of a polynomial at the level of a variable in that variable.
+auto Degree(const IntegerSparse& polynomial, std::size_t level) -> long
+{
+    return polynomial.empty() ? -1 : static_cast<long>(polynomial.front().exponents[level]);
+}
+
+auto Subtract(const IntegerSparse& lhs, const IntegerSparse& rhs) -> IntegerSparse
+{
+    IntegerSparse result;
+    result.reserve(lhs.size() + rhs.size());
+    auto left = lhs.begin();
+    auto right = rhs.begin();
+
+    while (left != lhs.end() || right != rhs.end()) {
+        if (right == rhs.end() || (left != lhs.end() && left->exponents > right->exponents)) {
+            result.push_back(*left++);
+        } else if (left == lhs.end() || right->exponents > left->exponents) {
+            result.push_back({ right->exponents, -right->coefficient });
+            ++right;
+        } else {
+            if (BigInt difference = left->coefficient - right->coefficient; !difference.IsZero()) {
+                result.push_back({ left->exponents, std::move(difference) });
+            }
+
+            ++left;
+            ++right;
+        }
+    }
+
+    return result;
+}
+
+// Multiplies a polynomial by a term, which keeps the order of its terms.
+auto MultiplyByTerm(const IntegerSparse& polynomial, const IntegerTerm& term) -> IntegerSparse
+{
+    IntegerSparse result;
+    result.reserve(polynomial.size());
+
+    for (const auto& [exponents, coefficient] : polynomial) {
+        IntegerTerm& product = result.emplace_back(IntegerTerm { exponents, coefficient * term.coefficient });
+        std::ranges::transform(product.exponents, term.exponents, product.exponents.begin(), std::plus {});
+    }
+
+    return result;
+}
+
+auto Multiply(const IntegerSparse& lhs, const IntegerSparse& rhs) -> IntegerSparse
+{
+    if (lhs.size() == 1) {
+        return MultiplyByTerm(rhs, lhs.front());
+    }
+
+    if (rhs.size() == 1) {
+        return MultiplyByTerm(lhs, rhs.front());
+    }
+
+    IntegerSparse result;
+    result.reserve(lhs.size() * rhs.size());
+
+    for (const auto& term : lhs) {
+        for (auto& product : MultiplyByTerm(rhs, term)) {
+            result.push_back(std::move(product));
+        }
+    }
+
+    Normalize(result);
+    return result;
+}
+
+auto Power(const IntegerSparse& base, long exponent, std::size_t width) -> IntegerSparse
+{
+    IntegerSparse result = Constant(1, width);
+
+    for (long i = 0; i < exponent; ++i) {
+        result = Multiply(result, base);
+    }
+
+    return result;
+}
+
+auto DivideScalar(IntegerSparse polynomial, const BigInt& divisor) -> IntegerSparse
+{
+    for (auto& term : polynomial) {
+        term.coefficient = term.coefficient / divisor;
+    }
+
+    return polynomial;
+}
+
+auto Negate(IntegerSparse polynomial) -> IntegerSparse
+{
+    for (auto& term : polynomial) {
+        term.coefficient = -term.coefficient;
+    }
+
+    return polynomial;
+}
+
+auto MakeLeadingPositive(IntegerSparse polynomial) -> IntegerSparse
+{
+    return !polynomial.empty() && polynomial.front().coefficient.IsNegative() ? Negate(std::move(polynomial)) : polynomial;
+}
+
+auto GetIntegerContent(const IntegerSparse& polynomial) -> BigInt
+{
+    BigInt content;
+
+    for (const auto& term : polynomial) {
+        content = BigInt::Gcd(content, term.coefficient);
+    }
+
+    return content;
+}
+
+auto GetMaxNorm(const IntegerSparse& polynomial) -> BigInt
+{
+    BigInt norm;
+
+    for (const auto& term : polynomial) {
+        norm = std::max(norm, term.coefficient.Abs());
+    }
+
+    return norm;
+}
+
+// Divides a polynomial by another if it divides it exactly. Each step cancels the first term of the
+// remainder, which must then be a multiple of the first term of the divisor. Since the terms of
+// the quotient of an exact division have no higher degree in any variable than the dividend less
+// the divisor, a term that does means the division is not exact, which also bounds the steps.
+auto DivideExact(const IntegerSparse& dividend, const IntegerSparse& divisor) -> std::optional<IntegerSparse>
+{
+    if (dividend.empty()) {
+        return IntegerSparse {};
+    }
+
+    const std::size_t width = divisor.front().exponents.size();
+    Exponents limits(width, 0);
+
+    for (std::size_t i = 0; i < width; ++i) {
+        const auto degree = [i](const IntegerSparse& polynomial) {
+            std::uint32_t result = 0;
+
+            for (const auto& term : polynomial) {
+                result = std::max(result, term.exponents[i]);
+            }
+
+            return result;
+        };
+
+        if (degree(dividend) < degree(divisor)) {
+            return std::nullopt;
+        }
+
+        limits[i] = degree(dividend) - degree(divisor);
+    }
+
+    IntegerSparse remainder = dividend;
+    IntegerSparse quotient;
+
+    while (!remainder.empty()) {
+        IntegerTerm term { Exponents(width, 0), {} };
+
+        for (std::size_t i = 0; i < width; ++i) {
+            if (remainder.front().exponents[i] < divisor.front().exponents[i] || remainder.front().exponents[i] - divisor.front().exponents[i] > limits[i]) {
+                return std::nullopt;
+            }
+
+            term.exponents[i] = remainder.front().exponents[i] - divisor.front().exponents[i];
+        }
+
+        auto [coefficient, rest] = BigInt::DivRem(remainder.front().coefficient, divisor.front().coefficient);
+
+        if (!rest.IsZero()) {
+            return std::nullopt;
+        }
+
+        term.coefficient = std::move(coefficient);
+        remainder = Subtract(remainder, MultiplyByTerm(divisor, term));
+        quotient.push_back(std::move(term));
+    }
+
+    return quotient;
+}
+
+// Gets the coefficient of a power of the variable at a level, as a polynomial in the variables after it.
+auto GetCoefficient(const IntegerSparse& polynomial, std::size_t level, long degree) -> IntegerSparse
+{
+    IntegerSparse coefficient;
+
+    for (const auto& term : polynomial) {
+        if (static_cast<long>(term.exponents[level]) == degree) {
+            coefficient.push_back(term);
+            coefficient.back().exponents[level] = 0;
+        }
+    }
+
+    return coefficient;
+}
+
+// Gets every nonzero coefficient of the powers of the variable at a level.
+auto GetCoefficients(const IntegerSparse& polynomial, std::size_t level) -> std::vector<IntegerSparse>
+{
+    std::vector<IntegerSparse> coefficients;
+
+    for (const auto& term : polynomial) {
+        if (coefficients.empty() || coefficients.back().front().exponents[level] != term.exponents[level]) {
+            coefficients.emplace_back();
+        }
+
+        coefficients.back().push_back(term);
+    }
+
+    for (auto& coefficient : coefficients) {
+        for (auto& term : coefficient) {
+            term.exponents[level] = 0;
+        }
+    }
+
+    return coefficients;
+}
+
+// Substitutes an integer for the variable at a level.
+auto Evaluate(const IntegerSparse& polynomial, std::size_t level, const BigInt& value) -> IntegerSparse
+{
+    std::vector<BigInt> powers { 1 };
+    IntegerSparse result;
+    result.reserve(polynomial.size());
+
+    for (const auto& [exponents, coefficient] : polynomial) {
+        while (powers.size() <= exponents[level]) {
+            powers.push_back(powers.back() * value);
+        }
+
+        IntegerTerm& term = result.emplace_back(IntegerTerm { exponents, coefficient * powers[exponents[level]] });
+        term.exponents[level] = 0;
+    }
+
+    Normalize(result);
+    return result;
+}
+
+// Recovers a polynomial from its value at an integer for the variable at a level, assuming its
+// coefficients are less than half of the integer in magnitude, from the digits of the value in the
+// integer as a base, taken between minus and plus half of the base.
+auto Interpolate(IntegerSparse value, std::size_t level, const BigInt& base) -> IntegerSparse
+{
+    const BigInt half = base / BigInt { 2 };
+    IntegerSparse result;
+
+    for (std::uint32_t power = 0; !value.empty(); ++power) {
+        IntegerSparse digit;
+
+        for (const auto& [exponents, coefficient] : value) {
+            BigInt remainder = coefficient % base;
+
+            if (remainder.IsNegative()) {
+                remainder = remainder + base;
+            }
+
+            if (remainder > half) {
+                remainder = remainder - base;
+            }
+
+            if (!remainder.IsZero()) {
+                digit.push_back({ exponents, std::move(remainder) });
+            }
+        }
+
+        value = DivideScalar(Subtract(value, digit), base);
+
+        for (auto& term : digit) {
+            term.exponents[level] = power;
+            result.push_back(std::move(term));
+        }
+    }
+
+    Normalize(result);
+    return result;
+}
+
+auto GcdAt(const IntegerSparse& lhs, const IntegerSparse& rhs, std::size_t level) -> IntegerSparse;
+
+// Gets the content of a polynomial in the variable at a level, the greatest common divisor of its
+// coefficients, as a polynomial in the variables after it.
+auto GetContentAt(const IntegerSparse& polynomial, std::size_t level) -> IntegerSparse
+{
+    IntegerSparse content;
+
+    for (const auto& coefficient : GetCoefficients(polynomial, level)) {
+        content = GcdAt(content, coefficient, level + 1);
+
+        if (IsConstant(content) && content.front().coefficient == BigInt { 1 }) {
+            break;
+        }
+    }
+
+    return content;
+}
+
+// Computes lc(rhs)^(deg lhs - deg rhs + 1) lhs modulo rhs, in the variable at a level, which
+// keeps the coefficients polynomials.
+auto PseudoRemainder(const IntegerSparse& lhs, const IntegerSparse& rhs, std::size_t level) -> IntegerSparse
+{
+    const std::size_t width = rhs.front().exponents.size();
+    const long degree = Degree(rhs, level);
+    const IntegerSparse lead = GetCoefficient(rhs, level, degree);
+    IntegerSparse remainder = lhs;
+    long steps = Degree(lhs, level) - degree + 1;
+
+    while (Degree(remainder, level) >= degree) {
+        const long shift = Degree(remainder, level) - degree;
+        IntegerSparse top = GetCoefficient(remainder, level, Degree(remainder, level));
+
+        for (auto& term : top) {
+            term.exponents[level] = static_cast<std::uint32_t>(shift);
+        }
+
+        remainder = Subtract(Multiply(remainder, lead), Multiply(top, rhs));
+        --steps;
+    }
+
+    return Multiply(remainder, Power(lead, steps, width));
+}
+
+// Finds the greatest common divisor of two nonzero polynomials by evaluating the variable at a
+// level at an integer, finding the greatest common divisor of the results, and recovering a
+// candidate from it by interpolation. A candidate that divides both polynomials is their greatest
+// common divisor, as long as the integer is more than twice the smallest of their largest
+// coefficients, which it always is.
+auto HeuristicGcd(const IntegerSparse& lhs, const IntegerSparse& rhs, std::size_t level) -> std::optional<IntegerSparse>
+{
+    const BigInt content = BigInt::Gcd(GetIntegerContent(lhs), GetIntegerContent(rhs));
+    const IntegerSparse first = DivideScalar(lhs, content);
+    const IntegerSparse second = DivideScalar(rhs, content);
+
+    BigInt base = std::min(GetMaxNorm(first), GetMaxNorm(second)) * BigInt { 2 } + BigInt { 29 };
+
+    for (int attempt = 0; attempt < MaxHeuristicAttempts; ++attempt) {
+        const IntegerSparse firstValue = Evaluate(first, level, base);
+        const IntegerSparse secondValue = Evaluate(second, level, base);
+
+        if (!firstValue.empty() && !secondValue.empty()) {
+            IntegerSparse candidate = Interpolate(GcdAt(firstValue, secondValue, level + 1), level, base);
+            candidate = MakeLeadingPositive(DivideScalar(candidate, GetIntegerContent(candidate)));
+
+            if (DivideExact(first, candidate) && DivideExact(second, candidate)) {
+                for (auto& term : candidate) {
+                    term.coefficient = term.coefficient * content;
+                }
+
+                return candidate;
+            }
+        }
+
+        // The base grows by about 2.73 times its fourth root, so that unlucky bases are not repeated.
+        base = base * BigInt { 73794 } * BigInt { 2 }.Pow(base.GetBitLength() / 4) / BigInt { 27011 };
+    }
+
+    return std::nullopt;
+}
+
+// Finds the greatest common divisor of two nonzero polynomials by the subresultant remainder
+// sequence in the variable at a level, after removing their contents in that variable. Dividing
+// each pseudo-remainder by a factor known from the earlier ones keeps its coefficients as small as
+// those of the subresultants, without computing its content.
+auto SubresultantGcd(const IntegerSparse& lhs, const IntegerSparse& rhs, std::size_t level) -> IntegerSparse
+{
+    const std::size_t width = lhs.front().exponents.size();
+    const IntegerSparse lhsContent = GetContentAt(lhs, level);
+    const IntegerSparse rhsContent = GetContentAt(rhs, level);
+    const IntegerSparse content = GcdAt(lhsContent, rhsContent, level + 1);
+
+    IntegerSparse first = DivideExact(lhs, lhsContent).value();
+    IntegerSparse second = DivideExact(rhs, rhsContent).value();
+
+    if (Degree(first, level) < Degree(second, level)) {
+        std::swap(first, second);
+    }
+
+    IntegerSparse lead = Constant(1, width);
+    IntegerSparse scale = Constant(1, width);
+
+    while (true) {
+        const long delta = Degree(first, level) - Degree(second, level);
+        IntegerSparse remainder = PseudoRemainder(first, second, level);
+
+        if (remainder.empty()) {
+            break;
+        }
+
+        // The primitive parts have no common factor that involves the variable.
+        if (Degree(remainder, level) == 0) {
+            second = Constant(1, width);
+            break;
+        }
+
+        first = std::move(second);
+        second = DivideExact(remainder, Multiply(lead, Power(scale, delta, width))).value();
+        lead = GetCoefficient(first, level, Degree(first, level));
+
+        if (delta > 0) {
+            scale = DivideExact(Power(lead, delta, width), Power(scale, delta - 1, width)).value();
+        }
+    }
+
+    return MakeLeadingPositive(Multiply(content, DivideExact(second, GetContentAt(second, level)).value()));
+}
+
+// Finds the greatest common divisor of two polynomials at a level, with a positive leading coefficient.
+auto GcdAt(const IntegerSparse& lhs, const IntegerSparse& rhs, std::size_t level) -> IntegerSparse
+{
+    if (lhs.empty() || rhs.empty()) {
+        return MakeLeadingPositive(lhs.empty() ? rhs : lhs);
+    }
+
+    const std::size_t width = lhs.front().exponents.size();
+
+    if (level == width) {
+        return Constant(BigInt::Gcd(lhs.front().coefficient, rhs.front().coefficient), width);
+    }
+
+    // A variable that neither polynomial involves has nothing to contribute.
+    if (Degree(lhs, level) == 0 && Degree(rhs, level) == 0) {
+        return GcdAt(lhs, rhs, level + 1);
+    }
+
+    if (auto gcd = HeuristicGcd(lhs, rhs, level)) {
+        return *gcd;
+    }
+
+    return SubresultantGcd(lhs, rhs, level);
+}
+
+auto GetAllVariables(const Polynomial& lhs, const Polynomial& rhs) -> std::vector<SymbolTable::Id>
+{
+    std::vector<SymbolTable::Id> variables = lhs.GetVariables();
+    variables.insert(variables.end(), rhs.GetVariables().begin(), rhs.GetVariables().end());
+    return Polynomial { std::move(variables) }.GetVariables();
+}
+
+// Converts a polynomial over some of the given variables to integer coefficients, by multiplying
+// it by the least common multiple of the denominators of its coefficients.
+auto ToIntegerSparse(const Polynomial& polynomial, const std::vector<SymbolTable::Id>& variables, BigInt& scale) -> IntegerSparse
+{
+    std::vector<std::size_t> positions;
+    positions.reserve(polynomial.GetVariables().size());
+
+    for (const SymbolTable::Id variable : polynomial.GetVariables()) {
+        positions.push_back(static_cast<std::size_t>(std::ranges::find(variables, variable) - variables.begin()));
+    }
+
+    scale = BigInt { 1 };
+
+    for (const auto& term : polynomial.GetTerms()) {
+        const BigInt denominator = term.coefficient.GetDenominator();
+        scale = scale / BigInt::Gcd(scale, denominator) * denominator;
+    }
+
+    IntegerSparse result;
+    result.reserve(polynomial.GetTerms().size());
+
+    for (const auto& [monomial, coefficient] : polynomial.GetTerms()) {
+        const auto exponents = polynomial.GetExponents(monomial);
+        IntegerTerm& term = result.emplace_back(IntegerTerm { Exponents(variables.size(), 0), coefficient.GetNumerator() * (scale / coefficient.GetDenominator()) });
+
+        for (std::size_t j = 0; j < exponents.size(); ++j) {
+            term.exponents[positions[j]] = exponents[j];
+        }
+    }
+
+    Normalize(result);
+    return result;
+}
+
+auto ToPolynomial(const IntegerSparse& polynomial, const std::vector<SymbolTable::Id>& variables, const Fraction& factor) -> Polynomial
+{
+    Polynomial result { variables };
+
+    for (const auto& [exponents, coefficient] : polynomial) {
+        result.AddTerm(exponents, Fraction { coefficient, 1 } * factor);
+    }
+
+    return result;
+}
+
+} // namespace
+
+auto Gcd(const Polynomial& lhs, const Polynomial& rhs) -> Polynomial
+{
+    const std::vector<SymbolTable::Id> variables = GetAllVariables(lhs, rhs);
+    BigInt lhsScale;
+    BigInt rhsScale;
+
+    IntegerSparse gcd = GcdAt(ToIntegerSparse(lhs, variables, lhsScale), ToIntegerSparse(rhs, variables, rhsScale), 0);
+
+    if (!gcd.empty()) {
+        gcd = DivideScalar(gcd, GetIntegerContent(gcd));
+    }
+
+    return ToPolynomial(gcd, variables, 1);
+}
+
+auto CancelCommonFactors(const Polynomial& numerator, const Polynomial& denominator) -> std::optional<std::pair<Polynomial, Polynomial>>
+{
+    if (numerator.IsZero() || denominator.IsZero()) {
+        return std::nullopt;
+    }
+
+    const std::vector<SymbolTable::Id> variables = GetAllVariables(numerator, denominator);
+    BigInt numeratorScale;
+    BigInt denominatorScale;
+
+    const IntegerSparse scaledNumerator = ToIntegerSparse(numerator, variables, numeratorScale);
+    const IntegerSparse scaledDenominator = ToIntegerSparse(denominator, variables, denominatorScale);
+    const IntegerSparse gcd = GcdAt(scaledNumerator, scaledDenominator, 0);
+
+    if (IsConstant(gcd)) {
+        return std::nullopt;
+    }
+
+    // The scaled numerator and denominator are the originals times their scales.
+    IntegerSparse reducedNumerator = DivideExact(scaledNumerator, gcd).value();
+    IntegerSparse reducedDenominator = DivideExact(scaledDenominator, gcd).value();
+    Fraction factor { denominatorScale, numeratorScale };
+
+    if (IsConstant(reducedDenominator)) {
+        factor = factor / Fraction { reducedDenominator.front().coefficient, 1 };
+        reducedDenominator = Constant(1, variables.size());
+    } else if (reducedDenominator.front().coefficient.IsNegative()) {
+        reducedNumerator = Negate(std::move(reducedNumerator));
+        reducedDenominator = Negate(std::move(reducedDenominator));
+    }
+
+    return std::pair { ToPolynomial(reducedNumerator, variables, factor), ToPolynomial(reducedDenominator, variables, 1) };
+}
+
+} // Oasis
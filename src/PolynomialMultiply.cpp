@@ -0,0 +1,354 @@
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#include "Oasis/PolynomialMultiply.hpp"
+
+namespace Oasis {
+
+namespace {
+
+// Every multiplication first checks that the exact product fits in 64 bits. Coefficients are then
+// multiplied as unsigned integers, which wrap modulo 2^64 instead of overflowing, so intermediate
+// results, such as the sums in Karatsuba's method, may wrap without affecting the product.
+using Wrapped = std::uint64_t;
+
+auto GetMagnitude(std::int64_t value) -> Wrapped
+{
+    return value < 0 ? Wrapped { 0 } - static_cast<Wrapped>(value) : static_cast<Wrapped>(value);
+}
+
+auto GetMaxMagnitude(std::span<const std::int64_t> coefficients) -> Wrapped
+{
+    Wrapped max = 0;
+
+    for (const std::int64_t coefficient : coefficients) {
+        max = std::max(max, GetMagnitude(coefficient));
+    }
+
+    return max;
+}
+
+auto CheckProductFits(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> void
+{
+    if (!DenseProductFits(lhs, rhs)) {
+        throw std::overflow_error("Polynomial product does not fit in 64 bits.");
+    }
+}
+
+auto Wrap(std::span<const std::int64_t> coefficients) -> std::vector<Wrapped>
+{
+    return { coefficients.begin(), coefficients.end() };
+}
+
+auto Unwrap(const std::vector<Wrapped>& coefficients) -> std::vector<std::int64_t>
+{
+    return { coefficients.begin(), coefficients.end() };
+}
+
+// Adds the product of a and b to out.
+auto AddSchoolbookProduct(std::span<const Wrapped> a, std::span<const Wrapped> b, std::span<Wrapped> out) -> void
+{
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        for (std::size_t j = 0; j < b.size(); ++j) {
+            out[i + j] += a[i] * b[j];
+        }
+    }
+}
+
+// Adds the product of a and b, which have the same length, to out.
+auto AddKaratsubaProduct(std::span<const Wrapped> a, std::span<const Wrapped> b, std::span<Wrapped> out) -> void
+{
+    const std::size_t n = a.size();
+
+    if (n < KaratsubaThreshold) {
+        AddSchoolbookProduct(a, b, out);
+        return;
+    }
+
+    // a = a0 + a1 x^h and b = b0 + b1 x^h, where the high halves are at least as long as the low.
+    const std::size_t h = n / 2;
+    const std::size_t high = n - h;
+
+    const auto a0 = a.first(h);
+    const auto a1 = a.subspan(h);
+    const auto b0 = b.first(h);
+    const auto b1 = b.subspan(h);
+
+    std::vector<Wrapped> low(2 * h - 1);
+    std::vector<Wrapped> top(2 * high - 1);
+    AddKaratsubaProduct(a0, b0, low);
+    AddKaratsubaProduct(a1, b1, top);
+
+    // (a0 + a1)(b0 + b1) - a0 b0 - a1 b1 = a0 b1 + a1 b0
+    std::vector<Wrapped> aSum(a1.begin(), a1.end());
+    std::vector<Wrapped> bSum(b1.begin(), b1.end());
+
+    for (std::size_t i = 0; i < h; ++i) {
+        aSum[i] += a0[i];
+        bSum[i] += b0[i];
+    }
+
+    std::vector<Wrapped> middle(2 * high - 1);
+    AddKaratsubaProduct(aSum, bSum, middle);
+
+    for (std::size_t i = 0; i < low.size(); ++i) {
+        middle[i] -= low[i];
+        out[i] += low[i];
+    }
+
+    for (std::size_t i = 0; i < top.size(); ++i) {
+        middle[i] -= top[i];
+        out[2 * h + i] += top[i];
+    }
+
+    for (std::size_t i = 0; i < middle.size(); ++i) {
+        out[h + i] += middle[i];
+    }
+}
+
+// Primes of the form c 2^k + 1 with a primitive root of 3, whose product exceeds 2^88.
+constexpr std::array<std::uint64_t, 3> NttPrimes { 998'244'353, 167'772'161, 469'762'049 };
+constexpr std::uint64_t NttRoot = 3;
+
+// The largest power of two that divides one less than each of the primes.
+constexpr std::size_t NttMaxLength = std::size_t { 1 } << 23;
+
+auto PowMod(std::uint64_t base, std::uint64_t exponent, std::uint64_t modulus) -> std::uint64_t
+{
+    std::uint64_t result = 1;
+    base %= modulus;
+
+    while (exponent > 0) {
+        if (exponent & 1) {
+            result = result * base % modulus;
+        }
+
+        base = base * base % modulus;
+        exponent >>= 1;
+    }
+
+    return result;
+}
+
+auto InvertMod(std::uint64_t value, std::uint64_t prime) -> std::uint64_t
+{
+    return PowMod(value, prime - 2, prime);
+}
+
+// Transforms values, whose length is a power of two, in place.
+auto TransformMod(std::vector<std::uint64_t>& values, bool inverse, std::uint64_t prime) -> void
+{
+    const std::size_t n = values.size();
+
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        std::size_t bit = n >> 1;
+
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+
+        j ^= bit;
+
+        if (i < j) {
+            std::swap(values[i], values[j]);
+        }
+    }
+
+    for (std::size_t length = 2; length <= n; length <<= 1) {
+        std::uint64_t step = PowMod(NttRoot, (prime - 1) / length, prime);
+
+        if (inverse) {
+            step = InvertMod(step, prime);
+        }
+
+        for (std::size_t start = 0; start < n; start += length) {
+            std::uint64_t twiddle = 1;
+
+            for (std::size_t i = 0; i < length / 2; ++i) {
+                const std::uint64_t u = values[start + i];
+                const std::uint64_t v = values[start + i + length / 2] * twiddle % prime;
+
+                values[start + i] = u + v < prime ? u + v : u + v - prime;
+                values[start + i + length / 2] = u >= v ? u - v : u + prime - v;
+                twiddle = twiddle * step % prime;
+            }
+        }
+    }
+
+    if (inverse) {
+        const std::uint64_t scale = InvertMod(n, prime);
+
+        for (auto& value : values) {
+            value = value * scale % prime;
+        }
+    }
+}
+
+auto MultiplyMod(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs, std::size_t length, std::uint64_t prime) -> std::vector<std::uint64_t>
+{
+    const auto reduce = [prime, length](std::span<const std::int64_t> coefficients) {
+        std::vector<std::uint64_t> reduced(length, 0);
+        const auto signedPrime = static_cast<std::int64_t>(prime);
+
+        for (std::size_t i = 0; i < coefficients.size(); ++i) {
+            reduced[i] = static_cast<std::uint64_t>((coefficients[i] % signedPrime + signedPrime) % signedPrime);
+        }
+
+        return reduced;
+    };
+
+    auto a = reduce(lhs);
+    auto b = reduce(rhs);
+
+    TransformMod(a, false, prime);
+    TransformMod(b, false, prime);
+
+    for (std::size_t i = 0; i < length; ++i) {
+        a[i] = a[i] * b[i] % prime;
+    }
+
+    TransformMod(a, true, prime);
+    return a;
+}
+
+} // namespace
+
+auto DenseProductFits(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> bool
+{
+    constexpr auto limit = static_cast<Wrapped>(std::numeric_limits<std::int64_t>::max());
+
+    const Wrapped lhsMax = GetMaxMagnitude(lhs);
+    const Wrapped rhsMax = GetMaxMagnitude(rhs);
+
+    if (lhsMax != 0 && rhsMax > limit / lhsMax) {
+        return false;
+    }
+
+    // Each coefficient of the product is the sum of at most n products of coefficients, where n is
+    // the length of the shorter operand.
+    const Wrapped termMax = lhsMax * rhsMax;
+    const Wrapped count = std::min(lhs.size(), rhs.size());
+
+    return termMax == 0 || count <= limit / termMax;
+}
+
+auto MultiplyDense(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::vector<std::int64_t>
+{
+    const std::size_t shorter = std::min(lhs.size(), rhs.size());
+
+    if (shorter < KaratsubaThreshold) {
+        return MultiplySchoolbook(lhs, rhs);
+    }
+
+    if (shorter < NttThreshold) {
+        return MultiplyKaratsuba(lhs, rhs);
+    }
+
+    return MultiplyNtt(lhs, rhs);
+}
+
+auto MultiplySchoolbook(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::vector<std::int64_t>
+{
+    if (lhs.empty() || rhs.empty()) {
+        return {};
+    }
+
+    CheckProductFits(lhs, rhs);
+
+    std::vector<Wrapped> product(lhs.size() + rhs.size() - 1, 0);
+    AddSchoolbookProduct(Wrap(lhs), Wrap(rhs), product);
+    return Unwrap(product);
+}
+
+auto MultiplyKaratsuba(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::vector<std::int64_t>
+{
+    if (lhs.empty() || rhs.empty()) {
+        return {};
+    }
+
+    CheckProductFits(lhs, rhs);
+
+    if (lhs.size() < rhs.size()) {
+        std::swap(lhs, rhs);
+    }
+
+    // The longer operand is split into pieces as long as the shorter, so that each piece is
+    // multiplied by operands of equal length.
+    const std::vector<Wrapped> shorter = Wrap(rhs);
+    const std::size_t m = shorter.size();
+
+    std::vector<Wrapped> product(lhs.size() + m - 1, 0);
+    std::vector<Wrapped> piece(m);
+
+    for (std::size_t start = 0; start < lhs.size(); start += m) {
+        const std::size_t count = std::min(m, lhs.size() - start);
+
+        std::ranges::fill(piece, 0);
+        std::copy_n(lhs.begin() + static_cast<std::ptrdiff_t>(start), count, piece.begin());
+
+        std::vector<Wrapped> pieceProduct(2 * m - 1, 0);
+        AddKaratsubaProduct(piece, shorter, pieceProduct);
+
+        // The padding of the last piece contributes nothing past the end of the product.
+        for (std::size_t i = 0; i < pieceProduct.size() && start + i < product.size(); ++i) {
+            product[start + i] += pieceProduct[i];
+        }
+    }
+
+    return Unwrap(product);
+}
+
+auto MultiplyNtt(std::span<const std::int64_t> lhs, std::span<const std::int64_t> rhs) -> std::vector<std::int64_t>
+{
+    if (lhs.empty() || rhs.empty()) {
+        return {};
+    }
+
+    CheckProductFits(lhs, rhs);
+
+    const std::size_t size = lhs.size() + rhs.size() - 1;
+
+    if (size > NttMaxLength) {
+        return MultiplyKaratsuba(lhs, rhs);
+    }
+
+    std::size_t length = 1;
+
+    while (length < size) {
+        length <<= 1;
+    }
+
+    const auto [p1, p2, p3] = NttPrimes;
+    const auto r1 = MultiplyMod(lhs, rhs, length, p1);
+    const auto r2 = MultiplyMod(lhs, rhs, length, p2);
+    const auto r3 = MultiplyMod(lhs, rhs, length, p3);
+
+    const std::uint64_t p1InverseModP2 = InvertMod(p1 % p2, p2);
+    const std::uint64_t p1p2InverseModP3 = InvertMod(p1 % p3 * (p2 % p3) % p3, p3);
+
+    std::vector<std::int64_t> product(size);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        // Garner's algorithm: x = t1 + t2 p1 + t3 p1 p2, with each digit reduced by its prime.
+        const std::uint64_t t1 = r1[i];
+        const std::uint64_t t2 = (r2[i] + p2 - t1 % p2) % p2 * p1InverseModP2 % p2;
+        const std::uint64_t partial = (t1 % p3 + p1 % p3 * t2) % p3;
+        const std::uint64_t t3 = (r3[i] + p3 - partial) % p3 * p1p2InverseModP3 % p3;
+
+        Wrapped value = t1 + t2 * p1 + t3 * p1 * p2;
+
+        // The product fits in 64 bits, so x is either small or within 2^63 of p1 p2 p3, in which
+        // case the coefficient is x - p1 p2 p3.
+        if (t3 > p3 / 2) {
+            value -= p1 * p2 * p3;
+        }
+
+        product[i] = static_cast<std::int64_t>(value);
+    }
+
+    return product;
+}
+
+} // Oasis
@@ -0,0 +1,323 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <stdexcept>
+
+#include <Eigen/Eigenvalues>
+
+#include "Oasis/PolynomialRoots.hpp"
+
+namespace Oasis {
+
+namespace {
+
+// The number of Newton steps after which a root that has not reached the tolerance is left as is.
+constexpr int MaxPolishingSteps = 32;
+
+// The number of sweeps after which Aberth-Ehrlich iteration gives way to the companion matrix.
+constexpr int MaxAberthSweeps = 100;
+
+// Balances a matrix by diagonal similarity transformations, which leave its eigenvalues unchanged,
+// so that each row has about the same norm as the corresponding column. The scale factors are
+// powers of two, so that balancing introduces no rounding errors.
+auto Balance(Eigen::MatrixXd& matrix) -> void
+{
+    constexpr double Radix = 2.0;
+    bool converged = false;
+
+    while (!converged) {
+        converged = true;
+
+        for (Eigen::Index i = 0; i < matrix.rows(); ++i) {
+            double column = matrix.col(i).cwiseAbs().sum() - std::abs(matrix(i, i));
+            const double row = matrix.row(i).cwiseAbs().sum() - std::abs(matrix(i, i));
+
+            if (column == 0.0 || row == 0.0) {
+                continue;
+            }
+
+            const double norm = column + row;
+            double factor = 1.0;
+
+            while (column < row / Radix) {
+                factor *= Radix;
+                column *= Radix * Radix;
+            }
+
+            while (column > row * Radix) {
+                factor /= Radix;
+                column /= Radix * Radix;
+            }
+
+            if ((column + row) / factor < 0.95 * norm) {
+                converged = false;
+                matrix.row(i) /= factor;
+                matrix.col(i) *= factor;
+            }
+        }
+    }
+}
+
+// Evaluates a polynomial and its derivative at a point by Horner's method.
+auto Evaluate(std::span<const double> coefficients, std::complex<double> point, std::complex<double>& derivative) -> std::complex<double>
+{
+    std::complex<double> value = coefficients.back();
+    derivative = 0.0;
+
+    for (std::size_t i = coefficients.size() - 1; i-- > 0;) {
+        derivative = derivative * point + value;
+        value = value * point + coefficients[i];
+    }
+
+    return value;
+}
+
+auto Polish(std::span<const double> coefficients, std::complex<double> root, double tolerance) -> std::complex<double>
+{
+    std::complex<double> derivative;
+    std::complex<double> value = Evaluate(coefficients, root, derivative);
+
+    for (int i = 0; i < MaxPolishingSteps && value != 0.0 && derivative != 0.0; ++i) {
+        const std::complex<double> step = value / derivative;
+        const std::complex<double> next = root - step;
+
+        std::complex<double> nextDerivative;
+        const std::complex<double> nextValue = Evaluate(coefficients, next, nextDerivative);
+
+        if (std::abs(nextValue) >= std::abs(value)) {
+            break;
+        }
+
+        root = next;
+        value = nextValue;
+        derivative = nextDerivative;
+
+        if (std::abs(step) <= tolerance * std::max(1.0, std::abs(root))) {
+            break;
+        }
+    }
+
+    return root;
+}
+
+// Bounds the rounding error of evaluating a polynomial at a point by Horner's method, relative to
+// the unit roundoff, by evaluating the polynomial with the magnitudes of its coefficients.
+auto GetEvaluationBound(std::span<const double> coefficients, double magnitude) -> double
+{
+    double bound = std::abs(coefficients.back());
+
+    for (std::size_t i = coefficients.size() - 1; i-- > 0;) {
+        bound = bound * magnitude + std::abs(coefficients[i]);
+    }
+
+    return bound;
+}
+
+// Finds the roots of a polynomial of positive degree by Aberth-Ehrlich iteration, which refines
+// every approximation at once with Newton's method, corrected by the repulsion of the others. Each
+// approximation is updated in place, so later ones in a sweep already see the updated ones. An
+// approximation stops moving once its step is within the tolerance, or once the polynomial
+// vanishes there to within rounding error, which is as close as a repeated root can be found.
+auto FindRootsAberth(std::span<const double> coefficients, double tolerance) -> std::optional<std::vector<std::complex<double>>>
+{
+    const std::size_t degree = coefficients.size() - 1;
+
+    // The starting points lie on a circle whose radius is the geometric mean of the magnitudes of
+    // the roots, rotated off the real axis so that no two start as complex conjugates.
+    const double radius = std::pow(std::abs(coefficients.front() / coefficients.back()), 1.0 / static_cast<double>(degree));
+    std::vector<std::complex<double>> roots;
+    roots.reserve(degree);
+
+    for (std::size_t k = 0; k < degree; ++k) {
+        roots.push_back(std::polar(radius, 2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(degree) + 0.4));
+    }
+
+    std::vector<bool> converged(degree, false);
+
+    for (int sweep = 0; sweep < MaxAberthSweeps; ++sweep) {
+        bool done = true;
+
+        for (std::size_t i = 0; i < degree; ++i) {
+            if (converged[i]) {
+                continue;
+            }
+
+            std::complex<double> derivative;
+            const std::complex<double> value = Evaluate(coefficients, roots[i], derivative);
+
+            if (std::abs(value) <= 4.0 * std::numeric_limits<double>::epsilon() * GetEvaluationBound(coefficients, std::abs(roots[i]))) {
+                converged[i] = true;
+                continue;
+            }
+
+            // The innermost loop computes 1 / d = conj(d) / |d|^2 on the parts of d, since complex
+            // division and std::norm guard against overflow with much slower code.
+            double repulsionReal = 0.0;
+            double repulsionImag = 0.0;
+
+            for (std::size_t j = 0; j < degree; ++j) {
+                if (j != i) {
+                    const double real = roots[i].real() - roots[j].real();
+                    const double imag = roots[i].imag() - roots[j].imag();
+                    const double inverseNorm = 1.0 / (real * real + imag * imag);
+                    repulsionReal += real * inverseNorm;
+                    repulsionImag -= imag * inverseNorm;
+                }
+            }
+
+            const std::complex<double> repulsion { repulsionReal, repulsionImag };
+
+            const std::complex<double> ratio = value / derivative;
+            const std::complex<double> step = ratio / (1.0 - ratio * repulsion);
+
+            if (!std::isfinite(step.real()) || !std::isfinite(step.imag())) {
+                return std::nullopt;
+            }
+
+            roots[i] -= step;
+            converged[i] = std::abs(step) <= tolerance * std::max(1.0, std::abs(roots[i]));
+            done = done && converged[i];
+        }
+
+        if (done) {
+            return roots;
+        }
+    }
+
+    return std::nullopt;
+}
+
+// Finds the roots of a polynomial of positive degree as the eigenvalues of its companion matrix.
+auto FindRootsCompanion(std::span<const double> coefficients) -> std::vector<std::complex<double>>
+{
+    const auto degree = static_cast<Eigen::Index>(coefficients.size() - 1);
+
+    // The companion matrix of the monic polynomial x^n + a_{n-1} x^{n-1} + ... + a_0 has ones on its
+    // subdiagonal and -a_0, ..., -a_{n-1} in its last column, and the polynomial is its
+    // characteristic polynomial.
+    Eigen::MatrixXd companion = Eigen::MatrixXd::Zero(degree, degree);
+    companion.diagonal(-1).setOnes();
+
+    for (Eigen::Index i = 0; i < degree; ++i) {
+        companion(i, degree - 1) = -coefficients[static_cast<std::size_t>(i)] / coefficients.back();
+    }
+
+    Balance(companion);
+
+    const Eigen::EigenSolver<Eigen::MatrixXd> solver { companion, false };
+
+    if (solver.info() != Eigen::Success) {
+        throw std::runtime_error("The eigenvalues of the companion matrix did not converge.");
+    }
+
+    return { solver.eigenvalues().begin(), solver.eigenvalues().end() };
+}
+
+// Makes roots found numerically for a polynomial with real coefficients come in exact complex
+// conjugate pairs, which rounding errors and the rotated starting points of the iteration break. A
+// root is snapped onto the real axis if its imaginary part is within the tolerance, or if the
+// polynomial vanishes at its real part to within rounding error, so that the real point is as good
+// a root. The other roots are reflected into the upper half plane and paired off, nearest first,
+// each pair becoming the mean of the two and its conjugate. A root left over without a partner
+// must be real, since the nonreal roots come in pairs.
+auto PairConjugates(std::span<const double> coefficients, std::vector<std::complex<double>> roots, double tolerance) -> std::vector<std::complex<double>>
+{
+    std::vector<std::complex<double>> result;
+    std::vector<std::complex<double>> upper;
+    result.reserve(roots.size());
+
+    for (const std::complex<double>& root : roots) {
+        const double real = root.real();
+        std::complex<double> derivative;
+
+        if (std::abs(root.imag()) <= tolerance * std::max(1.0, std::abs(root))
+            || std::abs(Evaluate(coefficients, real, derivative)) <= 4.0 * std::numeric_limits<double>::epsilon() * GetEvaluationBound(coefficients, std::abs(real))) {
+            result.emplace_back(real);
+        } else {
+            upper.emplace_back(real, std::abs(root.imag()));
+        }
+    }
+
+    // The farthest from the real axis are the surest to be nonreal, so they are paired first, and
+    // the one left over, if any, is the nearest to the real axis.
+    std::ranges::sort(upper, [](const std::complex<double>& lhs, const std::complex<double>& rhs) { return lhs.imag() > rhs.imag(); });
+    std::vector<bool> paired(upper.size(), false);
+
+    for (std::size_t i = 0; i < upper.size(); ++i) {
+        if (paired[i]) {
+            continue;
+        }
+
+        paired[i] = true;
+        std::optional<std::size_t> nearest;
+
+        for (std::size_t j = i + 1; j < upper.size(); ++j) {
+            if (!paired[j] && (!nearest || std::abs(upper[j] - upper[i]) < std::abs(upper[*nearest] - upper[i]))) {
+                nearest = j;
+            }
+        }
+
+        if (!nearest) {
+            result.emplace_back(upper[i].real());
+            continue;
+        }
+
+        paired[*nearest] = true;
+        const std::complex<double> mean = (upper[i] + upper[*nearest]) / 2.0;
+        result.push_back(mean);
+        result.push_back(std::conj(mean));
+    }
+
+    return result;
+}
+
+} // namespace
+
+auto FindRoots(std::span<const double> coefficients, double tolerance, bool polish) -> std::vector<std::complex<double>>
+{
+    while (!coefficients.empty() && coefficients.back() == 0.0) {
+        coefficients = coefficients.first(coefficients.size() - 1);
+    }
+
+    if (coefficients.empty()) {
+        throw std::domain_error("Every number is a root of the zero polynomial.");
+    }
+
+    // Each factor of x is a root at zero, which is exact, and which would only make the companion
+    // matrix singular.
+    std::vector<std::complex<double>> roots;
+
+    while (coefficients.size() > 1 && coefficients.front() == 0.0) {
+        roots.emplace_back(0.0);
+        coefficients = coefficients.subspan(1);
+    }
+
+    if (coefficients.size() > 1) {
+        auto found = FindRootsAberth(coefficients, tolerance);
+
+        if (!found) {
+            found = FindRootsCompanion(coefficients);
+        }
+
+        for (std::complex<double>& root : *found) {
+            if (polish) {
+                root = Polish(coefficients, root, tolerance);
+            }
+        }
+
+        // Newton's method keeps a real root real, so the snapped roots are polished once more.
+        for (const std::complex<double>& root : PairConjugates(coefficients, std::move(*found), tolerance)) {
+            roots.push_back(polish && root.imag() == 0.0 ? Polish(coefficients, root, tolerance) : root);
+        }
+    }
+
+    std::ranges::sort(roots, [](const std::complex<double>& lhs, const std::complex<double>& rhs) {
+        return lhs.real() != rhs.real() ? lhs.real() < rhs.real() : lhs.imag() < rhs.imag();
+    });
+
+    return roots;
+}
+
+} // Oasis
@@ -0,0 +1,79 @@
+#include <algorithm>
+
+#include "Oasis/Product.hpp"
+#include "Oasis/Sum.hpp"
+#include "Oasis/Variable.hpp"
+#include "Oasis/View.hpp"
+
+namespace Oasis {
+
+auto Product::ComputeSimplified() const -> std::unique_ptr<Expression>
+{
+    return Combine(SimplifyOperands());
+}
+
+auto Product::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+{
+    return Combine(SimplifyOperands(subflow));
+}
+
+auto Product::ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression>
+{
+    if (!differentiationVariable.Is<Variable>()) {
+        return Copy();
+    }
+
+    // Product rule: each term replaces one factor with its derivative.
+    std::vector<std::shared_ptr<Expression>> terms;
+    terms.reserve(operands.size());
+
+    for (std::size_t i = 0; i < operands.size(); ++i) {
+        auto factors = operands;
+        factors[i] = derivatives.GetSharedOperandAt(i);
+        terms.push_back(ExpressionArena::Share(std::make_unique<Product>(std::move(factors))));
+    }
+
+    return std::make_unique<Sum>(std::move(terms));
+}
+
+auto Product::ComputeString() const -> std::string
+{
+    std::string result = "(";
+
+    for (std::size_t i = 0; i < operands.size(); ++i) {
+        result += i == 0 ? "" : " * ";
+        result += operands[i]->ToString();
+    }
+
+    return result + ")";
+}
+
+auto Product::Combine(std::vector<std::unique_ptr<Expression>> simplified) -> std::unique_ptr<Expression>
+{
+    auto factors = Multiply<Expression>::CombineLikeFactors(SpliceOperands(simplified));
+
+    const auto isReal = [](const std::unique_ptr<Expression>& factor, double value) {
+        const auto real = View<Real>::Specialize(*factor);
+        return real && real->Get().GetValue() == value;
+    };
+
+    // x * 0 = 0
+    if (std::any_of(factors.begin(), factors.end(), [&isReal](const auto& factor) { return isReal(factor, 0.0); })) {
+        return std::make_unique<Real>(0.0);
+    }
+
+    // x * 1 = x
+    std::erase_if(factors, [&isReal](const auto& factor) { return isReal(factor, 1.0); });
+
+    if (factors.empty()) {
+        return std::make_unique<Real>(1.0);
+    }
+
+    if (factors.size() == 1) {
+        return std::move(factors.front());
+    }
+
+    return std::make_unique<Product>(factors);
+}
+
+} // Oasis
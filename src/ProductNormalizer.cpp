@@ -0,0 +1,306 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "Oasis/Add.hpp"
+#include "Oasis/CanonicalOrder.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Imaginary.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/ProductNormalizer.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/View.hpp"
+
+namespace Oasis {
+
+namespace {
+
+// Sums simplified exponents and a real exponent.
+auto SumExponents(const std::vector<const Expression*>& exponents, double realExponent) -> std::unique_ptr<Expression>
+{
+    std::vector<std::unique_ptr<Expression>> terms;
+    terms.reserve(exponents.size() + 1);
+
+    for (const Expression* exponent : exponents) {
+        terms.push_back(exponent->Copy());
+    }
+
+    if (realExponent != 0.0) {
+        terms.push_back(std::make_unique<Real>(realExponent));
+    }
+
+    if (terms.size() == 1) {
+        return std::move(terms.front());
+    }
+
+    return BuildFromVector<Add>(std::move(terms))->Simplify();
+}
+
+auto Raise(const Expression& base, std::unique_ptr<Expression> exponent) -> std::unique_ptr<Expression>
+{
+    if (const auto real = View<Real>::Specialize(*exponent); real && real->Get().GetValue() == 1.0) {
+        return base.Copy();
+    }
+
+    return std::make_unique<Exponent<Expression>>(base.Copy(), std::move(exponent));
+}
+
+auto Negate(std::unique_ptr<Expression> exponent) -> std::unique_ptr<Expression>
+{
+    if (const auto real = View<Real>::Specialize(*exponent)) {
+        return std::make_unique<Real>(-real->Get().GetValue());
+    }
+
+    return Multiply<Expression> { std::make_unique<Real>(-1.0), std::move(exponent) }.Simplify();
+}
+
+} // namespace
+
+auto ProductNormalizer::Coefficient::IsOne() const -> bool
+{
+    return exact && !inexact ? *exact == Fraction { 1 } : value == 1.0;
+}
+
+auto ProductNormalizer::Coefficient::IsZero() const -> bool
+{
+    return exact && !inexact ? exact->IsZero() : value == 0.0;
+}
+
+auto ProductNormalizer::Coefficient::Negate() -> void
+{
+    value = -value;
+
+    if (exact) {
+        exact = -*exact;
+    }
+}
+
+auto ProductNormalizer::Coefficient::ToExpression() const -> std::unique_ptr<Expression>
+{
+    if (exact && !inexact) {
+        return std::make_unique<Rational>(*exact);
+    }
+
+    return std::make_unique<Real>(value);
+}
+
+auto ProductNormalizer::MultiplyBy(const Expression& factor) -> void
+{
+    Gather(factor, false);
+}
+
+auto ProductNormalizer::DivideBy(const Expression& factor) -> void
+{
+    Gather(factor, true);
+}
+
+auto ProductNormalizer::Gather(const Expression& factor, bool inverse) -> void
+{
+    std::vector<const Expression*> stack { &factor };
+
+    while (!stack.empty()) {
+        const Expression* node = stack.back();
+        stack.pop_back();
+
+        if (node->Is<Multiply>()) {
+            for (std::size_t i = node->GetOperandCount(); i-- > 0;) {
+                stack.push_back(&node->GetOperandAt(i));
+            }
+
+            continue;
+        }
+
+        if (const auto real = View<Real>::Specialize(*node)) {
+            coefficient.value = inverse ? coefficient.value / real->Get().GetValue() : coefficient.value * real->Get().GetValue();
+            coefficient.inexact = true;
+            continue;
+        }
+
+        if (node->Is<Rational>()) {
+            const Fraction& value = static_cast<const Rational&>(*node).GetValue();
+            coefficient.value = inverse ? coefficient.value / value.ToDouble() : coefficient.value * value.ToDouble();
+
+            // A quotient by zero has no exact value.
+            if (inverse && value.IsZero()) {
+                coefficient.inexact = true;
+            } else if (!coefficient.inexact) {
+                const Fraction exact = coefficient.exact.value_or(Fraction { 1 });
+                coefficient.exact = inverse ? exact / value : exact * value;
+            }
+
+            continue;
+        }
+
+        const Expression* base = node;
+        const Expression* exponent = nullptr;
+
+        if (const auto power = View<Exponent<Expression, Expression>>::Specialize(*node)) {
+            base = &power->GetMostSigOp();
+            exponent = &power->GetLeastSigOp();
+        }
+
+        auto& candidates = powersByHash[base->Hash()];
+        const auto like = std::ranges::find_if(candidates, [this, base](std::size_t i) { return powers[i].base->Equals(*base); });
+        std::size_t index;
+
+        if (like != candidates.end()) {
+            index = *like;
+        } else {
+            index = powers.size();
+            candidates.push_back(index);
+            powers.push_back({ base, 0.0, {}, {} });
+        }
+
+        Power& power = powers[index];
+        const double sign = inverse ? -1.0 : 1.0;
+
+        if (!exponent) {
+            power.realExponent += sign;
+        } else if (const auto realExponent = View<Real>::Specialize(*exponent)) {
+            power.realExponent += sign * realExponent->Get().GetValue();
+        } else {
+            (inverse ? power.inverseExponents : power.exponents).push_back(exponent);
+        }
+    }
+}
+
+auto ProductNormalizer::Normalize(Coefficient& normalizedCoefficient) const -> std::vector<Factor>
+{
+    normalizedCoefficient = coefficient;
+
+    std::vector<std::size_t> order(powers.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, [this](std::size_t lhs, std::size_t rhs) { return CompareCanonical(*powers[lhs].base, *powers[rhs].base) < 0; });
+
+    std::vector<Factor> factors;
+    factors.reserve(powers.size());
+
+    for (const std::size_t index : order) {
+        const Power& power = powers[index];
+        std::unique_ptr<Expression> exponent;
+        bool inverted = false;
+
+        if (power.exponents.empty() && power.inverseExponents.empty()) {
+            inverted = power.realExponent < 0.0;
+            exponent = std::make_unique<Real>(std::abs(power.realExponent));
+        } else if (power.inverseExponents.empty()) {
+            exponent = SumExponents(power.exponents, power.realExponent);
+        } else if (power.exponents.empty() && power.realExponent <= 0.0) {
+            inverted = true;
+            exponent = SumExponents(power.inverseExponents, -power.realExponent);
+        } else {
+            exponent = Subtract<Expression> { SumExponents(power.exponents, power.realExponent), SumExponents(power.inverseExponents, 0.0) }.Simplify();
+
+            if (const auto real = View<Real>::Specialize(*exponent); real && real->Get().GetValue() < 0.0) {
+                inverted = true;
+                exponent = std::make_unique<Real>(-real->Get().GetValue());
+            }
+        }
+
+        const auto realExponent = View<Real>::Specialize(*exponent);
+
+        // x^0 = 1
+        if (realExponent && realExponent->Get().GetValue() == 0.0) {
+            continue;
+        }
+
+        // i^2 = -1, so i^n is one of 1, i, -1 or -i
+        if (realExponent && power.base->Is<Imaginary>() && std::trunc(realExponent->Get().GetValue()) == realExponent->Get().GetValue()) {
+            const double signedExponent = inverted ? -realExponent->Get().GetValue() : realExponent->Get().GetValue();
+            const double residue = signedExponent - 4.0 * std::floor(signedExponent / 4.0);
+
+            if (residue >= 2.0) {
+                normalizedCoefficient.Negate();
+            }
+
+            if (residue == 1.0 || residue == 3.0) {
+                factors.push_back({ power.base, std::make_unique<Real>(1.0), false });
+            }
+
+            continue;
+        }
+
+        factors.push_back({ power.base, std::move(exponent), inverted });
+    }
+
+    return factors;
+}
+
+auto ProductNormalizer::BuildFactors() const -> std::vector<std::unique_ptr<Expression>>
+{
+    Coefficient normalizedCoefficient;
+    auto factors = Normalize(normalizedCoefficient);
+
+    std::vector<std::unique_ptr<Expression>> result;
+    result.reserve(factors.size() + 1);
+
+    if (normalizedCoefficient.IsZero()) {
+        result.push_back(normalizedCoefficient.ToExpression());
+        return result;
+    }
+
+    if (!normalizedCoefficient.IsOne() || factors.empty()) {
+        result.push_back(normalizedCoefficient.ToExpression());
+    }
+
+    for (auto& factor : factors) {
+        result.push_back(Raise(*factor.base, factor.inverted ? Negate(std::move(factor.exponent)) : std::move(factor.exponent)));
+    }
+
+    return result;
+}
+
+auto ProductNormalizer::BuildProduct() const -> std::unique_ptr<Expression>
+{
+    auto factors = BuildFactors();
+
+    if (factors.size() == 1) {
+        return std::move(factors.front());
+    }
+
+    return BuildFromVector<Multiply>(std::move(factors));
+}
+
+auto ProductNormalizer::BuildQuotient() const -> std::unique_ptr<Expression>
+{
+    Coefficient normalizedCoefficient;
+    auto factors = Normalize(normalizedCoefficient);
+
+    if (normalizedCoefficient.IsZero()) {
+        return normalizedCoefficient.ToExpression();
+    }
+
+    std::vector<std::unique_ptr<Expression>> dividend;
+    std::vector<std::unique_ptr<Expression>> divisor;
+
+    if (!normalizedCoefficient.IsOne()) {
+        dividend.push_back(normalizedCoefficient.ToExpression());
+    }
+
+    for (auto& factor : factors) {
+        (factor.inverted ? divisor : dividend).push_back(Raise(*factor.base, std::move(factor.exponent)));
+    }
+
+    const auto build = [](std::vector<std::unique_ptr<Expression>>& operands) -> std::unique_ptr<Expression> {
+        if (operands.empty()) {
+            return std::make_unique<Real>(1.0);
+        }
+
+        if (operands.size() == 1) {
+            return std::move(operands.front());
+        }
+
+        return BuildFromVector<Multiply>(std::move(operands));
+    };
+
+    if (divisor.empty()) {
+        return build(dividend);
+    }
+
+    return std::make_unique<Divide<Expression>>(build(dividend), build(divisor));
+}
+
+} // Oasis
@@ -0,0 +1,53 @@
+#include <string>
+
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+
+namespace Oasis {
+
+Rational::Rational(Fraction value)
+    : value(std::move(value))
+{
+}
+
+Rational::Rational(std::int64_t numerator, std::int64_t denominator)
+    : value(numerator, denominator)
+{
+}
+
+auto Rational::ComputeDerivative(const Expression&, const Expression&) const -> std::unique_ptr<Expression>
+{
+    return std::make_unique<Real>(0);
+}
+
+auto Rational::ComputeHash() const -> std::size_t
+{
+    return CombineHash(Expression::ComputeHash(), value.Hash());
+}
+
+auto Rational::Equals(const Expression& other) const -> bool
+{
+    return other.Is<Rational>() && value == static_cast<const Rational&>(other).value;
+}
+
+auto Rational::GetValue() const -> const Fraction&
+{
+    return value;
+}
+
+auto Rational::ComputeString() const -> std::string
+{
+    return value.ToString();
+}
+
+auto Rational::Specialize(const Expression& other) -> std::unique_ptr<Rational>
+{
+    return other.Is<Rational>() ? std::make_unique<Rational>(static_cast<const Rational&>(other)) : nullptr;
+}
+
+auto Rational::Specialize(const Expression& other, tf::Subflow&) -> std::unique_ptr<Rational>
+{
+    return other.Is<Rational>() ? std::make_unique<Rational>(static_cast<const Rational&>(other)) : nullptr;
+}
+
+} // namespace Oasis
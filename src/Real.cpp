@@ -2,6 +2,7 @@
 // Created by Matthew McCall on 7/2/23.
 //
 
+#include <functional>
 #include <string>
 
 #include "Oasis/Real.hpp"
@@ -13,11 +14,17 @@ Real::Real(double value)
 {
 }
 
-auto Real::Differentiate(const Expression&) -> std::unique_ptr<Expression>
+auto Real::ComputeDerivative(const Expression&, const Expression&) const -> std::unique_ptr<Expression>
 {
     return std::make_unique<Real>(0);
 }
 
+auto Real::ComputeHash() const -> std::size_t
+{
+    // Zero and negative zero compare equal, so they must hash equally.
+    return CombineHash(Expression::ComputeHash(), std::hash<double> {}(value == 0.0 ? 0.0 : value));
+}
+
 auto Real::Equals(const Expression& other) const -> bool
 {
     return other.Is<Real>() && value == dynamic_cast<const Real&>(other).value;
@@ -28,7 +35,7 @@ auto Real::GetValue() const -> double
     return value;
 }
 
-auto Real::ToString() const -> std::string
+auto Real::ComputeString() const -> std::string
 {
     return std::to_string(value);
 }
@@ -0,0 +1,290 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Oasis/IntegerPolynomial.hpp"
+#include "Oasis/RealRoots.hpp"
+
+namespace Oasis {
+
+namespace {
+
+auto Sign(const BigInt& value) -> int
+{
+    return value.IsZero() ? 0 : value.IsNegative() ? -1 : 1;
+}
+
+// Gets the sign of a polynomial at a rational point, exactly.
+auto SignAt(std::span<const BigInt> coefficients, const Fraction& point) -> int
+{
+    // q^n f(p/q) has the sign of f(p/q), since the denominator q is positive.
+    return Sign(EvaluateDense(coefficients, point.GetNumerator(), point.GetDenominator()));
+}
+
+// Divides a polynomial by its content, which, unlike taking its primitive part, keeps its sign.
+auto RemoveContent(std::vector<BigInt> coefficients) -> std::vector<BigInt>
+{
+    if (const BigInt content = GetContent(coefficients); !content.IsZero() && content != BigInt { 1 }) {
+        for (auto& coefficient : coefficients) {
+            coefficient = coefficient / content;
+        }
+    }
+
+    return coefficients;
+}
+
+// Computes a positive multiple of the remainder of lhs divided by rhs, where rhs is nonzero, so that
+// the signs of a Sturm sequence built from it are those of the sequence over the rationals.
+auto PositiveRemainder(std::span<const BigInt> lhs, std::span<const BigInt> rhs) -> std::vector<BigInt>
+{
+    std::vector<BigInt> remainder { lhs.begin(), lhs.end() };
+    const BigInt lead = rhs.back().Abs();
+    const bool negative = rhs.back().IsNegative();
+
+    while (remainder.size() >= rhs.size()) {
+        const BigInt divisor = BigInt::Gcd(remainder.back(), lead);
+        const BigInt scale = lead / divisor;
+        const BigInt factor = negative ? -(remainder.back() / divisor) : remainder.back() / divisor;
+        const std::size_t shift = remainder.size() - rhs.size();
+
+        for (auto& coefficient : remainder) {
+            coefficient = coefficient * scale;
+        }
+
+        for (std::size_t i = 0; i < rhs.size(); ++i) {
+            remainder[shift + i] = remainder[shift + i] - factor * rhs[i];
+        }
+
+        while (!remainder.empty() && remainder.back().IsZero()) {
+            remainder.pop_back();
+        }
+    }
+
+    return RemoveContent(std::move(remainder));
+}
+
+// The Sturm sequence of a square-free polynomial f is f, f', and then the negated remainder of each
+// two consecutive polynomials, until it is zero. The number of real roots in (a, b] is the number of
+// sign changes in the sequence at a, less the number at b.
+class SturmSequence {
+public:
+    explicit SturmSequence(std::vector<BigInt> polynomial)
+    {
+        sequence.push_back(std::move(polynomial));
+        sequence.push_back(RemoveContent(DifferentiateDense(sequence.front())));
+
+        while (true) {
+            std::vector<BigInt> remainder = PositiveRemainder(sequence[sequence.size() - 2], sequence.back());
+
+            if (remainder.empty()) {
+                break;
+            }
+
+            for (auto& coefficient : remainder) {
+                coefficient = -coefficient;
+            }
+
+            sequence.push_back(std::move(remainder));
+        }
+    }
+
+    [[nodiscard]] auto CountRoots(const Fraction& lower, const Fraction& upper) const -> std::size_t
+    {
+        return CountSignChanges(lower) - CountSignChanges(upper);
+    }
+
+    [[nodiscard]] auto GetPolynomial() const -> std::span<const BigInt>
+    {
+        return sequence.front();
+    }
+
+private:
+    // Zeros are skipped, so that a root at the point is counted as if the point were just above it.
+    [[nodiscard]] auto CountSignChanges(const Fraction& point) const -> std::size_t
+    {
+        std::size_t changes = 0;
+        int previous = 0;
+
+        for (const auto& polynomial : sequence) {
+            const int sign = SignAt(polynomial, point);
+
+            if (sign != 0) {
+                changes += previous != 0 && sign != previous;
+                previous = sign;
+            }
+        }
+
+        return changes;
+    }
+
+    std::vector<std::vector<BigInt>> sequence;
+};
+
+// Bounds the magnitudes of the roots of a polynomial by Cauchy's bound, 1 + max |a_i / a_n|.
+auto GetRootBound(std::span<const BigInt> coefficients) -> Fraction
+{
+    BigInt largest;
+
+    for (std::size_t i = 0; i + 1 < coefficients.size(); ++i) {
+        largest = std::max(largest, coefficients[i].Abs());
+    }
+
+    return Fraction { largest, coefficients.back().Abs() } + Fraction { 1 };
+}
+
+// Converts double coefficients to integer coefficients of a polynomial with the same roots, by
+// multiplying them by the least common multiple of their exact denominators, which are powers of two.
+auto ToIntegers(std::span<const double> coefficients) -> std::vector<BigInt>
+{
+    std::vector<Fraction> fractions;
+    fractions.reserve(coefficients.size());
+    BigInt denominator { 1 };
+
+    for (const double coefficient : coefficients) {
+        const Fraction& fraction = fractions.emplace_back(Fraction::FromDouble(coefficient));
+        denominator = std::max(denominator, fraction.GetDenominator());
+    }
+
+    std::vector<BigInt> integers;
+    integers.reserve(fractions.size());
+
+    for (const Fraction& fraction : fractions) {
+        integers.push_back(fraction.GetNumerator() * (denominator / fraction.GetDenominator()));
+    }
+
+    return integers;
+}
+
+// Repeated roots are roots of the square-free part, which has no repeated roots.
+auto GetSquareFreePart(std::span<const BigInt> polynomial) -> std::vector<BigInt>
+{
+    return DivideDenseExact(polynomial, GcdDense(polynomial, DifferentiateDense(polynomial)));
+}
+
+// Isolates the roots of a square-free polynomial, given by its Sturm sequence, in [lower, upper].
+auto IsolateSquareFreeRoots(const SturmSequence& sturm, const Fraction& lower, const Fraction& upper) -> std::vector<std::pair<Fraction, Fraction>>
+{
+    std::vector<std::pair<Fraction, Fraction>> intervals;
+
+    if (upper < lower) {
+        return intervals;
+    }
+
+    // A root at the lower end is not in (lower, upper], so it is checked on its own.
+    if (SignAt(sturm.GetPolynomial(), lower) == 0) {
+        intervals.emplace_back(lower, lower);
+    }
+
+    // Intervals are bisected from the left, so that their roots are found in ascending order.
+    std::vector<std::pair<Fraction, Fraction>> pending { { lower, upper } };
+
+    while (!pending.empty()) {
+        auto [from, to] = pending.back();
+        pending.pop_back();
+
+        const std::size_t count = sturm.CountRoots(from, to);
+
+        if (count == 0) {
+            continue;
+        }
+
+        if (count == 1) {
+            intervals.emplace_back(from, to);
+            continue;
+        }
+
+        const Fraction middle = (from + to) / Fraction { 2 };
+        pending.emplace_back(middle, to);
+        pending.emplace_back(from, middle);
+    }
+
+    return intervals;
+}
+
+} // namespace
+
+auto IsolateRealRoots(std::span<const BigInt> coefficients, const Fraction& lower, const Fraction& upper) -> std::vector<std::pair<Fraction, Fraction>>
+{
+    std::vector<BigInt> polynomial { coefficients.begin(), coefficients.end() };
+
+    while (!polynomial.empty() && polynomial.back().IsZero()) {
+        polynomial.pop_back();
+    }
+
+    if (polynomial.empty()) {
+        throw std::domain_error("Every number is a root of the zero polynomial.");
+    }
+
+    if (polynomial.size() == 1) {
+        return {};
+    }
+
+    return IsolateSquareFreeRoots(SturmSequence { GetSquareFreePart(polynomial) }, lower, upper);
+}
+
+auto FindRealRoots(std::span<const double> coefficients, double lower, double upper, double tolerance) -> std::vector<double>
+{
+    return FindRealRoots(ToIntegers(coefficients), lower, upper, tolerance);
+}
+
+auto FindRealRoots(std::span<const BigInt> coefficients, double lower, double upper, double tolerance) -> std::vector<double>
+{
+    std::vector<BigInt> polynomial { coefficients.begin(), coefficients.end() };
+
+    while (!polynomial.empty() && polynomial.back().IsZero()) {
+        polynomial.pop_back();
+    }
+
+    if (polynomial.empty()) {
+        throw std::domain_error("Every number is a root of the zero polynomial.");
+    }
+
+    if (!(tolerance > 0.0)) {
+        throw std::domain_error("The tolerance must be positive.");
+    }
+
+    if (polynomial.size() == 1 || upper < lower) {
+        return {};
+    }
+
+    // Infinite ends are replaced by a bound that every root lies strictly within.
+    const Fraction bound = GetRootBound(polynomial);
+    const Fraction from = std::isinf(lower) ? (lower < 0.0 ? -bound : bound) : Fraction::FromDouble(lower);
+    const Fraction to = std::isinf(upper) ? (upper < 0.0 ? -bound : bound) : Fraction::FromDouble(upper);
+    const Fraction width = Fraction::FromDouble(tolerance);
+
+    // The square-free part is found once, both to isolate the roots and to refine them.
+    const SturmSequence sturm { GetSquareFreePart(polynomial) };
+    const std::span<const BigInt> squareFree = sturm.GetPolynomial();
+    std::vector<double> roots;
+
+    for (auto [left, right] : IsolateSquareFreeRoots(sturm, from, to)) {
+        // The only root in (left, right] is simple, so the square-free part has the sign it has at
+        // the right end exactly at the points above the root. The right end is checked first, so
+        // that its sign is not zero.
+        const int rightSign = SignAt(squareFree, right);
+
+        if (rightSign == 0) {
+            left = right;
+        }
+
+        while (right - left > width) {
+            const Fraction middle = (left + right) / Fraction { 2 };
+            const int sign = SignAt(squareFree, middle);
+
+            if (sign == 0) {
+                left = right = middle;
+            } else if (sign == rightSign) {
+                right = middle;
+            } else {
+                left = middle;
+            }
+        }
+
+        roots.push_back(((left + right) / Fraction { 2 }).ToDouble());
+    }
+
+    return roots;
+}
+
+} // Oasis
@@ -0,0 +1,140 @@
+#include "Oasis/SimplifyCache.hpp"
+#include "Oasis/ExpressionArena.hpp"
+
+namespace {
+
+thread_local Oasis::SimplifyCache* scopedCache = nullptr;
+std::atomic<Oasis::SimplifyCache*> globalCache = nullptr;
+
+} // namespace
+
+namespace Oasis {
+
+SimplifyCache::Scope::Scope(SimplifyCache& cache)
+    : previous(scopedCache)
+{
+    scopedCache = &cache;
+}
+
+SimplifyCache::Scope::~Scope()
+{
+    scopedCache = previous;
+}
+
+SimplifyCache::SimplifyCache(std::size_t capacity)
+    : capacity(capacity)
+{
+}
+
+auto SimplifyCache::Clear() -> void
+{
+    std::lock_guard lock { mutex };
+
+    index.clear();
+    entries.clear();
+    hits = 0;
+    misses = 0;
+}
+
+auto SimplifyCache::Find(const Expression& expression) -> std::unique_ptr<Expression>
+{
+    std::lock_guard lock { mutex };
+
+    auto it = FindUnlocked(expression);
+
+    if (it == entries.end()) {
+        ++misses;
+        return nullptr;
+    }
+
+    ++hits;
+
+    // Move the entry to the front, where the most recently used entries are kept.
+    entries.splice(entries.begin(), entries, it);
+
+    // Copies share their operands, so this only copies the root of the simplified expression.
+    return it->simplified->Copy();
+}
+
+auto SimplifyCache::Insert(const Expression& expression, const Expression& simplified) -> void
+{
+    if (capacity == 0) {
+        return;
+    }
+
+    std::lock_guard lock { mutex };
+
+    // Another thread may have simplified the same expression in the meantime.
+    if (FindUnlocked(expression) != entries.end()) {
+        return;
+    }
+
+    if (entries.size() >= capacity) {
+        const Entry& oldest = entries.back();
+        auto [first, last] = index.equal_range(oldest.expression->Hash());
+
+        for (auto it = first; it != last; ++it) {
+            if (&*it->second == &oldest) {
+                index.erase(it);
+                break;
+            }
+        }
+
+        entries.pop_back();
+    }
+
+    entries.push_front({ expression.Copy(), simplified.Copy() });
+    index.emplace(expression.Hash(), entries.begin());
+}
+
+auto SimplifyCache::GetCapacity() const -> std::size_t
+{
+    return capacity;
+}
+
+auto SimplifyCache::GetHits() const -> std::size_t
+{
+    return hits;
+}
+
+auto SimplifyCache::GetMisses() const -> std::size_t
+{
+    return misses;
+}
+
+auto SimplifyCache::GetSize() const -> std::size_t
+{
+    std::lock_guard lock { mutex };
+    return entries.size();
+}
+
+auto SimplifyCache::GetCurrent() -> SimplifyCache*
+{
+    return scopedCache != nullptr ? scopedCache : globalCache.load(std::memory_order_acquire);
+}
+
+auto SimplifyCache::SetGlobal(SimplifyCache* cache) -> void
+{
+    globalCache.store(cache, std::memory_order_release);
+}
+
+auto SimplifyCache::IsCacheable(const Expression& expression) -> bool
+{
+    // Leaves simplify to copies of themselves, which is cheaper than a lookup.
+    return expression.GetOperandCount() > 0 && ExpressionArena::GetCurrent() == nullptr;
+}
+
+auto SimplifyCache::FindUnlocked(const Expression& expression) -> EntryList::iterator
+{
+    auto [first, last] = index.equal_range(expression.Hash());
+
+    for (auto it = first; it != last; ++it) {
+        if (it->second->expression->Equals(expression)) {
+            return it->second;
+        }
+    }
+
+    return entries.end();
+}
+
+} // Oasis
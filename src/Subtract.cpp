@@ -10,6 +10,7 @@
 #include "Oasis/Log.hpp"
 #include "Oasis/Multiply.hpp"
 #include "Oasis/Variable.hpp"
+#include "Oasis/View.hpp"
 
 namespace Oasis {
 
@@ -18,7 +19,12 @@ Subtract<Expression>::Subtract(const Expression& minuend, const Expression& subt
 {
 }
 
-auto Subtract<Expression>::Simplify() const -> std::unique_ptr<Expression>
+Subtract<Expression>::Subtract(std::unique_ptr<Expression>&& minuend, std::unique_ptr<Expression>&& subtrahend)
+    : BinaryExpression(std::move(minuend), std::move(subtrahend))
+{
+}
+
+auto Subtract<Expression>::ComputeSimplified() const -> std::unique_ptr<Expression>
 {
     const auto simplifiedMinuend = mostSigOp ? mostSigOp->Simplify() : nullptr;
     const auto simplifiedSubtrahend = leastSigOp ? leastSigOp->Simplify() : nullptr;
@@ -26,7 +32,7 @@ auto Subtract<Expression>::Simplify() const -> std::unique_ptr<Expression>
     const Subtract simplifiedSubtract { *simplifiedMinuend, *simplifiedSubtrahend };
 
     // 2 - 1 = 1
-    if (auto realCase = Subtract<Real>::Specialize(simplifiedSubtract); realCase != nullptr) {
+    if (auto realCase = View<Subtract<Real>>::Specialize(simplifiedSubtract)) {
         const Real& minuend = realCase->GetMostSigOp();
         const Real& subtrahend = realCase->GetLeastSigOp();
 
@@ -39,7 +45,7 @@ auto Subtract<Expression>::Simplify() const -> std::unique_ptr<Expression>
     }
 
     // ax - x = (a-1)x
-    if (const auto minusOneCase = Subtract<Multiply<>, Expression>::Specialize(simplifiedSubtract); minusOneCase != nullptr) {
+    if (const auto minusOneCase = View<Subtract<Multiply<>, Expression>>::Specialize(simplifiedSubtract)) {
         if (minusOneCase->GetMostSigOp().GetLeastSigOp().Equals(minusOneCase->GetLeastSigOp())) {
             const Subtract newCoefficient { minusOneCase->GetMostSigOp().GetMostSigOp(), Real { 1.0 } };
             return Multiply { newCoefficient, minusOneCase->GetLeastSigOp() }.Simplify();
@@ -47,7 +53,7 @@ auto Subtract<Expression>::Simplify() const -> std::unique_ptr<Expression>
     }
 
     // x-ax = (1-a)x
-    if (const auto oneMinusCase = Subtract<Expression, Multiply<>>::Specialize(simplifiedSubtract); oneMinusCase != nullptr) {
+    if (const auto oneMinusCase = View<Subtract<Expression, Multiply<>>>::Specialize(simplifiedSubtract)) {
         if (oneMinusCase->GetMostSigOp().Equals(oneMinusCase->GetLeastSigOp().GetLeastSigOp())) {
             const Subtract newCoefficient { Real { 1.0 }, oneMinusCase->GetLeastSigOp().GetMostSigOp() };
             return Multiply { newCoefficient, oneMinusCase->GetMostSigOp() }.Simplify();
@@ -55,7 +61,7 @@ auto Subtract<Expression>::Simplify() const -> std::unique_ptr<Expression>
     }
 
     // ax-bx= (a-b)x
-    if (const auto coefficientCase = Subtract<Multiply<>>::Specialize(simplifiedSubtract); coefficientCase != nullptr) {
+    if (const auto coefficientCase = View<Subtract<Multiply<>>>::Specialize(simplifiedSubtract)) {
         if (coefficientCase->GetMostSigOp().GetLeastSigOp().Equals(coefficientCase->GetLeastSigOp().GetLeastSigOp())) {
             const Subtract newCoefficient { coefficientCase->GetMostSigOp().GetMostSigOp(), coefficientCase->GetLeastSigOp().GetMostSigOp() };
             return Multiply { newCoefficient, coefficientCase->GetLeastSigOp().GetLeastSigOp() }.Simplify();
@@ -63,7 +69,7 @@ auto Subtract<Expression>::Simplify() const -> std::unique_ptr<Expression>
     }
 
     // log(a) - log(b) = log(a / b)
-    if (const auto logCase = Subtract<Log<>>::Specialize(simplifiedSubtract); logCase != nullptr) {
+    if (const auto logCase = View<Subtract<Log<>>>::Specialize(simplifiedSubtract)) {
         if (logCase->GetMostSigOp().GetMostSigOp().Equals(logCase->GetLeastSigOp().GetMostSigOp())) {
             const IExpression auto& base = logCase->GetMostSigOp().GetMostSigOp();
             const IExpression auto& argument = Divide({ logCase->GetMostSigOp().GetLeastSigOp(), logCase->GetLeastSigOp().GetLeastSigOp() });
@@ -74,12 +80,12 @@ auto Subtract<Expression>::Simplify() const -> std::unique_ptr<Expression>
     return simplifiedSubtract.Copy();
 }
 
-auto Subtract<Expression>::ToString() const -> std::string
+auto Subtract<Expression>::ComputeString() const -> std::string
 {
     return fmt::format("({} - {})", mostSigOp->ToString(), leastSigOp->ToString());
 }
 
-auto Subtract<Expression>::Simplify(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+auto Subtract<Expression>::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
 {
     std::unique_ptr<Expression> simplifiedMinuend, simplifiedSubtrahend;
 
@@ -153,35 +159,13 @@ auto Subtract<Expression>::Specialize(const Expression& other, tf::Subflow& subf
     auto otherGeneralized = other.Generalize(subflow);
     return std::make_unique<Subtract>(dynamic_cast<const Subtract&>(*otherGeneralized));
 }
-auto Subtract<Expression>::Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression>
+auto Subtract<Expression>::ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression>
 {
-    // Single diff variable
-    if (auto variable = Variable::Specialize(differentiationVariable); variable != nullptr) {
-        auto simplifiedSub = this->Simplify();
-
-        // Make sure we're still subtracting
-        if (auto adder = Subtract<Expression>::Specialize(*simplifiedSub); adder != nullptr) {
-            auto rightRef = adder->GetLeastSigOp().Copy();
-            auto rightDiff = rightRef->Differentiate(differentiationVariable);
-
-            auto specializedRight = Expression::Specialize(*rightDiff);
-
-            auto leftRef = adder->GetMostSigOp().Copy();
-            auto leftDiff = leftRef->Differentiate(differentiationVariable);
-
-            auto specializedLeft = Expression::Specialize(*leftDiff);
-
-            if (specializedLeft == nullptr || specializedRight == nullptr) {
-                return Copy();
-            }
-
-            return std::make_unique<Subtract<Expression, Expression>>(Subtract<Expression, Expression> { *(specializedLeft->Copy()), *(specializedRight->Copy()) })->Simplify();
-        }
-        // If not, use other differentiation technique
-        else {
-            return simplifiedSub->Differentiate(differentiationVariable);
-        }
+    // d/dx (f(x) - g(x)) = f'(x) - g'(x)
+    if (differentiationVariable.Is<Variable>()) {
+        return derivatives.Copy();
     }
+
     return Copy();
 }
 
@@ -0,0 +1,64 @@
+#include <vector>
+
+#include "Oasis/Rational.hpp"
+#include "Oasis/Sum.hpp"
+#include "Oasis/Variable.hpp"
+#include "Oasis/View.hpp"
+
+namespace Oasis {
+
+auto Sum::ComputeSimplified() const -> std::unique_ptr<Expression>
+{
+    return Combine(SimplifyOperands());
+}
+
+auto Sum::ComputeSimplified(tf::Subflow& subflow) const -> std::unique_ptr<Expression>
+{
+    return Combine(SimplifyOperands(subflow));
+}
+
+auto Sum::ComputeDerivative(const Expression& differentiationVariable, const Expression& derivatives) const -> std::unique_ptr<Expression>
+{
+    // The derivative of a sum is the sum of the derivatives of its terms.
+    if (differentiationVariable.Is<Variable>()) {
+        return derivatives.Copy();
+    }
+
+    return Copy();
+}
+
+auto Sum::ComputeString() const -> std::string
+{
+    std::string result = "(";
+
+    for (std::size_t i = 0; i < operands.size(); ++i) {
+        result += i == 0 ? "" : " + ";
+        result += operands[i]->ToString();
+    }
+
+    return result + ")";
+}
+
+auto Sum::Combine(std::vector<std::unique_ptr<Expression>> simplified) -> std::unique_ptr<Expression>
+{
+    auto terms = Add<Expression>::CombineLikeTerms(SpliceOperands(simplified));
+
+    // x + 0 = x
+    std::erase_if(terms, [](const auto& term) {
+        const auto real = View<Real>::Specialize(*term);
+        const auto rational = View<Rational>::Specialize(*term);
+        return (real && real->Get().GetValue() == 0.0) || (rational && rational->Get().GetValue().IsZero());
+    });
+
+    if (terms.empty()) {
+        return std::make_unique<Real>(0.0);
+    }
+
+    if (terms.size() == 1) {
+        return std::move(terms.front());
+    }
+
+    return std::make_unique<Sum>(terms);
+}
+
+} // Oasis
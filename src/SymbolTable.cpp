@@ -0,0 +1,60 @@
+#include <cassert>
+#include <mutex>
+
+#include "Oasis/SymbolTable.hpp"
+
+namespace Oasis {
+
+SymbolTable::SymbolTable()
+{
+    // The empty name always has EmptyId, so that default constructed variables need no lookup.
+    [[maybe_unused]] const Id empty = Intern("");
+    assert(empty == EmptyId);
+}
+
+auto SymbolTable::Global() -> SymbolTable&
+{
+    static SymbolTable table;
+    return table;
+}
+
+auto SymbolTable::GetName(Id id) const -> const std::string&
+{
+    std::shared_lock lock { mutex };
+    assert(id < names.size());
+
+    // Elements of a deque do not move when it grows, so the reference outlives the lock.
+    return names[id];
+}
+
+auto SymbolTable::GetSize() const -> std::size_t
+{
+    std::shared_lock lock { mutex };
+    return names.size();
+}
+
+auto SymbolTable::Intern(std::string_view name) -> Id
+{
+    {
+        std::shared_lock lock { mutex };
+
+        if (auto it = ids.find(name); it != ids.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock { mutex };
+
+    // Another thread may have interned the name while the lock was released.
+    if (auto it = ids.find(name); it != ids.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<Id>(names.size());
+    const std::string& stored = names.emplace_back(name);
+    ids.emplace(stored, id);
+
+    return id;
+}
+
+} // Oasis
@@ -6,7 +6,7 @@
 
 namespace Oasis {
 
-auto Undefined::ToString() const -> std::string
+auto Undefined::ComputeString() const -> std::string
 {
     return "Undefined";
 }
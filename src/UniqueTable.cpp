@@ -0,0 +1,136 @@
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "Oasis/Traversal.hpp"
+#include "Oasis/UniqueTable.hpp"
+
+namespace {
+
+auto ShallowEquals(const Oasis::Expression& lhs, const Oasis::Expression& rhs) -> bool
+{
+    if (lhs.GetType() != rhs.GetType() || lhs.GetOperandCount() != rhs.GetOperandCount()) {
+        return false;
+    }
+
+    if (lhs.GetOperandCount() == 0) {
+        return lhs.Equals(rhs);
+    }
+
+    for (std::size_t i = 0; i < lhs.GetOperandCount(); ++i) {
+        if (&lhs.GetOperandAt(i) != &rhs.GetOperandAt(i)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+namespace Oasis {
+
+auto UniqueTable::ShallowHash(const Expression& expression) -> std::size_t
+{
+    // The operands are already canonical, so they only need to be hashed by address.
+    if (expression.GetOperandCount() == 0) {
+        return expression.Hash();
+    }
+
+    auto hash = std::hash<int> {}(static_cast<int>(expression.GetType()));
+
+    for (std::size_t i = 0; i < expression.GetOperandCount(); ++i) {
+        hash = Expression::CombineHash(hash, std::hash<const Expression*> {}(&expression.GetOperandAt(i)));
+    }
+
+    return hash;
+}
+
+auto UniqueTable::Clear() -> void
+{
+    std::lock_guard lock { mutex };
+    nodes.clear();
+    canonical.clear();
+}
+
+auto UniqueTable::Contains(const Expression& expression) const -> bool
+{
+    std::lock_guard lock { mutex };
+    return canonical.contains(&expression);
+}
+
+auto UniqueTable::GetSize() const -> std::size_t
+{
+    std::lock_guard lock { mutex };
+    return canonical.size();
+}
+
+auto UniqueTable::Intern(const Expression& expression) -> std::shared_ptr<Expression>
+{
+    std::lock_guard lock { mutex };
+    return InternUnlocked(expression);
+}
+
+auto UniqueTable::InternUnlocked(const Expression& expression) -> std::shared_ptr<Expression>
+{
+    // The canonical node of each operand traversed so far, in order. A node that is already
+    // canonical is not traversed, and its operands are all canonical by the time it is visited.
+    std::vector<std::shared_ptr<Expression>> results;
+
+    // The canonical node of each node interned by this call, so that a subtree shared by several
+    // parents is only traversed once.
+    std::unordered_map<const Expression*, std::shared_ptr<Expression>> visited;
+
+    PostOrder(
+        expression,
+        [this, &results, &visited](const Expression& node) {
+            if (auto it = canonical.find(&node); it != canonical.end()) {
+                results.push_back(it->second);
+                return false;
+            }
+
+            if (auto it = visited.find(&node); it != visited.end()) {
+                results.push_back(it->second);
+                return false;
+            }
+
+            return true;
+        },
+        [this, &results, &visited](const Expression& node) {
+            const auto operandCount = node.GetOperandCount();
+            std::unique_ptr<Expression> candidate;
+
+            if (operandCount == 0) {
+                candidate = node.Copy();
+            } else {
+                const auto first = results.end() - static_cast<std::ptrdiff_t>(operandCount);
+                candidate = node.WithOperands({ first, results.end() });
+                results.erase(first, results.end());
+            }
+
+            results.push_back(InternNode(std::move(candidate)));
+            visited.emplace(&node, results.back());
+        });
+
+    return results.back();
+}
+
+auto UniqueTable::InternNode(std::unique_ptr<Expression> candidate) -> std::shared_ptr<Expression>
+{
+    const auto hash = ShallowHash(*candidate);
+    auto [first, last] = nodes.equal_range(hash);
+
+    for (auto it = first; it != last; ++it) {
+        if (ShallowEquals(*it->second, *candidate)) {
+            return it->second;
+        }
+    }
+
+    std::shared_ptr<Expression> node = std::move(candidate);
+    nodes.emplace(hash, node);
+    canonical.emplace(node.get(), node);
+
+    return node;
+}
+
+} // Oasis
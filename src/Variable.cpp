@@ -2,32 +2,57 @@
 // Created by Matthew McCall on 8/15/23.
 //
 
+#include <functional>
+
 #include "Oasis/Variable.hpp"
 #include "Oasis/Add.hpp"
 #include "Oasis/Exponent.hpp"
 #include "Oasis/Multiply.hpp"
 #include "Oasis/Real.hpp"
 
+namespace {
+
+const std::string emptyName;
+
+}
+
 namespace Oasis {
 
-Variable::Variable(std::string name)
-    : name(std::move(name))
+Variable::Variable()
+    : symbol(SymbolTable::EmptyId)
+    , name(&emptyName)
+{
+}
+
+Variable::Variable(std::string_view name)
+    : symbol(SymbolTable::Global().Intern(name))
+    , name(&SymbolTable::Global().GetName(symbol))
+{
+}
+
+auto Variable::ComputeHash() const -> std::size_t
 {
+    return CombineHash(Expression::ComputeHash(), std::hash<SymbolTable::Id> {}(symbol));
 }
 
 auto Variable::Equals(const Expression& other) const -> bool
 {
-    return other.Is<Variable>() && name == dynamic_cast<const Variable&>(other).name;
+    return other.Is<Variable>() && symbol == static_cast<const Variable&>(other).symbol;
+}
+
+auto Variable::GetName() const -> const std::string&
+{
+    return *name;
 }
 
-auto Variable::GetName() const -> std::string
+auto Variable::GetSymbol() const -> SymbolTable::Id
 {
-    return name;
+    return symbol;
 }
 
-auto Variable::ToString() const -> std::string
+auto Variable::ComputeString() const -> std::string
 {
-    return name;
+    return *name;
 }
 
 auto Variable::Specialize(const Expression& other) -> std::unique_ptr<Variable>
@@ -46,25 +71,23 @@ auto Variable::Substitute(const Expression& var, const Expression& val) -> std::
     if (varclone == nullptr) {
         throw std::invalid_argument("Variable was not a variable.");
     }
-    if (varclone->GetName() == GetName()) {
+    if (varclone->symbol == symbol) {
         return val.Copy();
     }
     return Copy();
 }
 
-auto Variable::Differentiate(const Expression& differentiationVariable) -> std::unique_ptr<Expression>
+auto Variable::ComputeDerivative(const Expression& differentiationVariable, const Expression&) const -> std::unique_ptr<Expression>
 {
     if (auto variable = Variable::Specialize(differentiationVariable); variable != nullptr) {
 
         // Power rule
-        if (name == (*variable).GetName()) {
-            return std::make_unique<Real>(Real { 1.0f })
-                ->Simplify();
+        if (symbol == variable->symbol) {
+            return std::make_unique<Real>(1.0f);
         }
 
         // Different variable, treat as constant
-        return std::make_unique<Real>(Real { 0 })
-            ->Simplify();
+        return std::make_unique<Real>(0);
     }
 
     return Copy();
@@ -6,6 +6,8 @@
 #include "Oasis/Add.hpp"
 #include "Oasis/Multiply.hpp"
 #include "Oasis/Real.hpp"
+#include "Oasis/SimplifyCache.hpp"
+#include "Oasis/Subtract.hpp"
 #include "Oasis/Variable.hpp"
 #include "Oasis/Negate.hpp"
 
@@ -247,4 +249,104 @@ TEST_CASE("Substitute Unary", "[Substitute]")
     auto after = before.Substitute(Oasis::Variable { "x" }, Oasis::Real { 4.0 }); // after should some std::unique_ptr<Expression> such that it equals 2(4) + 3(4)
     Oasis::Real four {4};
     REQUIRE(after->Equals(*(four.Simplify())));
-}
\ No newline at end of file
+}
+TEST_CASE("Hash follows associativity and commutativity", "[Hash]")
+{
+    Oasis::Real real1 { 1.0 };
+    Oasis::Real real2 { 2.0 };
+    Oasis::Variable x { "x" };
+
+    Oasis::Add add1 {
+        Oasis::Add {
+            real1,
+            real2 },
+        x
+    };
+
+    Oasis::Add add2 {
+        x,
+        Oasis::Add {
+            real2,
+            real1 }
+    };
+
+    REQUIRE(add1.Hash() == add2.Hash());
+    REQUIRE(add1.Copy()->Hash() == add1.Hash());
+
+    Oasis::Subtract subtract1 { real1, real2 };
+    Oasis::Subtract subtract2 { real2, real1 };
+
+    REQUIRE(subtract1.Hash() != subtract2.Hash());
+    REQUIRE_FALSE(subtract1.Equals(subtract2));
+
+    Oasis::Multiply multiply { Oasis::Add { real1, real2 }, x };
+    REQUIRE(multiply.Hash() != add1.Hash());
+
+    REQUIRE(Oasis::Real { 0.0 }.Hash() == Oasis::Real { -0.0 }.Hash());
+}
+
+TEST_CASE("Equals counts repeated operands", "[Hash]")
+{
+    Oasis::Real real1 { 1.0 };
+    Oasis::Real real2 { 2.0 };
+
+    Oasis::Add add1 {
+        Oasis::Add {
+            real1,
+            real1 },
+        real2
+    };
+
+    Oasis::Add add2 {
+        Oasis::Add {
+            real1,
+            real2 },
+        real2
+    };
+
+    REQUIRE_FALSE(add1.Equals(add2));
+    REQUIRE_FALSE(add2.Equals(add1));
+}
+
+TEST_CASE("Simplified expressions are not simplified again", "[Simplify]")
+{
+    Oasis::Add add {
+        Oasis::Multiply {
+            Oasis::Real { 2.0 },
+            Oasis::Variable { "x" } },
+        Oasis::Variable { "y" }
+    };
+
+    REQUIRE_FALSE(add.IsSimplified());
+
+    auto simplified = add.Simplify();
+    REQUIRE(simplified->IsSimplified());
+    REQUIRE(simplified->Copy()->IsSimplified());
+
+    // A flagged expression is copied without visiting its operands, so the cache is never consulted.
+    Oasis::SimplifyCache cache;
+    Oasis::SimplifyCache::Scope scope { cache };
+
+    auto resimplified = simplified->Simplify();
+    REQUIRE(resimplified->Equals(*simplified));
+    REQUIRE(resimplified->IsSimplified());
+    REQUIRE(cache.GetHits() == 0);
+    REQUIRE(cache.GetMisses() == 0);
+
+    // Modifying an expression clears the flag.
+    auto modified = Oasis::Add<Oasis::Expression>::Specialize(*simplified);
+    modified->SetMostSigOp(Oasis::Real { 1.0 });
+    REQUIRE_FALSE(modified->IsSimplified());
+}
+
+TEST_CASE("Asynchronously simplified expressions can be simplified further", "[Simplify]")
+{
+    const Oasis::Add add { Oasis::Variable { "y" }, Oasis::Variable { "y" } };
+
+    auto simplified = add.SimplifyAsync();
+    REQUIRE_FALSE(simplified->IsSimplified());
+
+    auto resimplified = simplified->Simplify();
+    REQUIRE(resimplified->Equals(Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Variable { "y" } }));
+    REQUIRE(resimplified->IsSimplified());
+}
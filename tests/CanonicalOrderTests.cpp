@@ -0,0 +1,112 @@
+#include <compare>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/CanonicalOrder.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Product.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Sum.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Canonical Order Is A Total Order On Structure", "[CanonicalOrder]")
+{
+    const Oasis::Real one { 1.0 };
+    const Oasis::Real two { 2.0 };
+    const Oasis::Variable x { "x" };
+    const Oasis::Variable y { "y" };
+
+    REQUIRE(std::is_lt(Oasis::CompareCanonical(one, two)));
+    REQUIRE(std::is_lt(Oasis::CompareCanonical(x, y)));
+    REQUIRE(std::is_eq(Oasis::CompareCanonical(y, Oasis::Variable { "y" })));
+
+    // Reals come before variables, which come before operations.
+    REQUIRE(std::is_lt(Oasis::CompareCanonical(two, x)));
+    REQUIRE(std::is_lt(Oasis::CompareCanonical(x, Oasis::Add { one, x })));
+
+    // Operations of the same type are ordered by their operands.
+    const Oasis::Add xPlusOne { x, one };
+    const Oasis::Add xPlusTwo { x, two };
+    const Oasis::Add yPlusOne { y, one };
+
+    REQUIRE(std::is_lt(Oasis::CompareCanonical(xPlusOne, xPlusTwo)));
+    REQUIRE(std::is_lt(Oasis::CompareCanonical(xPlusTwo, yPlusOne)));
+    REQUIRE(std::is_eq(Oasis::CompareCanonical(xPlusOne, Oasis::Add { x, one })));
+    REQUIRE(Oasis::CanonicalLess {}(xPlusOne, yPlusOne));
+    REQUIRE_FALSE(Oasis::CanonicalLess {}(yPlusOne, xPlusOne));
+}
+
+TEST_CASE("Combining Like Terms Is Independent Of Order", "[CanonicalOrder][Add]")
+{
+    const Oasis::Variable x { "x" };
+    const Oasis::Variable y { "y" };
+    const Oasis::Variable z { "z" };
+
+    // 2z + y + 3 + 4x + z + 5
+    const Oasis::Add<Oasis::Expression> first {
+        Oasis::Add<Oasis::Expression> {
+            Oasis::Add<Oasis::Expression> { Oasis::Multiply { Oasis::Real { 2.0 }, z }, y },
+            Oasis::Add<Oasis::Expression> { Oasis::Real { 3.0 }, Oasis::Multiply { Oasis::Real { 4.0 }, x } } },
+        Oasis::Add<Oasis::Expression> { z, Oasis::Real { 5.0 } }
+    };
+
+    // 5 + z + 4x + 3 + y + 2z
+    const Oasis::Add<Oasis::Expression> second {
+        Oasis::Add<Oasis::Expression> {
+            Oasis::Add<Oasis::Expression> { Oasis::Real { 5.0 }, z },
+            Oasis::Add<Oasis::Expression> { Oasis::Multiply { Oasis::Real { 4.0 }, x }, Oasis::Real { 3.0 } } },
+        Oasis::Add<Oasis::Expression> { y, Oasis::Multiply { Oasis::Real { 2.0 }, z } }
+    };
+
+    const auto firstSimplified = first.Simplify();
+    const auto secondSimplified = second.Simplify();
+
+    REQUIRE(std::is_eq(Oasis::CompareCanonical(*firstSimplified, *secondSimplified)));
+    REQUIRE(firstSimplified->ToString() == secondSimplified->ToString());
+
+    const Oasis::Add<Oasis::Expression> expected {
+        Oasis::Add<Oasis::Expression> {
+            Oasis::Add<Oasis::Expression> { Oasis::Multiply { Oasis::Real { 4.0 }, x }, y },
+            Oasis::Multiply { Oasis::Real { 3.0 }, z } },
+        Oasis::Real { 8.0 }
+    };
+
+    REQUIRE(firstSimplified->Equals(expected));
+}
+
+TEST_CASE("Combining Many Like Terms And Factors", "[CanonicalOrder][Add][Multiply]")
+{
+    constexpr std::size_t variableCount = 50;
+    constexpr std::size_t repeats = 40;
+
+    std::vector<std::unique_ptr<Oasis::Expression>> terms;
+    std::vector<std::unique_ptr<Oasis::Expression>> factors;
+
+    for (std::size_t i = 0; i < repeats; ++i) {
+        for (std::size_t j = 0; j < variableCount; ++j) {
+            const Oasis::Variable variable { "v" + std::to_string((j * 7 + i) % variableCount) };
+            terms.push_back(Oasis::Multiply { Oasis::Real { 2.0 }, variable }.Copy());
+            factors.push_back(variable.Copy());
+        }
+    }
+
+    const auto sum = Oasis::Sum { terms }.Simplify();
+    const auto product = Oasis::Product { factors }.Simplify();
+
+    std::vector<std::unique_ptr<Oasis::Expression>> expectedTerms;
+    std::vector<std::unique_ptr<Oasis::Expression>> expectedFactors;
+
+    for (std::size_t j = 0; j < variableCount; ++j) {
+        const Oasis::Variable variable { "v" + std::to_string(j) };
+        expectedTerms.push_back(Oasis::Multiply { Oasis::Real { 2.0 * repeats }, variable }.Copy());
+        expectedFactors.push_back(Oasis::Exponent { variable, Oasis::Real { static_cast<double>(repeats) } }.Copy());
+    }
+
+    REQUIRE(sum->Equals(Oasis::Sum { expectedTerms }));
+    REQUIRE(product->Equals(Oasis::Product { expectedFactors }));
+}
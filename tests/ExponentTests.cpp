@@ -358,8 +358,10 @@ TEST_CASE("Variable with power Multiplication", "[Exponent][Variable][Multiplica
     REQUIRE(Oasis::Multiply<Oasis::Real, Oasis::Exponent<Oasis::Variable, Oasis::Real>> {
         Oasis::Real { 6.0 }, Oasis::Exponent { Oasis::Variable { "x" }, Oasis::Real { 3.0 } } }
                 .Equals(*simplified6));
-    REQUIRE(Oasis::Multiply<Oasis::Real, Oasis::Exponent<Oasis::Variable, Oasis::Real>> {
-        Oasis::Real { 3.0 }, Oasis::Exponent { Oasis::Variable { "x" }, Oasis::Real { 4.0 } } }
+    // 3x^2 * 2^x has no like factors, since 2^x is not a power of x
+    REQUIRE(Oasis::Multiply {
+        Oasis::Multiply { Oasis::Real { 3.0 }, Oasis::Exponent { Oasis::Variable { "x" }, Oasis::Real { 2.0 } } },
+        Oasis::Exponent { Oasis::Real { 2.0 }, Oasis::Variable { "x" } } }
                 .Equals(*simplified7));
     REQUIRE(Oasis::Multiply<Oasis::Real, Oasis::Exponent<Oasis::Variable, Oasis::Real>> {
         Oasis::Real { 6.0 }, Oasis::Exponent { Oasis::Variable { "x" }, Oasis::Real { 4.0 } } }
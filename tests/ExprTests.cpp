@@ -0,0 +1,55 @@
+#include <unordered_set>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Expr.hpp"
+#include "Oasis/Log.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Expr Copies Share The Expression", "[Expr]")
+{
+    const Oasis::Expr expr = Oasis::Add { Oasis::Variable { "x" }, Oasis::Real { 1.0 } };
+    const Oasis::Expr copy = expr;
+
+    REQUIRE(&copy.Get() == &expr.Get());
+    REQUIRE(copy == expr);
+    REQUIRE(copy.Is<Oasis::Add>());
+    REQUIRE(&copy.GetOperand(0).Get() == &expr->GetOperandAt(0));
+
+    const std::unordered_set<Oasis::Expr> set { expr, copy, Oasis::Real { 1.0 } };
+    REQUIRE(set.size() == 2);
+}
+
+TEST_CASE("Expr Simplify Returns Simplified Expressions As Is", "[Expr]")
+{
+    const Oasis::Expr expr = Oasis::Add { Oasis::Real { 1.0 }, Oasis::Real { 2.0 } };
+    const auto simplified = expr.Simplify();
+
+    REQUIRE(simplified == Oasis::Expr { Oasis::Real { 3.0 } });
+    REQUIRE(&simplified.Simplify().Get() == &simplified.Get());
+}
+
+TEST_CASE("Expr Substitute Shares Untouched Subtrees", "[Expr]")
+{
+    const auto expr = Oasis::Expr { Oasis::Log { Oasis::Add { Oasis::Variable { "y" }, Oasis::Variable { "z" } }, Oasis::Variable { "x" } } }.Simplify();
+    const auto substituted = expr.Substitute(Oasis::Variable { "x" }, Oasis::Real { 3.0 });
+
+    REQUIRE(substituted == Oasis::Expr { Oasis::Log { Oasis::Add { Oasis::Variable { "y" }, Oasis::Variable { "z" } }, Oasis::Real { 3.0 } } });
+
+    const auto base = expr.GetOperand(0), substitutedBase = substituted.GetOperand(0);
+    REQUIRE(&substitutedBase.GetOperand(0).Get() == &base.GetOperand(0).Get());
+    REQUIRE(&substitutedBase.GetOperand(1).Get() == &base.GetOperand(1).Get());
+}
+
+TEST_CASE("Expr Operators", "[Expr]")
+{
+    const Oasis::Expr x = Oasis::Variable { "x" };
+    const Oasis::Expr two = Oasis::Real { 2.0 };
+
+    REQUIRE((two + two) == Oasis::Expr { Oasis::Real { 4.0 } });
+    REQUIRE((two * two / two - two) == Oasis::Expr { Oasis::Real { 0.0 } });
+    REQUIRE((x * two).Differentiate(x) == two);
+}
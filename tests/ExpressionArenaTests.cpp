@@ -0,0 +1,191 @@
+#include <stdexcept>
+#include <thread>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/ExpressionArena.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Traversal.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Arena Simplify Matches Heap Simplify", "[ExpressionArena]")
+{
+    Oasis::ExpressionArena arena;
+
+    const Oasis::Add add {
+        Oasis::Multiply {
+            Oasis::Real { 2.0 },
+            Oasis::Variable { "x" } },
+        Oasis::Multiply {
+            Oasis::Real { 3.0 },
+            Oasis::Variable { "x" } }
+    };
+
+    const auto expected = add.Simplify();
+    const auto simplified = arena.Simplify(add);
+
+    REQUIRE(simplified->Equals(*expected));
+    REQUIRE_FALSE(arena.Owns(*simplified));
+    REQUIRE(arena.GetLiveCount() == 0);
+    REQUIRE(arena.GetBytesAllocated() == 0);
+}
+
+TEST_CASE("Expressions Are Allocated From The Active Arena", "[ExpressionArena]")
+{
+    Oasis::ExpressionArena arena;
+    REQUIRE(Oasis::ExpressionArena::GetCurrent() == nullptr);
+
+    {
+        Oasis::ExpressionArena::Scope scope { arena };
+        REQUIRE(Oasis::ExpressionArena::GetCurrent() == &arena);
+
+        const auto real = Oasis::Real { 2.0 }.Copy();
+
+        REQUIRE(arena.Owns(*real));
+        REQUIRE(arena.GetLiveCount() == 1);
+        REQUIRE(arena.GetBytesAllocated() > 0);
+        REQUIRE_FALSE(arena.Reset());
+    }
+
+    REQUIRE(Oasis::ExpressionArena::GetCurrent() == nullptr);
+    REQUIRE(arena.GetLiveCount() == 0);
+    REQUIRE(arena.Reset());
+}
+
+TEST_CASE("Detached Expressions Outlive Arena Reuse", "[ExpressionArena]")
+{
+    Oasis::ExpressionArena arena { 256 };
+
+    const Oasis::Add add {
+        Oasis::Real { 1.0 },
+        Oasis::Real { 2.0 }
+    };
+
+    std::unique_ptr<Oasis::Expression> detached;
+
+    {
+        std::unique_ptr<Oasis::Expression> product;
+
+        {
+            Oasis::ExpressionArena::Scope scope { arena };
+            product = Oasis::Multiply<Oasis::Expression> { add, Oasis::Variable { "x" } }.Copy();
+        }
+
+        detached = arena.Detach(*product);
+        REQUIRE_FALSE(arena.Owns(*detached));
+        REQUIRE_FALSE(arena.Owns(detached->GetOperandAt(0)));
+    }
+
+    REQUIRE(arena.Reset());
+
+    const auto other = arena.Simplify(Oasis::Multiply { Oasis::Real { 4.0 }, Oasis::Real { 5.0 } });
+    REQUIRE(other->Equals(Oasis::Real { 20.0 }));
+
+    const Oasis::Multiply<Oasis::Expression> expected { add, Oasis::Variable { "x" } };
+    REQUIRE(detached->Equals(expected));
+}
+
+TEST_CASE("Heap Expressions Are Not Charged For Arenas", "[ExpressionArena]")
+{
+    Oasis::ExpressionArena arena;
+    const auto heap = Oasis::Real { 1.0 }.Copy();
+
+    {
+        Oasis::ExpressionArena::Scope scope { arena };
+        const auto inArena = Oasis::Real { 2.0 }.Copy();
+
+        REQUIRE(arena.Owns(*inArena));
+        REQUIRE_FALSE(arena.Owns(*heap));
+    }
+
+    // Every simplification leaves the arena empty, so a loop reuses the same blocks.
+    for (int i = 0; i < 100; ++i) {
+        const auto simplified = arena.Simplify(Oasis::Add { Oasis::Real { 1.0 }, Oasis::Real { static_cast<double>(i) } });
+        REQUIRE(simplified->Equals(Oasis::Real { 1.0 + i }));
+        REQUIRE(arena.GetBytesAllocated() == 0);
+    }
+}
+
+TEST_CASE("Arena Expressions Are Freed On Any Thread", "[ExpressionArena]")
+{
+    Oasis::ExpressionArena arena;
+    std::unique_ptr<Oasis::Expression> product;
+
+    {
+        Oasis::ExpressionArena::Scope scope { arena };
+        product = Oasis::Multiply<Oasis::Expression> { Oasis::Real { 2.0 }, Oasis::Variable { "x" } }.Copy();
+    }
+
+    REQUIRE(arena.Owns(*product));
+    REQUIRE(arena.GetLiveCount() > 0);
+
+    std::thread { [&product] { product.reset(); } }.join();
+
+    REQUIRE(arena.GetLiveCount() == 0);
+    REQUIRE(arena.Reset());
+}
+
+TEST_CASE("Shared Operands Are Counted From The Arena", "[ExpressionArena]")
+{
+    Oasis::ExpressionArena arena;
+
+    {
+        Oasis::ExpressionArena::Scope scope { arena };
+        const Oasis::Add<Oasis::Expression> add { std::make_unique<Oasis::Real>(1.0), std::make_unique<Oasis::Variable>("x") };
+
+        // The two operands and the reference count of each, since the sum itself is on the stack.
+        REQUIRE(arena.GetLiveCount() == 4);
+    }
+
+    REQUIRE(arena.GetLiveCount() == 0);
+    REQUIRE(arena.Reset());
+}
+
+TEST_CASE("Simplifying Through A Busy Arena Throws", "[ExpressionArena]")
+{
+    Oasis::ExpressionArena arena;
+    std::unique_ptr<Oasis::Expression> live;
+
+    {
+        Oasis::ExpressionArena::Scope scope { arena };
+        live = Oasis::Real { 1.0 }.Copy();
+    }
+
+    REQUIRE_THROWS_AS(arena.Simplify(Oasis::Add { Oasis::Real { 1.0 }, Oasis::Real { 2.0 } }), std::logic_error);
+
+    live.reset();
+    REQUIRE(arena.Simplify(Oasis::Add { Oasis::Real { 1.0 }, Oasis::Real { 2.0 } })->Equals(Oasis::Real { 3.0 }));
+}
+
+TEST_CASE("Deep Expressions Detach From The Arena", "[ExpressionArena]")
+{
+    constexpr std::size_t depth = 100'000;
+    Oasis::ExpressionArena arena;
+
+    std::unique_ptr<Oasis::Expression> chain;
+
+    {
+        Oasis::ExpressionArena::Scope scope { arena };
+        chain = std::make_unique<Oasis::Variable>("x");
+
+        for (std::size_t i = 0; i < depth; ++i) {
+            chain = std::make_unique<Oasis::Add<Oasis::Expression>>(std::move(chain), std::make_unique<Oasis::Real>(1.0));
+        }
+    }
+
+    auto detached = arena.Detach(*chain);
+    chain.reset();
+    REQUIRE(arena.Reset());
+
+    std::size_t nodes = 0, owned = 0;
+    Oasis::PreOrder(*detached, [&arena, &nodes, &owned](const Oasis::Expression& node) {
+        owned += arena.Owns(node) ? 1 : 0;
+        ++nodes;
+        return true;
+    });
+
+    REQUIRE(nodes == 2 * depth + 1);
+    REQUIRE(owned == 0);
+}
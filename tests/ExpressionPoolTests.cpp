@@ -0,0 +1,101 @@
+#include <cmath>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/ExpressionPool.hpp"
+#include "Oasis/Log.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Negate.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Sum.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("ExpressionPool Round Trips Expressions", "[ExpressionPool]")
+{
+    // (x^2 * 3 - log_2(y)) / -(x + 1) + (x + y + 4)
+    const Oasis::Divide quotient {
+        Oasis::Subtract {
+            Oasis::Multiply { Oasis::Exponent { Oasis::Variable { "x" }, Oasis::Real { 2.0 } }, Oasis::Real { 3.0 } },
+            Oasis::Log { Oasis::Real { 2.0 }, Oasis::Variable { "y" } } },
+        Oasis::Negate { Oasis::Add { Oasis::Variable { "x" }, Oasis::Real { 1.0 } } }
+    };
+
+    const Oasis::Sum sum { Oasis::Variable { "x" }, Oasis::Variable { "y" }, Oasis::Real { 4.0 } };
+    const Oasis::Add<Oasis::Expression> expression { quotient, sum };
+
+    // The pool holds binary nodes, so the Sum comes back as a chain of Adds.
+    const Oasis::Add<Oasis::Expression> expected { quotient, *sum.Generalize() };
+
+    Oasis::ExpressionPool pool;
+    const auto root = pool.Import(expression);
+
+    REQUIRE(pool.GetType(root) == Oasis::ExpressionType::Add);
+    REQUIRE(pool.Hash(root) == expected.Hash());
+
+    const auto exported = pool.Export(root);
+    REQUIRE(exported->Hash() == expected.Hash());
+    REQUIRE(exported->Equals(expected));
+
+    const auto x = Oasis::SymbolTable::Global().Intern("x");
+    const auto y = Oasis::SymbolTable::Global().Intern("y");
+    const double value = pool.Evaluate(root, { { x, 2.0 }, { y, 8.0 } });
+
+    REQUIRE(std::abs(value - ((4.0 * 3.0 - 3.0) / -3.0 + 14.0)) < 1e-12);
+    REQUIRE(std::isnan(pool.Evaluate(root, { { x, 2.0 } })));
+}
+
+TEST_CASE("ExpressionPool Round Trips Rationals Exactly", "[ExpressionPool]")
+{
+    // 1/3 has no exact double, and (2^62 + 1) / 3 does not even fit a double's mantissa.
+    const Oasis::Rational third { 1, 3 };
+    const Oasis::Rational large { Oasis::Fraction { Oasis::BigInt { (std::int64_t { 1 } << 62) + 1 }, Oasis::BigInt { 3 } } };
+    const Oasis::Add<Oasis::Expression> expression { Oasis::Multiply { third, Oasis::Variable { "x" } }, large };
+
+    Oasis::ExpressionPool pool;
+    const auto root = pool.Import(expression);
+
+    REQUIRE(pool.Hash(root) == expression.Hash());
+
+    const auto exported = pool.Export(root);
+    REQUIRE(exported->Equals(expression));
+
+    const auto thirdIndex = pool.GetMostSigOp(pool.GetMostSigOp(root));
+    REQUIRE(pool.GetType(thirdIndex) == Oasis::ExpressionType::Rational);
+    REQUIRE(pool.GetRational(thirdIndex) == third.GetValue());
+
+    const auto x = Oasis::SymbolTable::Global().Intern("x");
+    REQUIRE(std::abs(pool.Evaluate(root, { { x, 3.0 } }) - (1.0 + large.GetValue().ToDouble())) < 1.0);
+}
+
+TEST_CASE("ExpressionPool Differentiates Expressions", "[ExpressionPool]")
+{
+    // x^3 + 2x - log_2(x) / x
+    const Oasis::Subtract<Oasis::Expression> expression {
+        Oasis::Add { Oasis::Exponent { Oasis::Variable { "x" }, Oasis::Real { 3.0 } }, Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Variable { "x" } } },
+        Oasis::Divide { Oasis::Log { Oasis::Real { 2.0 }, Oasis::Variable { "x" } }, Oasis::Variable { "x" } }
+    };
+
+    Oasis::ExpressionPool pool;
+    const auto x = Oasis::SymbolTable::Global().Intern("x");
+    const auto root = pool.Import(expression);
+    const auto derivative = pool.Differentiate(root, x);
+
+    const auto expected = [](double at) {
+        return 3.0 * at * at + 2.0 - (1.0 / std::log(2.0) - std::log2(at)) / (at * at);
+    };
+
+    for (const double at : { 0.5, 1.0, 3.0 }) {
+        REQUIRE(std::abs(pool.Evaluate(derivative, { { x, at } }) - expected(at)) < 1e-9);
+    }
+
+    // Terms that do not depend on the variable vanish.
+    const auto constant = pool.Import(Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Variable { "y" } });
+    const auto zero = pool.Differentiate(constant, x);
+    REQUIRE(pool.GetType(zero) == Oasis::ExpressionType::Real);
+    REQUIRE(pool.GetValue(zero) == 0.0);
+}
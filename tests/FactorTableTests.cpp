@@ -0,0 +1,41 @@
+#include <cstdint>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/FactorTable.hpp"
+
+TEST_CASE("Primality", "[FactorTable]")
+{
+    REQUIRE_FALSE(Oasis::FactorTable::IsPrime(0));
+    REQUIRE_FALSE(Oasis::FactorTable::IsPrime(1));
+    REQUIRE(Oasis::FactorTable::IsPrime(2));
+    REQUIRE(Oasis::FactorTable::IsPrime(37));
+    REQUIRE(Oasis::FactorTable::IsPrime(4294967291));
+
+    // The largest 64-bit prime, and a strong pseudoprime to every base up to 31.
+    REQUIRE(Oasis::FactorTable::IsPrime(18446744073709551557u));
+    REQUIRE_FALSE(Oasis::FactorTable::IsPrime(3825123056546413051u));
+    REQUIRE_FALSE(Oasis::FactorTable::IsPrime(std::uint64_t { 4294967291 } * 4294967279));
+}
+
+TEST_CASE("Factorization", "[FactorTable]")
+{
+    Oasis::FactorTable table { 2 };
+
+    // 2^3 * 3^2 * 1000003 * 1000033
+    const std::uint64_t n = std::uint64_t { 72 } * 1000003 * 1000033;
+    REQUIRE(table.Factorize(n) == Oasis::FactorTable::PrimeFactors { { 2, 3 }, { 3, 2 }, { 1000003, 1 }, { 1000033, 1 } });
+    REQUIRE(table.GetSize() == 1);
+
+    // Two primes near 2^32, which trial division would take billions of steps to separate.
+    REQUIRE(table.Factorize(std::uint64_t { 4294967291 } * 4294967279) == Oasis::FactorTable::PrimeFactors { { 4294967279, 1 }, { 4294967291, 1 } });
+    REQUIRE(table.Factorize(1).empty());
+
+    // The full table is cleared before it grows past its capacity.
+    REQUIRE(table.GetSize() == 1);
+
+    REQUIRE(table.GetDivisors(12) == std::vector<std::uint64_t> { 1, 2, 3, 4, 6, 12 });
+    REQUIRE(table.GetDivisors(1) == std::vector<std::uint64_t> { 1 });
+    REQUIRE(table.GetDivisors(0).empty());
+}
@@ -0,0 +1,49 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/IntegerPolynomial.hpp"
+
+namespace {
+
+auto ToBigInts(const std::vector<std::int64_t>& coefficients) -> std::vector<Oasis::BigInt>
+{
+    return { coefficients.begin(), coefficients.end() };
+}
+
+} // namespace
+
+TEST_CASE("Dense Integer Polynomial GCD", "[IntegerPolynomial]")
+{
+    // (x - 1)(x + 2) and (x - 1)(2x + 3), each times 6
+    const auto lhs = ToBigInts({ -12, 6, 6 });
+    const auto rhs = ToBigInts({ -18, -6, 24 });
+
+    REQUIRE(Oasis::GcdDense(lhs, rhs) == ToBigInts({ -6, 6 }));
+    REQUIRE(Oasis::GetPrimitivePart(rhs) == ToBigInts({ -3, -1, 4 }));
+    REQUIRE(Oasis::GcdDense(lhs, {}) == lhs);
+    REQUIRE(Oasis::GcdDense({}, {}).empty());
+
+    REQUIRE(Oasis::DivideDenseExact(lhs, ToBigInts({ -1, 1 })) == ToBigInts({ 12, 6 }));
+    REQUIRE_THROWS_AS(Oasis::DivideDenseExact(lhs, ToBigInts({ 1, 1 })), std::domain_error);
+    REQUIRE(Oasis::DifferentiateDense(lhs) == ToBigInts({ 6, 12 }));
+
+    // 3^2 f(2/3) = 6 * (2/3 - 1)(2/3 + 2) * 9 = -48
+    REQUIRE(Oasis::EvaluateDense(lhs, Oasis::BigInt { 2 }, Oasis::BigInt { 3 }) == Oasis::BigInt { -48 });
+    REQUIRE(Oasis::EvaluateDense(lhs, Oasis::BigInt { -2 }, Oasis::BigInt { 1 }).IsZero());
+}
+
+TEST_CASE("Square-Free Decomposition", "[IntegerPolynomial]")
+{
+    // 3 (x + 1) (x - 2)^3 = 3x^4 - 15x^3 + 18x^2 + 12x - 24
+    const auto factors = Oasis::SquareFreeDecomposition(ToBigInts({ -24, 12, 18, -15, 3 }));
+
+    REQUIRE(factors.size() == 3);
+    REQUIRE(factors[0] == ToBigInts({ 1, 1 }));
+    REQUIRE(factors[1] == ToBigInts({ 1 }));
+    REQUIRE(factors[2] == ToBigInts({ -2, 1 }));
+
+    REQUIRE(Oasis::SquareFreeDecomposition(ToBigInts({ 5 })).empty());
+}
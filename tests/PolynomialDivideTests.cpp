@@ -0,0 +1,151 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Polynomial.hpp"
+#include "Oasis/PolynomialDivide.hpp"
+#include "Oasis/PolynomialMultiply.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Schoolbook Polynomial Division", "[PolynomialDivide]")
+{
+    // x^3 - 2x^2 - 4 = (x - 3)(x^2 + x + 3) + 5
+    const auto [quotient, remainder] = Oasis::DivRemDense(std::vector { -4.0, 0.0, -2.0, 1.0 }, std::vector { -3.0, 1.0 });
+    REQUIRE(quotient == std::vector { 3.0, 1.0, 1.0 });
+    REQUIRE(remainder == std::vector { 5.0 });
+
+    // (2x + 1) / (4x^2 + 1) = 0 remainder 2x + 1
+    const auto [none, same] = Oasis::DivRemDense(std::vector { 1.0, 2.0 }, std::vector { 1.0, 0.0, 4.0 });
+    REQUIRE(none.empty());
+    REQUIRE(same == std::vector { 1.0, 2.0 });
+
+    REQUIRE_THROWS_AS(Oasis::DivRemDense(std::vector { 1.0 }, std::vector { 0.0 }), std::domain_error);
+}
+
+TEST_CASE("Power Series Reciprocal", "[PolynomialDivide]")
+{
+    // 1 / (1 - x) = 1 + x + x^2 + ...
+    const auto geometric = Oasis::InvertSeries(std::vector<std::int64_t> { 1, -1 }, 10);
+    REQUIRE(geometric.has_value());
+    REQUIRE(*geometric == std::vector<std::int64_t>(10, 1));
+
+    // 1 / (-1 + 2x) = -1 - 2x - 4x^2 - ..., whose coefficients eventually overflow
+    const auto doubling = Oasis::InvertSeries(std::vector<std::int64_t> { -1, 2 }, 5);
+    REQUIRE(doubling.has_value());
+    REQUIRE(*doubling == std::vector<std::int64_t> { -1, -2, -4, -8, -16 });
+    REQUIRE_FALSE(Oasis::InvertSeries(std::vector<std::int64_t> { -1, 2 }, 100).has_value());
+
+    REQUIRE_THROWS_AS(Oasis::InvertSeries(std::vector<std::int64_t> { 2, 1 }, 4), std::domain_error);
+}
+
+TEST_CASE("Newton Polynomial Division", "[PolynomialDivide]")
+{
+    // a = b q + r, with b = x^200 + x + 1 and small pseudorandom q and r
+    std::vector<std::int64_t> divisor(201, 0);
+    divisor[0] = divisor[1] = divisor[200] = 1;
+
+    std::uint64_t state = 12345;
+    const auto next = [&state] {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        return static_cast<std::int64_t>(state >> 61) - 3;
+    };
+
+    std::vector<std::int64_t> quotient(300);
+    std::vector<std::int64_t> remainder(200);
+
+    for (auto& coefficient : quotient) {
+        coefficient = next();
+    }
+
+    for (auto& coefficient : remainder) {
+        coefficient = next();
+    }
+
+    quotient.back() = 1;
+    remainder.back() = 2;
+
+    std::vector<std::int64_t> dividend = Oasis::MultiplyDense(divisor, quotient);
+
+    for (std::size_t i = 0; i < remainder.size(); ++i) {
+        dividend[i] += remainder[i];
+    }
+
+    const auto result = Oasis::DivRemNewton(dividend, divisor);
+    REQUIRE(result.has_value());
+    REQUIRE(result->first == quotient);
+    REQUIRE(result->second == remainder);
+
+    // Both methods find the same quotient and remainder.
+    const std::vector<double> denseDividend { dividend.begin(), dividend.end() };
+    const std::vector<double> denseDivisor { divisor.begin(), divisor.end() };
+    REQUIRE(Oasis::DivRemDense(denseDividend, denseDivisor) == Oasis::DivRemSchoolbook(denseDividend, denseDivisor));
+}
+
+TEST_CASE("Polynomial Division In Several Variables", "[PolynomialDivide][Polynomial]")
+{
+    const auto x = Oasis::Polynomial::FromVariable(Oasis::Variable { "x" }.GetSymbol());
+    const auto y = Oasis::Polynomial::FromVariable(Oasis::Variable { "y" }.GetSymbol());
+    const auto one = Oasis::Polynomial::FromConstant(1.0);
+
+    // x^2 y + x y^2 + y^2 = (xy - 1)(x + y) + x + y^2 + y
+    const auto dividend = x * x * y + x * y * y + y * y;
+    const auto divisor = x * y - one;
+    const auto [quotient, remainder] = Oasis::Polynomial::DivRem(dividend, divisor);
+
+    REQUIRE(quotient == x + y);
+    REQUIRE(remainder == x + y * y + y);
+    REQUIRE(quotient * divisor + remainder == dividend);
+
+    // In one variable, x^4 - 1 = (x^2 + 1)(x^2 - 1)
+    const auto [exact, none] = Oasis::Polynomial::DivRem(x.Pow(4) - one, x * x + one);
+    REQUIRE(exact == x * x - one);
+    REQUIRE(none.IsZero());
+
+    REQUIRE_THROWS_AS(Oasis::Polynomial::DivRem(x, Oasis::Polynomial {}), std::domain_error);
+}
+
+TEST_CASE("Long Polynomial Division Is Exact", "[PolynomialDivide][Polynomial]")
+{
+    const auto x = Oasis::Polynomial::FromVariable(Oasis::Variable { "x" }.GetSymbol());
+    const auto one = Oasis::Polynomial::FromConstant(1.0);
+
+    // A monic divisor and a quotient that are long enough for Newton's method.
+    const auto divisor = x.Pow(static_cast<std::uint32_t>(Oasis::NewtonDivisorThreshold)) + x.Pow(3) - x * 2.0 + one;
+    Oasis::Polynomial quotient;
+
+    for (std::uint32_t i = 0; i < Oasis::NewtonDivisionThreshold; ++i) {
+        quotient = quotient + x.Pow(i) * static_cast<double>(static_cast<int>(i % 7) - 3);
+    }
+
+    const auto remainder = x.Pow(5) * 4.0 - one * 9.0;
+    const auto [newtonQuotient, newtonRemainder] = Oasis::Polynomial::DivRem(divisor * quotient + remainder, divisor);
+    REQUIRE(newtonQuotient == quotient);
+    REQUIRE(newtonRemainder == remainder);
+
+    // Rational coefficients are divided exactly, by the leading term of a divisor that is not monic.
+    const auto [exactQuotient, exactRemainder] = Oasis::Polynomial::DivRem(x * x - one, x * 3.0 + one);
+    REQUIRE(exactQuotient == x * Oasis::Fraction { 1, 3 } - one * Oasis::Fraction { 1, 9 });
+    REQUIRE(exactRemainder == one * Oasis::Fraction { -8, 9 });
+}
+
+TEST_CASE("Divide Divides Polynomials Exactly", "[PolynomialDivide][Divide]")
+{
+    const Oasis::Variable x { "x" };
+
+    // (x^3 - 1)/(x - 1) = x^2 + x + 1
+    const Oasis::Divide quotient {
+        Oasis::Subtract { Oasis::Exponent { x, Oasis::Real { 3.0 } }, Oasis::Real { 1.0 } },
+        Oasis::Subtract { x, Oasis::Real { 1.0 } }
+    };
+
+    const auto simplified = Oasis::Polynomial::FromExpression(*quotient.Simplify());
+    REQUIRE(simplified.has_value());
+    REQUIRE(simplified->GetDenseCoefficients() == std::vector { 1.0, 1.0, 1.0 });
+}
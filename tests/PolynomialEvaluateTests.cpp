@@ -0,0 +1,56 @@
+#include <cmath>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/PolynomialEvaluate.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Evaluate A Polynomial At Many Points", "[PolynomialEvaluate]")
+{
+    // 1 + x + x^2/2 + ... + x^30/30!, more points than fit in one block
+    std::vector<double> coefficients { 1.0 };
+
+    for (int i = 1; i <= 30; ++i) {
+        coefficients.push_back(coefficients.back() / i);
+    }
+
+    std::vector<double> points;
+
+    for (int i = 0; i < 150; ++i) {
+        points.push_back(-3.0 + 0.04 * i);
+    }
+
+    const auto values = Oasis::EvaluateMultipoint(coefficients, points);
+    REQUIRE(values.size() == points.size());
+
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        REQUIRE(std::abs(values[i] - std::exp(points[i])) <= 1e-12 * std::exp(points[i]));
+    }
+
+    REQUIRE(Oasis::EvaluateMultipoint(std::vector<double> {}, points) == std::vector<double>(points.size(), 0.0));
+    REQUIRE(Oasis::EvaluateMultipoint(std::vector { 7.0 }, std::vector { 1.0, 2.0 }) == std::vector { 7.0, 7.0 });
+    REQUIRE(Oasis::EvaluateMultipoint(coefficients, std::vector<double> {}).empty());
+}
+
+TEST_CASE("Evaluate An Expression At Many Points", "[PolynomialEvaluate][Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+
+    // 2x^3 - x + 1
+    const Oasis::Add expression {
+        Oasis::Subtract { Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Exponent { x, Oasis::Real { 3.0 } } }, x },
+        Oasis::Real { 1.0 }
+    };
+
+    REQUIRE(expression.EvaluateAt(std::vector { -1.0, 0.0, 0.5, 2.0 }) == std::vector { 0.0, 1.0, 0.75, 15.0 });
+
+    // No points give no values, which is not the same as an expression that cannot be evaluated.
+    REQUIRE(expression.EvaluateAt(std::vector<double> {}) == std::vector<double> {});
+    REQUIRE_FALSE(Oasis::Add { x, Oasis::Variable { "y" } }.EvaluateAt(std::vector { 1.0 }).has_value());
+}
@@ -0,0 +1,134 @@
+#include <stdexcept>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/PolynomialGcd.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Traversal.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Greatest Common Divisor Of Polynomials In One Variable", "[PolynomialGcd]")
+{
+    const auto x = Oasis::Polynomial::FromVariable(Oasis::Variable { "x" }.GetSymbol());
+    const auto one = Oasis::Polynomial::FromConstant(1.0);
+
+    // gcd((x - 1)^2 (x + 2), 3(x - 1)(x + 5)) = x - 1
+    REQUIRE(Oasis::Gcd((x - one).Pow(2) * (x + one * 2.0), (x - one) * (x + one * 5.0) * 3.0) == x - one);
+
+    // Coefficients that are not integers are scaled exactly, so gcd(x/2 + 1/4, 2x + 1) = 2x + 1.
+    REQUIRE(Oasis::Gcd(x * 0.5 + one * 0.25, x * 2.0 + one) == x * 2.0 + one);
+
+    REQUIRE(Oasis::Gcd(x * x + one, x - one) == one);
+    REQUIRE(Oasis::Gcd(Oasis::Polynomial {}, (x - one) * -2.0) == x - one);
+    REQUIRE(Oasis::Gcd(Oasis::Polynomial {}, Oasis::Polynomial {}).IsZero());
+
+    // A degree high enough that the heuristic GCD works with large integers
+    REQUIRE(Oasis::Gcd((x + one * 7.0).Pow(12) * (x - one), (x + one * 7.0).Pow(9) * (x * x + one)) == (x + one * 7.0).Pow(9));
+}
+
+TEST_CASE("Greatest Common Divisor Of Polynomials In Several Variables", "[PolynomialGcd]")
+{
+    const auto x = Oasis::Polynomial::FromVariable(Oasis::Variable { "x" }.GetSymbol());
+    const auto y = Oasis::Polynomial::FromVariable(Oasis::Variable { "y" }.GetSymbol());
+    const auto z = Oasis::Polynomial::FromVariable(Oasis::Variable { "z" }.GetSymbol());
+    const auto one = Oasis::Polynomial::FromConstant(1.0);
+
+    // gcd(x^2 - y^2, (x + y)^2) = x + y
+    REQUIRE(Oasis::Gcd(x * x - y * y, (x + y).Pow(2)) == x + y);
+
+    // gcd((xy + z)(x - z^2) y, (xy + z)(y + 1)) = xy + z
+    const auto common = x * y + z;
+    REQUIRE(Oasis::Gcd(common * (x - z * z) * y, common * (y + one)) == common);
+
+    REQUIRE(Oasis::Gcd(x + y, x - y) == one);
+    REQUIRE(Oasis::Gcd(x * y * 4.0, x * x * 6.0) == x);
+}
+
+TEST_CASE("Cancel Common Factors Of A Rational Function", "[PolynomialGcd]")
+{
+    const auto x = Oasis::Polynomial::FromVariable(Oasis::Variable { "x" }.GetSymbol());
+    const auto y = Oasis::Polynomial::FromVariable(Oasis::Variable { "y" }.GetSymbol());
+    const auto one = Oasis::Polynomial::FromConstant(1.0);
+
+    // (2x^2 - 2)/(4x - 4) = (x + 1)/2
+    const auto quotient = Oasis::CancelCommonFactors(x * x * 2.0 - one * 2.0, x * 4.0 - one * 4.0);
+    REQUIRE(quotient.has_value());
+    REQUIRE(quotient->first == x * 0.5 + one * 0.5);
+    REQUIRE(quotient->second == one);
+
+    // (x^2 - y^2)/(y^2 - xy) = (x + y)/-y = (-x - y)/y
+    const auto reduced = Oasis::CancelCommonFactors(x * x - y * y, y * y - x * y);
+    REQUIRE(reduced.has_value());
+    REQUIRE(reduced->first == -(x + y));
+    REQUIRE(reduced->second == y);
+
+    REQUIRE_FALSE(Oasis::CancelCommonFactors(x + one, x - one).has_value());
+    REQUIRE_FALSE(Oasis::CancelCommonFactors(Oasis::Polynomial {}, x).has_value());
+}
+
+TEST_CASE("Divide Cancels Common Polynomial Factors", "[PolynomialGcd][Divide]")
+{
+    const Oasis::Variable x { "x" };
+    const Oasis::Variable y { "y" };
+
+    // (x^2 - 1)/(x - 1) = x + 1
+    const Oasis::Divide quotient {
+        Oasis::Subtract { Oasis::Exponent { x, Oasis::Real { 2.0 } }, Oasis::Real { 1.0 } },
+        Oasis::Subtract { x, Oasis::Real { 1.0 } }
+    };
+
+    const auto simplified = quotient.Simplify();
+    const auto polynomial = Oasis::Polynomial::FromExpression(*simplified);
+    REQUIRE(polynomial.has_value());
+    REQUIRE(*polynomial == *Oasis::Polynomial::FromExpression(Oasis::Add { x, Oasis::Real { 1.0 } }));
+
+    // (x^2 + 2xy + y^2)/(x^2 - y^2) = (x + y)/(x - y)
+    const Oasis::Divide rational {
+        Oasis::Exponent { Oasis::Add { x, y }, Oasis::Real { 2.0 } },
+        Oasis::Subtract { Oasis::Exponent { x, Oasis::Real { 2.0 } }, Oasis::Exponent { y, Oasis::Real { 2.0 } } }
+    };
+
+    const auto reduced = rational.Simplify();
+    REQUIRE(reduced->Is<Oasis::Divide>());
+
+    const auto numerator = Oasis::Polynomial::FromExpression(reduced->GetOperandAt(0));
+    const auto denominator = Oasis::Polynomial::FromExpression(reduced->GetOperandAt(1));
+    REQUIRE(numerator.has_value());
+    REQUIRE(denominator.has_value());
+    REQUIRE(*numerator == *Oasis::Polynomial::FromExpression(Oasis::Add { x, y }));
+    REQUIRE(*denominator == *Oasis::Polynomial::FromExpression(Oasis::Subtract { x, y }));
+}
+
+TEST_CASE("Divide Keeps Rational Coefficients Exact", "[PolynomialGcd][Divide]")
+{
+    const Oasis::Variable x { "x" };
+
+    // (x^2 - 1/9)/(x - 1/3) = x + 1/3, which a double cannot represent
+    const Oasis::Divide quotient {
+        Oasis::Subtract { Oasis::Exponent { x, Oasis::Real { 2.0 } }, Oasis::Rational { 1, 9 } },
+        Oasis::Subtract { x, Oasis::Rational { 1, 3 } }
+    };
+
+    const auto simplified = quotient.Simplify();
+    REQUIRE_FALSE(simplified->Is<Oasis::Divide>());
+
+    bool real = false;
+
+    Oasis::PreOrder(*simplified, [&real](const Oasis::Expression& node) {
+        real = real || node.Is<Oasis::Real>();
+        return true;
+    });
+
+    REQUIRE_FALSE(real);
+
+    const auto polynomial = Oasis::Polynomial::FromExpression(*simplified);
+    REQUIRE(polynomial.has_value());
+    REQUIRE(polynomial->GetDenseFractions() == std::vector { Oasis::Fraction { 1, 3 }, Oasis::Fraction { 1 } });
+}
@@ -0,0 +1,182 @@
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/BigInt.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Log.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Polynomial.hpp"
+#include "Oasis/PolynomialMultiply.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Traversal.hpp"
+#include "Oasis/Variable.hpp"
+
+namespace {
+
+auto RandomCoefficients(std::size_t count, std::mt19937_64& generator) -> std::vector<std::int64_t>
+{
+    std::uniform_int_distribution<std::int64_t> distribution { -1'000'000, 1'000'000 };
+    std::vector<std::int64_t> coefficients(count);
+
+    for (auto& coefficient : coefficients) {
+        coefficient = distribution(generator);
+    }
+
+    return coefficients;
+}
+
+} // namespace
+
+TEST_CASE("Dense Multiplication Methods Agree", "[PolynomialMultiply]")
+{
+    std::mt19937_64 generator { 17 };
+
+    // The lengths cover the base case, unequal operands, and odd lengths at every level of recursion.
+    for (const auto& [lhsLength, rhsLength] : std::vector<std::pair<std::size_t, std::size_t>> { { 1, 1 }, { 5, 3 }, { 33, 33 }, { 100, 37 }, { 517, 600 }, { 1500, 1499 } }) {
+        const auto lhs = RandomCoefficients(lhsLength, generator);
+        const auto rhs = RandomCoefficients(rhsLength, generator);
+
+        const auto expected = Oasis::MultiplySchoolbook(lhs, rhs);
+        REQUIRE(expected.size() == lhsLength + rhsLength - 1);
+        REQUIRE(Oasis::MultiplyKaratsuba(lhs, rhs) == expected);
+        REQUIRE(Oasis::MultiplyNtt(lhs, rhs) == expected);
+        REQUIRE(Oasis::MultiplyDense(lhs, rhs) == expected);
+    }
+
+    REQUIRE(Oasis::MultiplyDense({}, std::vector<std::int64_t> { 1, 2 }).empty());
+}
+
+TEST_CASE("Dense Multiplication Detects Overflow", "[PolynomialMultiply]")
+{
+    // 2^31 * 2^31 * 2 = 2^63
+    const std::vector<std::int64_t> large { std::int64_t { 1 } << 31, std::int64_t { 1 } << 31 };
+
+    REQUIRE_FALSE(Oasis::DenseProductFits(large, large));
+    REQUIRE_THROWS_AS(Oasis::MultiplyNtt(large, large), std::overflow_error);
+
+    // Products near the limit are still exact, including negative coefficients.
+    const std::vector<std::int64_t> lhs { -(std::int64_t { 1 } << 31), 3 };
+    const std::vector<std::int64_t> rhs { std::int64_t { 1 } << 30, (std::int64_t { 1 } << 30) - 1 };
+    const auto expected = Oasis::MultiplySchoolbook(lhs, rhs);
+
+    REQUIRE(expected.front() == -(std::int64_t { 1 } << 61));
+    REQUIRE(Oasis::MultiplyNtt(lhs, rhs) == expected);
+    REQUIRE(Oasis::MultiplyKaratsuba(lhs, rhs) == expected);
+}
+
+TEST_CASE("Expand Multiplies Out Polynomial Subexpressions", "[Expand]")
+{
+    const Oasis::Variable x { "x" };
+
+    // (x + 1)^20 * (x - 1)^20 = (x^2 - 1)^20
+    const Oasis::Multiply product {
+        Oasis::Exponent { Oasis::Add { x, Oasis::Real { 1.0 } }, Oasis::Real { 20.0 } },
+        Oasis::Exponent { Oasis::Subtract { x, Oasis::Real { 1.0 } }, Oasis::Real { 20.0 } }
+    };
+
+    const auto expanded = product.Expand();
+    const auto polynomial = Oasis::Polynomial::FromExpression(*expanded);
+    REQUIRE(polynomial.has_value());
+
+    const auto coefficients = polynomial->GetDenseCoefficients();
+    REQUIRE(coefficients.size() == 41);
+
+    double binomial = 1.0;
+
+    for (std::size_t k = 0; k <= 20; ++k) {
+        REQUIRE(coefficients[2 * k] == ((20 - k) % 2 == 0 ? binomial : -binomial));
+
+        if (k < 20) {
+            REQUIRE(coefficients[2 * k + 1] == 0.0);
+        }
+
+        binomial = binomial * static_cast<double>(20 - k) / static_cast<double>(k + 1);
+    }
+
+    // The polynomial operand of a logarithm is expanded, but the logarithm is not.
+    const Oasis::Log log { Oasis::Real { 10.0 }, Oasis::Multiply { x, Oasis::Add { x, Oasis::Real { 2.0 } } } };
+    const Oasis::Log expected { Oasis::Real { 10.0 }, Oasis::Add { Oasis::Exponent { x, Oasis::Real { 2.0 } }, Oasis::Multiply { Oasis::Real { 2.0 }, x } } };
+    REQUIRE(log.Expand()->Equals(expected));
+}
+
+TEST_CASE("Expand Keeps Large Coefficients Exact", "[Expand]")
+{
+    const Oasis::Variable x { "x" };
+
+    // (x + 1)^50 * (x - 2)^40, whose largest coefficients need more than 53 bits
+    const Oasis::Multiply product {
+        Oasis::Exponent { Oasis::Add { x, Oasis::Real { 1.0 } }, Oasis::Real { 50.0 } },
+        Oasis::Exponent { Oasis::Subtract { x, Oasis::Real { 2.0 } }, Oasis::Real { 40.0 } }
+    };
+
+    const auto expanded = product.Expand();
+    const auto polynomial = Oasis::Polynomial::FromExpression(*expanded);
+    REQUIRE(polynomial.has_value());
+
+    const auto coefficients = polynomial->GetDenseFractions();
+    REQUIRE(coefficients.size() == 91);
+
+    const auto binomials = [](std::int64_t n) {
+        std::vector<Oasis::BigInt> row { Oasis::BigInt { 1 } };
+
+        for (std::int64_t k = 0; k < n; ++k) {
+            row.push_back(row.back() * Oasis::BigInt { n - k } / Oasis::BigInt { k + 1 });
+        }
+
+        return row;
+    };
+
+    const auto first = binomials(50);
+    const auto second = binomials(40);
+
+    // The coefficient of x^k is the sum of C(50, i) C(40, j) (-2)^(40 - j) over i + j = k.
+    Oasis::BigInt sum;
+    Oasis::BigInt largest;
+
+    for (std::size_t k = 0; k < coefficients.size(); ++k) {
+        Oasis::BigInt expected;
+
+        for (std::size_t j = 0; j <= 40 && j <= k; ++j) {
+            if (k - j <= 50) {
+                expected = expected + first[k - j] * second[j] * Oasis::BigInt { -2 }.Pow(40 - j);
+            }
+        }
+
+        REQUIRE(coefficients[k] == Oasis::Fraction { expected, Oasis::BigInt { 1 } });
+        sum = sum + expected;
+        largest = std::max(largest, expected.Abs());
+    }
+
+    // At x = 1, the product is 2^50 * (-1)^40.
+    REQUIRE(sum == Oasis::BigInt { 2 }.Pow(50));
+    REQUIRE(largest.GetBitLength() > 53);
+
+    // Coefficients that a double cannot represent are emitted as rational numbers.
+    bool rational = false;
+
+    Oasis::PreOrder(*expanded, [&rational](const Oasis::Expression& node) {
+        rational = rational || node.Is<Oasis::Rational>();
+        return true;
+    });
+
+    REQUIRE(rational);
+
+    // A polynomial with rational coefficients keeps them rational.
+    const auto square = Oasis::Exponent { Oasis::Add { x, Oasis::Rational { 1, 2 } }, Oasis::Real { 2.0 } }.Expand();
+    bool quarter = false;
+
+    Oasis::PreOrder(*square, [&quarter](const Oasis::Expression& node) {
+        quarter = quarter || node.Equals(Oasis::Rational { 1, 4 });
+        return true;
+    });
+
+    REQUIRE(quarter);
+}
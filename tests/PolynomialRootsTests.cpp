@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/BigInt.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/PolynomialRoots.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Variable.hpp"
+
+namespace {
+
+// Checks that the nonreal roots come in exact complex conjugate pairs.
+auto ArePairedWithConjugates(const std::vector<std::complex<double>>& roots) -> bool
+{
+    return std::ranges::all_of(roots, [&roots](const std::complex<double>& root) {
+        return root.imag() == 0.0 || std::ranges::count(roots, root) == std::ranges::count(roots, std::conj(root));
+    });
+}
+
+} // namespace
+
+TEST_CASE("Roots Of A Polynomial With Complex Roots", "[PolynomialRoots]")
+{
+    // (x - 1)(x - 2)(x - 3)(x^2 + 1) x = x^6 - 6x^5 + 12x^4 - 12x^3 + 11x^2 - 6x
+    const std::vector<double> coefficients { 0, -6, 11, -12, 12, -6, 1 };
+    const std::vector<std::complex<double>> expected { 0.0, { 0.0, -1.0 }, { 0.0, 1.0 }, 1.0, 2.0, 3.0 };
+
+    const auto roots = Oasis::FindRoots(coefficients);
+    REQUIRE(roots.size() == expected.size());
+
+    // Roots with equal real parts may be ordered either way by rounding errors.
+    for (const auto& root : expected) {
+        REQUIRE(std::ranges::any_of(roots, [&root](const std::complex<double>& found) { return std::abs(found - root) < 1e-10; }));
+    }
+
+    REQUIRE(std::abs(roots.back() - 3.0) < 1e-10);
+
+    REQUIRE(Oasis::FindRoots(std::vector { 5.0 }).empty());
+    REQUIRE_THROWS_AS(Oasis::FindRoots(std::vector { 0.0, 0.0 }), std::domain_error);
+}
+
+TEST_CASE("Roots Of A Polynomial Of Degree 50", "[PolynomialRoots]")
+{
+    // x^50 - 1, whose roots are the 50th roots of unity
+    std::vector<double> coefficients(51);
+    coefficients.front() = -1.0;
+    coefficients.back() = 1.0;
+
+    const auto roots = Oasis::FindRoots(coefficients);
+    REQUIRE(roots.size() == 50);
+
+    for (const auto& root : roots) {
+        REQUIRE(std::abs(std::abs(root) - 1.0) < 1e-12);
+        REQUIRE(std::abs(std::pow(root, 50) - 1.0) < 1e-10);
+    }
+
+    REQUIRE(ArePairedWithConjugates(roots));
+    REQUIRE(std::ranges::count_if(roots, [](const std::complex<double>& root) { return root.imag() == 0.0; }) == 2);
+}
+
+TEST_CASE("Roots Of Wilkinson's Polynomial", "[PolynomialRoots]")
+{
+    // (x - 1)(x - 2)...(x - 20), whose larger roots move far when its coefficients are rounded to
+    // doubles, so that only a polynomial near it can be solved.
+    std::vector<Oasis::BigInt> exact { Oasis::BigInt { 1 } };
+
+    for (std::int64_t k = 1; k <= 20; ++k) {
+        std::vector<Oasis::BigInt> next(exact.size() + 1);
+
+        for (std::size_t i = 0; i < exact.size(); ++i) {
+            next[i + 1] = next[i + 1] + exact[i];
+            next[i] = next[i] - exact[i] * Oasis::BigInt { k };
+        }
+
+        exact = std::move(next);
+    }
+
+    std::vector<double> coefficients;
+
+    for (const auto& coefficient : exact) {
+        coefficients.push_back(coefficient.ToDouble());
+    }
+
+    const auto roots = Oasis::FindRoots(coefficients);
+    REQUIRE(roots.size() == 20);
+    REQUIRE(ArePairedWithConjugates(roots));
+
+    for (std::size_t i = 0; i < roots.size(); ++i) {
+        // Each root is exactly real, and solves the rounded polynomial to within rounding error.
+        REQUIRE(roots[i].imag() == 0.0);
+
+        const double x = roots[i].real();
+        double value = 0.0;
+        double bound = 0.0;
+
+        for (std::size_t j = coefficients.size(); j-- > 0;) {
+            value = value * x + coefficients[j];
+            bound = bound * std::abs(x) + std::abs(coefficients[j]);
+        }
+
+        REQUIRE(std::abs(value) <= 4.0 * std::numeric_limits<double>::epsilon() * bound);
+
+        // The smallest roots are well conditioned.
+        if (i < 7) {
+            REQUIRE(std::abs(x - static_cast<double>(i + 1)) < 1e-4);
+        }
+    }
+}
+
+TEST_CASE("Numeric Zeros Of An Expression", "[PolynomialRoots][Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+
+    // x^3 - 2 has no rational zeros, so FindZeros finds none.
+    const Oasis::Subtract expression { Oasis::Exponent { x, Oasis::Real { 3.0 } }, Oasis::Real { 2.0 } };
+    REQUIRE(expression.FindZeros().empty());
+
+    const auto zeros = expression.FindZerosNumeric();
+    REQUIRE(zeros.size() == 3);
+
+    for (const auto& zero : zeros) {
+        REQUIRE(std::abs(std::abs(zero) - std::cbrt(2.0)) < 1e-12);
+    }
+
+    REQUIRE(std::abs(zeros.back() - std::cbrt(2.0)) < 1e-12);
+    REQUIRE(Oasis::Add { x, Oasis::Variable { "y" } }.FindZerosNumeric().empty());
+}
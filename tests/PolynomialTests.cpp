@@ -9,10 +9,15 @@
 #include "Oasis/Expression.hpp"
 #include "Oasis/Imaginary.hpp"
 #include "Oasis/Multiply.hpp"
+#include "Oasis/Polynomial.hpp"
+#include "Oasis/Rational.hpp"
 #include "Oasis/Real.hpp"
 #include "Oasis/Subtract.hpp"
 #include "Oasis/Variable.hpp"
+#include <cstdint>
+#include <limits>
 #include <set>
+#include <stdexcept>
 #include <tuple>
 #include <vector>
 
@@ -119,4 +124,180 @@ TEST_CASE("linear polynomial", "[factor]")
         REQUIRE(root->GetMostSigOp().GetValue() == -30);
         REQUIRE(root->GetLeastSigOp().GetValue() == 1);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Polynomial Round Trips Through An Expression", "[Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+    const Oasis::Variable y { "y" };
+
+    // 3 * x^2 * y - (y - 4) / 2
+    const Oasis::Subtract expression {
+        Oasis::Multiply { Oasis::Multiply { Oasis::Real { 3.0 }, Oasis::Exponent { x, Oasis::Real { 2.0 } } }, y },
+        Oasis::Divide { Oasis::Subtract { y, Oasis::Real { 4.0 } }, Oasis::Real { 2.0 } }
+    };
+
+    const auto polynomial = Oasis::Polynomial::FromExpression(expression);
+    REQUIRE(polynomial.has_value());
+    REQUIRE(polynomial->GetVariables().size() == 2);
+    REQUIRE(polynomial->GetTerms().size() == 3);
+    REQUIRE(polynomial->GetDegree() == 3);
+
+    // The terms are in decreasing lexicographic order of their exponents.
+    REQUIRE(polynomial->GetExponents(polynomial->GetTerms()[0].monomial) == std::vector<std::uint32_t> { 2, 1 });
+    REQUIRE(polynomial->GetTerms()[0].coefficient == Oasis::Fraction { 3 });
+    REQUIRE(polynomial->GetExponents(polynomial->GetTerms()[1].monomial) == std::vector<std::uint32_t> { 0, 1 });
+    REQUIRE(polynomial->GetTerms()[1].coefficient == Oasis::Fraction { -1, 2 });
+    REQUIRE(polynomial->GetTerms()[2].coefficient == Oasis::Fraction { 2 });
+
+    const auto roundTrip = Oasis::Polynomial::FromExpression(*polynomial->ToExpression());
+    REQUIRE(roundTrip.has_value());
+    REQUIRE(*roundTrip == *polynomial);
+}
+
+TEST_CASE("Polynomial Keeps Coefficients Exact", "[Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+
+    // (x + 1/3) / 3 = 1/3 x + 1/9
+    const auto polynomial = Oasis::Polynomial::FromExpression(Oasis::Divide { Oasis::Add { x, Oasis::Rational { 1, 3 } }, Oasis::Real { 3.0 } });
+    REQUIRE(polynomial.has_value());
+    REQUIRE(polynomial->GetDenseFractions() == std::vector { Oasis::Fraction { 1, 9 }, Oasis::Fraction { 1, 3 } });
+
+    // Real numbers are taken at the exact values of their doubles.
+    const auto tenth = Oasis::Polynomial::FromExpression(Oasis::Multiply { Oasis::Real { 0.1 }, x });
+    REQUIRE(tenth.has_value());
+    REQUIRE(tenth->GetTerms().front().coefficient == Oasis::Fraction::FromDouble(0.1));
+
+    REQUIRE_FALSE(Oasis::Polynomial::FromExpression(Oasis::Multiply { Oasis::Real { std::numeric_limits<double>::infinity() }, x }).has_value());
+}
+
+TEST_CASE("Polynomial Arithmetic", "[Polynomial]")
+{
+    const auto x = Oasis::Polynomial::FromVariable(Oasis::Variable { "x" }.GetSymbol());
+    const auto y = Oasis::Polynomial::FromVariable(Oasis::Variable { "y" }.GetSymbol());
+    const auto one = Oasis::Polynomial::FromConstant(1.0);
+
+    // (x + y)^2 = x^2 + 2xy + y^2
+    const auto square = (x + y).Pow(2);
+    REQUIRE(square == x * x + x * y * 2.0 + y * y);
+    REQUIRE(square.GetDegree() == 2);
+
+    // (x + 1)(x - 1) = x^2 - 1
+    const auto product = (x + one) * (x - one);
+    REQUIRE(product.GetDenseCoefficients() == std::vector { -1.0, 0.0, 1.0 });
+    REQUIRE_THROWS_AS(square.GetDenseCoefficients(), std::logic_error);
+
+    REQUIRE((square - square).IsZero());
+    REQUIRE((square - square).GetDegree() == -1);
+}
+
+TEST_CASE("Polynomial Detects Exponent Overflow", "[Polynomial]")
+{
+    std::vector<Oasis::SymbolTable::Id> variables;
+
+    for (int i = 0; i < 8; ++i) {
+        variables.push_back(Oasis::Variable { "v" + std::to_string(i) }.GetSymbol());
+    }
+
+    // With eight variables, each exponent has eight bits, the highest of which is kept clear.
+    Oasis::Polynomial polynomial { variables };
+    std::vector<std::uint32_t> exponents(8, 0);
+    exponents[3] = 127;
+    polynomial.AddTerm(exponents, 1.0);
+
+    exponents[3] = 128;
+    REQUIRE_THROWS_AS(polynomial.AddTerm(exponents, 1.0), std::overflow_error);
+
+    // v3^127 * v3^127 does not fit
+    const Oasis::Polynomial term = polynomial;
+    REQUIRE_THROWS_AS(term * term, std::overflow_error);
+
+    std::vector<Oasis::SymbolTable::Id> tooMany;
+
+    for (std::size_t i = 0; i <= Oasis::Polynomial::MaxVariables; ++i) {
+        tooMany.push_back(Oasis::Variable { "w" + std::to_string(i) }.GetSymbol());
+    }
+
+    REQUIRE_THROWS_AS(Oasis::Polynomial { tooMany }, std::invalid_argument);
+}
+
+TEST_CASE("Non-Polynomial Expressions Are Rejected", "[Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+
+    REQUIRE_FALSE(Oasis::Polynomial::FromExpression(Oasis::Divide { Oasis::Real { 1.0 }, x }).has_value());
+    REQUIRE_FALSE(Oasis::Polynomial::FromExpression(Oasis::Exponent { x, Oasis::Real { 0.5 } }).has_value());
+    REQUIRE_FALSE(Oasis::Polynomial::FromExpression(Oasis::Add { x, Oasis::Imaginary {} }).has_value());
+}
+
+TEST_CASE("Factored Quadratic", "[factor][Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+
+    // (x - 2)(x + 3) is expanded before its zeros are found.
+    const Oasis::Multiply expression { Oasis::Subtract { x, Oasis::Real { 2.0 } }, Oasis::Add { x, Oasis::Real { 3.0 } } };
+    const auto zeros = expression.FindZeros();
+
+    std::set<double> values;
+
+    for (const auto& zero : zeros) {
+        const auto value = Oasis::Real::Specialize(*zero->Simplify());
+        REQUIRE(value != nullptr);
+        values.insert(value->GetValue());
+    }
+
+    REQUIRE(values == std::set { -3.0, 2.0 });
+}
+
+TEST_CASE("Repeated Zeros Have Multiplicities", "[factor][duplicateRoot][Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+
+    // x (x - 2)^3 (2x + 1)^2 (x^2 - 2)^2
+    const Oasis::Multiply expression {
+        Oasis::Multiply { x, Oasis::Exponent { Oasis::Subtract { x, Oasis::Real { 2.0 } }, Oasis::Real { 3.0 } } },
+        Oasis::Multiply {
+            Oasis::Exponent { Oasis::Add { Oasis::Multiply { Oasis::Real { 2.0 }, x }, Oasis::Real { 1.0 } }, Oasis::Real { 2.0 } },
+            Oasis::Exponent { Oasis::Subtract { Oasis::Exponent { x, Oasis::Real { 2.0 } }, Oasis::Real { 2.0 } }, Oasis::Real { 2.0 } } }
+    };
+    const auto zeros = expression.FindZerosWithMultiplicity();
+
+    std::set<std::tuple<long, long, std::size_t>> rational;
+    std::size_t irrational = 0;
+
+    for (const auto& [zero, multiplicity] : zeros) {
+        if (auto divideCase = Oasis::Divide<Oasis::Real>::Specialize(*zero)) {
+            rational.emplace(lround(divideCase->GetMostSigOp().GetValue()), lround(divideCase->GetLeastSigOp().GetValue()), multiplicity);
+        } else {
+            // The zeros of x^2 - 2 come from the quadratic formula.
+            REQUIRE(multiplicity == 2);
+            ++irrational;
+        }
+    }
+
+    REQUIRE(rational == std::set<std::tuple<long, long, std::size_t>> { { 0, 1, 1 }, { 2, 1, 3 }, { -1, 2, 2 } });
+    REQUIRE(irrational == 2);
+    REQUIRE(expression.FindZeros().size() == 5);
+}
+
+TEST_CASE("Rational Zeros With Large Coefficients", "[factor][Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+
+    // (1000003x - 7)(1000033x + 11), whose leading coefficient has 13 digits
+    const Oasis::Multiply expression {
+        Oasis::Subtract { Oasis::Multiply { Oasis::Real { 1000003.0 }, x }, Oasis::Real { 7.0 } },
+        Oasis::Add { Oasis::Multiply { Oasis::Real { 1000033.0 }, x }, Oasis::Real { 11.0 } }
+    };
+
+    std::set<std::tuple<long, long>> zeros;
+
+    for (const auto& zero : expression.FindZeros()) {
+        const auto divideCase = Oasis::Divide<Oasis::Real>::Specialize(*zero);
+        REQUIRE(divideCase != nullptr);
+        zeros.emplace(lround(divideCase->GetMostSigOp().GetValue()), lround(divideCase->GetLeastSigOp().GetValue()));
+    }
+
+    REQUIRE(zeros == std::set<std::tuple<long, long>> { { 7, 1000003 }, { -11, 1000033 } });
+}
@@ -0,0 +1,102 @@
+#include <memory>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Imaginary.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/ProductNormalizer.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Product Normalizer Sums Exponents Of Like Bases", "[ProductNormalizer]")
+{
+    const Oasis::Variable x { "x" };
+    const Oasis::Variable y { "y" };
+    const Oasis::Variable n { "n" };
+
+    // 2x * y * x^n * 3 * x^2 * y
+    const Oasis::Multiply<Oasis::Expression> product {
+        Oasis::Multiply<Oasis::Expression> {
+            Oasis::Multiply<Oasis::Expression> { Oasis::Multiply { Oasis::Real { 2.0 }, x }, y },
+            Oasis::Multiply<Oasis::Expression> { Oasis::Exponent { x, n }, Oasis::Real { 3.0 } } },
+        Oasis::Multiply<Oasis::Expression> { Oasis::Exponent { x, Oasis::Real { 2.0 } }, y }
+    };
+
+    Oasis::ProductNormalizer normalizer;
+    normalizer.MultiplyBy(product);
+
+    // 6 * x^(n + 3) * y^2
+    const Oasis::Multiply<Oasis::Expression> expected {
+        Oasis::Multiply<Oasis::Expression> {
+            Oasis::Real { 6.0 },
+            Oasis::Exponent { x, Oasis::Add { n, Oasis::Real { 3.0 } } } },
+        Oasis::Exponent { y, Oasis::Real { 2.0 } }
+    };
+
+    REQUIRE(normalizer.BuildProduct()->Equals(expected));
+    REQUIRE(product.Simplify()->Equals(expected));
+}
+
+TEST_CASE("Product Normalizer Cancels Factors Of A Quotient", "[ProductNormalizer]")
+{
+    const Oasis::Variable x { "x" };
+    const Oasis::Variable y { "y" };
+    const Oasis::Add xPlusOne { x, Oasis::Real { 1.0 } };
+
+    // (4 * (x + 1) * x^3 * y) / (2 * x * y^2 * (x + 1))
+    const Oasis::Multiply<Oasis::Expression> dividend {
+        Oasis::Multiply<Oasis::Expression> { Oasis::Real { 4.0 }, xPlusOne },
+        Oasis::Multiply<Oasis::Expression> { Oasis::Exponent { x, Oasis::Real { 3.0 } }, y }
+    };
+    const Oasis::Multiply<Oasis::Expression> divisor {
+        Oasis::Multiply<Oasis::Expression> { Oasis::Real { 2.0 }, x },
+        Oasis::Multiply<Oasis::Expression> { Oasis::Exponent { y, Oasis::Real { 2.0 } }, xPlusOne }
+    };
+
+    Oasis::ProductNormalizer normalizer;
+    normalizer.MultiplyBy(dividend);
+    normalizer.DivideBy(divisor);
+
+    // (2 * x^2) / y
+    const Oasis::Divide expected {
+        Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Exponent { x, Oasis::Real { 2.0 } } },
+        y
+    };
+
+    REQUIRE(normalizer.BuildQuotient()->Equals(expected));
+    REQUIRE(Oasis::Divide { dividend, divisor }.Simplify()->Equals(expected));
+
+    // As a product, the divisor's factors have negative exponents.
+    const Oasis::Multiply<Oasis::Expression> expectedProduct {
+        Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Exponent { x, Oasis::Real { 2.0 } } },
+        Oasis::Exponent { y, Oasis::Real { -1.0 } }
+    };
+
+    REQUIRE(normalizer.BuildProduct()->Equals(expectedProduct));
+}
+
+TEST_CASE("Product Normalizer Reduces Powers Of i", "[ProductNormalizer][Imaginary]")
+{
+    std::vector<std::unique_ptr<Oasis::Expression>> factors;
+
+    for (int i = 0; i < 7; ++i) {
+        factors.push_back(std::make_unique<Oasis::Imaginary>());
+    }
+
+    // i^7 = -i
+    const auto product = Oasis::BuildFromVector<Oasis::Multiply>(factors);
+
+    Oasis::ProductNormalizer normalizer;
+    normalizer.MultiplyBy(*product);
+
+    REQUIRE(normalizer.BuildProduct()->Equals(Oasis::Multiply { Oasis::Real { -1.0 }, Oasis::Imaginary {} }));
+
+    // i^7 * i = 1
+    const Oasis::Imaginary i;
+    normalizer.MultiplyBy(i);
+    REQUIRE(normalizer.BuildProduct()->Equals(Oasis::Real { 1.0 }));
+}
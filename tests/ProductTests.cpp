@@ -0,0 +1,53 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Product.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Product Is Distinct From Nested Multiply", "[Product]")
+{
+    const Oasis::Product product {
+        Oasis::Real { 2.0 },
+        Oasis::Variable { "x" },
+        Oasis::Variable { "y" }
+    };
+
+    const Oasis::Multiply<Oasis::Expression> multiply {
+        Oasis::Variable { "y" },
+        Oasis::Multiply { Oasis::Variable { "x" }, Oasis::Real { 2.0 } }
+    };
+
+    REQUIRE(product.Is<Oasis::Product>());
+    REQUIRE_FALSE(product.Is<Oasis::Multiply>());
+    REQUIRE_FALSE(product.Equals(multiply));
+    REQUIRE_FALSE(multiply.Equals(product));
+    REQUIRE(product.Generalize()->Equals(multiply));
+    REQUIRE(Oasis::Product::Specialize(multiply)->Equals(product));
+}
+
+TEST_CASE("Product Simplify Combines Like Factors", "[Product]")
+{
+    const Oasis::Product product {
+        Oasis::Real { 2.0 },
+        Oasis::Variable { "x" },
+        Oasis::Real { 3.0 },
+        Oasis::Variable { "x" }
+    };
+
+    const auto simplified = product.Simplify();
+
+    const Oasis::Product expected {
+        Oasis::Real { 6.0 },
+        Oasis::Exponent { Oasis::Variable { "x" }, Oasis::Real { 2.0 } }
+    };
+
+    REQUIRE(simplified->Equals(expected));
+
+    const Oasis::Product zero { Oasis::Variable { "x" }, Oasis::Real { 0.0 }, Oasis::Variable { "y" } };
+    REQUIRE(zero.Simplify()->Equals(Oasis::Real { 0.0 }));
+
+    const Oasis::Product one { Oasis::Real { 1.0 }, Oasis::Variable { "x" } };
+    REQUIRE(one.Simplify()->Equals(Oasis::Variable { "x" }));
+}
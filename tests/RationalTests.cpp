@@ -0,0 +1,130 @@
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/BigInt.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Fraction.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("BigInt Arithmetic", "[BigInt]")
+{
+    // 30! = 265252859812191058636308480000000
+    Oasis::BigInt factorial { 1 };
+
+    for (std::int64_t i = 2; i <= 30; ++i) {
+        factorial = factorial * Oasis::BigInt { i };
+    }
+
+    REQUIRE(factorial.ToString() == "265252859812191058636308480000000");
+    REQUIRE(Oasis::BigInt::FromString("265252859812191058636308480000000") == factorial);
+
+    // 30! / 20! = 21 * 22 * ... * 30
+    Oasis::BigInt partial { 1 };
+
+    for (std::int64_t i = 2; i <= 20; ++i) {
+        partial = partial * Oasis::BigInt { i };
+    }
+
+    const auto [quotient, remainder] = Oasis::BigInt::DivRem(factorial, partial);
+    REQUIRE(quotient.ToString() == "109027350432000");
+    REQUIRE(remainder.IsZero());
+
+    // Division rounds toward zero, and the remainder has the sign of the dividend.
+    const auto [negativeQuotient, negativeRemainder] = Oasis::BigInt::DivRem(-(factorial + Oasis::BigInt { 7 }), partial);
+    REQUIRE(negativeQuotient == -quotient);
+    REQUIRE(negativeRemainder == Oasis::BigInt { -7 });
+
+    REQUIRE(Oasis::BigInt::Gcd(factorial, Oasis::BigInt { 2 }.Pow(100)) == Oasis::BigInt { 2 }.Pow(26));
+    REQUIRE(Oasis::BigInt { std::numeric_limits<std::int64_t>::min() }.ToInt64() == std::numeric_limits<std::int64_t>::min());
+    REQUIRE_FALSE((Oasis::BigInt { std::numeric_limits<std::int64_t>::max() } + Oasis::BigInt { 1 }).FitsInt64());
+    REQUIRE(-factorial < Oasis::BigInt { -1 });
+    REQUIRE_THROWS_AS(factorial / Oasis::BigInt {}, std::domain_error);
+}
+
+TEST_CASE("BigInt And Fraction Round To The Nearest Double", "[BigInt]")
+{
+    const Oasis::BigInt power = Oasis::BigInt { 2 }.Pow(100);
+
+    // Halfway between two doubles rounds to the even one, and anything past halfway rounds up.
+    REQUIRE(Oasis::BigInt { (std::int64_t { 1 } << 53) + 1 }.ToDouble() == 0x1p53);
+    REQUIRE((power + Oasis::BigInt { 2 }.Pow(47)).ToDouble() == 0x1p100);
+    REQUIRE((power + Oasis::BigInt { 2 }.Pow(47) + Oasis::BigInt { 1 }).ToDouble() == 0x1p100 + 0x1p48);
+    REQUIRE((-power - Oasis::BigInt { 2 }.Pow(47) - Oasis::BigInt { 1 }).ToDouble() == -(0x1p100 + 0x1p48));
+
+    // The numerator and the denominator are each out of the range of a double, but not their quotient.
+    const Oasis::BigInt ten = Oasis::BigInt { 10 }.Pow(400);
+    REQUIRE(Oasis::Fraction { ten, ten / Oasis::BigInt { 10 } * Oasis::BigInt { 3 } }.ToDouble() == 10.0 / 3.0);
+    REQUIRE(Oasis::Fraction { ten, Oasis::BigInt { 1 } }.ToDouble() == std::numeric_limits<double>::infinity());
+}
+
+TEST_CASE("Fraction Spills Only On Overflow", "[Fraction]")
+{
+    const Oasis::Fraction third { 1, 3 };
+    REQUIRE(third + Oasis::Fraction { 1, 6 } == Oasis::Fraction { 1, 2 });
+    REQUIRE(Oasis::Fraction { 4, -6 } == Oasis::Fraction { -2, 3 });
+    REQUIRE((third + third).IsInline());
+
+    // A tenth added ten times is exactly one, unlike 0.1 in a double.
+    Oasis::Fraction sum;
+
+    for (int i = 0; i < 10; ++i) {
+        sum = sum + Oasis::Fraction { 1, 10 };
+    }
+
+    REQUIRE(sum == Oasis::Fraction { 1 });
+
+    const Oasis::Fraction large { std::int64_t { 1 } << 62 };
+    const Oasis::Fraction spilled = large * Oasis::Fraction { 4 };
+    REQUIRE_FALSE(spilled.IsInline());
+    REQUIRE(spilled.GetNumerator() == Oasis::BigInt { 2 }.Pow(64));
+
+    // A result that fits again is stored inline again.
+    const Oasis::Fraction back = spilled / Oasis::Fraction { 8 };
+    REQUIRE(back.IsInline());
+    REQUIRE(back == Oasis::Fraction { std::int64_t { 1 } << 61 });
+
+    REQUIRE(Oasis::Fraction { 2, 3 }.Pow(-2) == Oasis::Fraction { 9, 4 });
+    REQUIRE(Oasis::Fraction::FromDouble(0.375) == Oasis::Fraction { 3, 8 });
+    REQUIRE(third < Oasis::Fraction { 1, 2 });
+    REQUIRE_THROWS_AS(Oasis::Fraction(1, 0), std::domain_error);
+}
+
+TEST_CASE("Rational Constants Fold Exactly", "[Rational]")
+{
+    const Oasis::Rational half { 1, 2 };
+    const Oasis::Rational third { 1, 3 };
+
+    REQUIRE(Oasis::Add { half, third }.Simplify()->Equals(Oasis::Rational { 5, 6 }));
+    REQUIRE(Oasis::Multiply { half, third }.Simplify()->Equals(Oasis::Rational { 1, 6 }));
+    REQUIRE(Oasis::Divide { half, third }.Simplify()->Equals(Oasis::Rational { 3, 2 }));
+    REQUIRE(Oasis::Exponent { Oasis::Rational { 2, 3 }, Oasis::Rational { 100, 1 } }.Simplify()->Equals(Oasis::Rational { Oasis::Fraction { Oasis::BigInt { 2 }.Pow(100), Oasis::BigInt { 3 }.Pow(100) } }));
+
+    // Folding with a real is inexact.
+    const auto mixed = Oasis::Add { half, Oasis::Real { 0.25 } }.Simplify();
+    REQUIRE(mixed->Equals(Oasis::Real { 0.75 }));
+
+    // Like terms with rational coefficients are combined exactly.
+    const Oasis::Variable x { "x" };
+    const Oasis::Add terms { Oasis::Multiply { half, x }, Oasis::Multiply { third, x } };
+    REQUIRE(terms.Simplify()->Equals(Oasis::Multiply { Oasis::Rational { 5, 6 }, x }));
+
+    // A sum of many rational constants stays exact.
+    std::vector<std::unique_ptr<Oasis::Expression>> tenths;
+
+    for (int i = 0; i < 10; ++i) {
+        tenths.push_back(std::make_unique<Oasis::Rational>(1, 10));
+    }
+
+    tenths.push_back(x.Copy());
+    REQUIRE(Oasis::BuildFromVector<Oasis::Add>(tenths)->Simplify()->Equals(Oasis::Add { Oasis::Rational { 1, 1 }, x }));
+}
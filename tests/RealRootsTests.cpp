@@ -0,0 +1,101 @@
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Rational.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/RealRoots.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Isolate Real Roots", "[RealRoots]")
+{
+    // (x - 1)(x - 2)(x - 3)(x^2 + 1) = x^5 - 6x^4 + 12x^3 - 12x^2 + 11x - 6
+    const std::vector<Oasis::BigInt> coefficients { -6, 11, -12, 12, -6, 1 };
+
+    const auto intervals = Oasis::IsolateRealRoots(coefficients, -10, 10);
+    REQUIRE(intervals.size() == 3);
+
+    for (std::size_t i = 0; i < intervals.size(); ++i) {
+        const auto& [lower, upper] = intervals[i];
+        const Oasis::Fraction root { static_cast<std::int64_t>(i + 1) };
+        REQUIRE(lower < root);
+        REQUIRE(root <= upper);
+    }
+
+    // A root at the lower end is reported exactly, and a root at the upper end is in the last interval.
+    const auto ends = Oasis::IsolateRealRoots(coefficients, 1, 3);
+    REQUIRE(ends.size() == 3);
+    REQUIRE(ends.front() == std::pair { Oasis::Fraction { 1 }, Oasis::Fraction { 1 } });
+    REQUIRE(ends.back().second == Oasis::Fraction { 3 });
+
+    REQUIRE(Oasis::IsolateRealRoots(coefficients, 4, 10).empty());
+    REQUIRE(Oasis::IsolateRealRoots(std::vector<Oasis::BigInt> { 7 }, -1, 1).empty());
+    REQUIRE_THROWS_AS(Oasis::IsolateRealRoots(std::vector<Oasis::BigInt> { 0, 0 }, -1, 1), std::domain_error);
+}
+
+TEST_CASE("Find Real Roots", "[RealRoots]")
+{
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+
+    // (x - 1)^2 (x + 1/2)(x^2 - 2) = x^5 - 3/2 x^4 - 2x^3 + 7/2 x^2 - 1, whose repeated root is
+    // reported once
+    const std::vector<double> coefficients { -1, 0, 3.5, -2, -1.5, 1 };
+    const std::vector<double> expected { -std::sqrt(2.0), -0.5, 1.0, std::sqrt(2.0) };
+
+    const auto roots = Oasis::FindRealRoots(coefficients, -infinity, infinity);
+    REQUIRE(roots.size() == expected.size());
+
+    for (std::size_t i = 0; i < roots.size(); ++i) {
+        REQUIRE(std::abs(roots[i] - expected[i]) <= 1e-12);
+    }
+
+    const auto positive = Oasis::FindRealRoots(coefficients, 0, infinity, 1e-6);
+    REQUIRE(positive.size() == 2);
+    REQUIRE(std::abs(positive.back() - std::sqrt(2.0)) <= 1e-6);
+
+    REQUIRE_THROWS_AS(Oasis::FindRealRoots(std::vector { 0.0 }, -1, 1), std::domain_error);
+    REQUIRE_THROWS_AS(Oasis::FindRealRoots(coefficients, -1, 1, 0), std::domain_error);
+}
+
+TEST_CASE("Real Zeros Of An Expression", "[RealRoots][Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+
+    // x^3 - 2 has one real zero, which FindZeros cannot express.
+    const Oasis::Subtract expression { Oasis::Exponent { x, Oasis::Real { 3.0 } }, Oasis::Real { 2.0 } };
+
+    const auto zeros = expression.FindRealZeros(-10, 10);
+    REQUIRE(zeros.size() == 1);
+    REQUIRE(std::abs(zeros.front() - std::cbrt(2.0)) <= 1e-12);
+
+    REQUIRE(expression.FindRealZeros(-10, 1).empty());
+    REQUIRE(Oasis::Add { x, Oasis::Variable { "y" } }.FindRealZeros(-1, 1).empty());
+}
+
+TEST_CASE("Real Zeros Of An Expression With Close Rational Zeros", "[RealRoots][Polynomial]")
+{
+    const Oasis::Variable x { "x" };
+    const Oasis::Rational third { 1, 3 };
+    const Oasis::Rational nearThird { Oasis::Fraction { 1, 3 } + Oasis::Fraction { 1, 1'000'000'000'000'000'000 } };
+
+    // The zeros of (x - 1/3)^2 and of (x - 1/3)(x - 1/3 - 10^-18) are told apart only by the exact
+    // coefficients, which round to the same doubles.
+    const Oasis::Multiply repeated { Oasis::Subtract { x, third }, Oasis::Subtract { x, third } };
+    const Oasis::Multiply close { Oasis::Subtract { x, third }, Oasis::Subtract { x, nearThird } };
+
+    const auto repeatedZeros = repeated.FindRealZeros(-1, 1);
+    REQUIRE(repeatedZeros.size() == 1);
+    REQUIRE(std::abs(repeatedZeros.front() - 1.0 / 3.0) <= 1e-12);
+
+    const auto closeZeros = close.FindRealZeros(-1, 1);
+    REQUIRE(closeZeros.size() == 2);
+    REQUIRE(std::abs(closeZeros.front() - 1.0 / 3.0) <= 1e-12);
+    REQUIRE(std::abs(closeZeros.back() - 1.0 / 3.0) <= 1e-12);
+}
@@ -0,0 +1,59 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Divide.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/RuleTable.hpp"
+#include "Oasis/Variable.hpp"
+
+namespace {
+
+int multiplyRuleCalls = 0;
+
+} // namespace
+
+TEST_CASE("Rules Are Only Tried On Matching Operand Types", "[RuleTable]")
+{
+    const Oasis::RuleTable<Oasis::Add> rules {
+        Oasis::RuleTable<Oasis::Add>::Make<Oasis::Add<Oasis::Multiply<Oasis::Expression>, Oasis::Expression>>([](const auto&) -> std::unique_ptr<Oasis::Expression> {
+            ++multiplyRuleCalls;
+            return nullptr;
+        }),
+        Oasis::RuleTable<Oasis::Add>::Make<Oasis::Add<Oasis::Real, Oasis::Variable>>([](const auto& view) -> std::unique_ptr<Oasis::Expression> {
+            return view.GetLeastSigOp().Copy();
+        }),
+        Oasis::RuleTable<Oasis::Add>::Make<Oasis::Add<Oasis::Expression>>([](const auto&) -> std::unique_ptr<Oasis::Expression> {
+            return std::make_unique<Oasis::Real>(0.0);
+        }),
+    };
+
+    multiplyRuleCalls = 0;
+
+    // Addition is commutative, so the second rule also matches the swapped operands, and is tried
+    // before the catch-all rule. The first rule is never tried, since neither operand is a product.
+    const Oasis::Add<Oasis::Expression> swapped { Oasis::Variable { "x" }, Oasis::Real { 1.0 } };
+    const auto result = rules.Apply(swapped);
+
+    REQUIRE(result->Equals(Oasis::Variable { "x" }));
+    REQUIRE(multiplyRuleCalls == 0);
+
+    const Oasis::Add<Oasis::Expression> product { Oasis::Real { 1.0 }, Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Variable { "x" } } };
+    REQUIRE(rules.Apply(product)->Equals(Oasis::Real { 0.0 }));
+    REQUIRE(multiplyRuleCalls == 1);
+}
+
+TEST_CASE("Rules Respect Operand Order Of Non-Commutative Expressions", "[RuleTable]")
+{
+    const Oasis::RuleTable<Oasis::Divide> rules {
+        Oasis::RuleTable<Oasis::Divide>::Make<Oasis::Divide<Oasis::Real, Oasis::Variable>>([](const auto& view) -> std::unique_ptr<Oasis::Expression> {
+            return view.GetMostSigOp().Copy();
+        }),
+    };
+
+    const Oasis::Divide<Oasis::Expression> matching { Oasis::Real { 2.0 }, Oasis::Variable { "x" } };
+    const Oasis::Divide<Oasis::Expression> swapped { Oasis::Variable { "x" }, Oasis::Real { 2.0 } };
+
+    REQUIRE(rules.Apply(matching)->Equals(Oasis::Real { 2.0 }));
+    REQUIRE(rules.Apply(swapped) == nullptr);
+}
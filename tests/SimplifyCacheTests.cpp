@@ -0,0 +1,106 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/SimplifyCache.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Equal Subtrees Are Simplified Once", "[SimplifyCache]")
+{
+    const Oasis::Multiply term {
+        Oasis::Add { Oasis::Real { 1.0 }, Oasis::Real { 2.0 } },
+        Oasis::Variable { "x" }
+    };
+
+    const Oasis::Add add { term, term };
+
+    Oasis::SimplifyCache cache;
+    std::unique_ptr<Oasis::Expression> simplified;
+
+    {
+        Oasis::SimplifyCache::Scope scope { cache };
+        simplified = add.Simplify();
+    }
+
+    REQUIRE(simplified->Equals(Oasis::Multiply { Oasis::Real { 6.0 }, Oasis::Variable { "x" } }));
+    REQUIRE(cache.GetHits() > 0);
+
+    const auto hits = cache.GetHits();
+    const auto misses = cache.GetMisses();
+
+    {
+        Oasis::SimplifyCache::Scope scope { cache };
+        REQUIRE(add.Simplify()->Equals(*simplified));
+    }
+
+    REQUIRE(cache.GetHits() == hits + 1);
+    REQUIRE(cache.GetMisses() == misses);
+
+    // Without an active cache, nothing is recorded.
+    REQUIRE(add.Simplify()->Equals(*simplified));
+    REQUIRE(cache.GetHits() == hits + 1);
+}
+
+TEST_CASE("Least Recently Used Entries Are Evicted", "[SimplifyCache]")
+{
+    Oasis::SimplifyCache cache { 2 };
+
+    const Oasis::Add a { Oasis::Real { 1.0 }, Oasis::Real { 2.0 } };
+    const Oasis::Add b { Oasis::Real { 3.0 }, Oasis::Real { 4.0 } };
+    const Oasis::Add c { Oasis::Real { 5.0 }, Oasis::Real { 6.0 } };
+
+    cache.Insert(a, Oasis::Real { 3.0 });
+    cache.Insert(b, Oasis::Real { 7.0 });
+    REQUIRE(cache.Find(a) != nullptr);
+
+    cache.Insert(c, Oasis::Real { 11.0 });
+    REQUIRE(cache.GetSize() == 2);
+    REQUIRE(cache.Find(b) == nullptr);
+    REQUIRE(cache.Find(a)->Equals(Oasis::Real { 3.0 }));
+    REQUIRE(cache.Find(c)->Equals(Oasis::Real { 11.0 }));
+
+    REQUIRE(cache.GetHits() == 3);
+    REQUIRE(cache.GetMisses() == 1);
+
+    cache.Clear();
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(cache.GetHits() == 0);
+}
+
+TEST_CASE("Global Cache Is Used By SimplifyAsync", "[SimplifyCache]")
+{
+    const Oasis::Add add {
+        Oasis::Add { Oasis::Real { 1.0 }, Oasis::Real { 2.0 } },
+        Oasis::Add { Oasis::Real { 1.0 }, Oasis::Real { 2.0 } }
+    };
+
+    Oasis::SimplifyCache cache;
+    Oasis::SimplifyCache::SetGlobal(&cache);
+
+    const auto first = add.Simplify();
+    const auto second = add.SimplifyAsync();
+
+    Oasis::SimplifyCache::SetGlobal(nullptr);
+
+    REQUIRE(first->Equals(*second));
+    REQUIRE(first->Equals(Oasis::Real { 6.0 }));
+    REQUIRE(cache.GetHits() > 0);
+    REQUIRE(Oasis::SimplifyCache::GetCurrent() == nullptr);
+}
+
+TEST_CASE("SimplifyAsync Does Not Cache Partly Simplified Expressions", "[SimplifyCache]")
+{
+    const Oasis::Add add { Oasis::Variable { "y" }, Oasis::Variable { "y" } };
+
+    Oasis::SimplifyCache cache;
+    Oasis::SimplifyCache::SetGlobal(&cache);
+
+    const auto async = add.SimplifyAsync();
+    const auto simplified = Oasis::Add { Oasis::Variable { "y" }, Oasis::Variable { "y" } }.Simplify();
+
+    Oasis::SimplifyCache::SetGlobal(nullptr);
+
+    REQUIRE_FALSE(async->IsSimplified());
+    REQUIRE(simplified->Equals(Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Variable { "y" } }));
+}
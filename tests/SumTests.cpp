@@ -0,0 +1,96 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Sum.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Sum Is Distinct From Nested Add", "[Sum]")
+{
+    const Oasis::Sum sum {
+        Oasis::Real { 1.0 },
+        Oasis::Variable { "x" },
+        Oasis::Real { 2.0 }
+    };
+
+    const Oasis::Add<Oasis::Expression> add {
+        Oasis::Add { Oasis::Real { 2.0 }, Oasis::Real { 1.0 } },
+        Oasis::Variable { "x" }
+    };
+
+    REQUIRE(sum.Is<Oasis::Sum>());
+    REQUIRE_FALSE(sum.Is<Oasis::Add>());
+    REQUIRE(sum.GetOperandCount() == 3);
+    REQUIRE_FALSE(sum.Equals(add));
+    REQUIRE_FALSE(add.Equals(sum));
+
+    const auto generalized = sum.Generalize();
+    REQUIRE(Oasis::Add<Oasis::Expression>::Specialize(*generalized) != nullptr);
+    REQUIRE(generalized->Equals(add));
+
+    // Terms are compared in any order, and nested sums and adds are flattened.
+    const Oasis::Sum nested {
+        Oasis::Sum { Oasis::Variable { "x" }, Oasis::Real { 2.0 } },
+        Oasis::Add { Oasis::Real { 1.0 }, Oasis::Real { 0.0 } }
+    };
+
+    const Oasis::Sum reordered {
+        Oasis::Sum { Oasis::Variable { "x" }, Oasis::Real { 2.0 } },
+        Oasis::Real { 1.0 },
+        Oasis::Real { 0.0 }
+    };
+
+    REQUIRE(nested.Equals(reordered));
+    REQUIRE(nested.Hash() == reordered.Hash());
+
+    // An Add treats a Sum as a single term.
+    const Oasis::Add<Oasis::Expression> wrapped { sum, Oasis::Real { 3.0 } };
+    REQUIRE_FALSE(wrapped.Equals(Oasis::Add<Oasis::Expression> { add, Oasis::Real { 3.0 } }));
+}
+
+TEST_CASE("Sum Specialize Flattens And Shares Operands", "[Sum]")
+{
+    const Oasis::Add<Oasis::Expression> add {
+        Oasis::Add { Oasis::Real { 1.0 }, Oasis::Variable { "x" } },
+        Oasis::Add { Oasis::Real { 2.0 }, Oasis::Variable { "y" } }
+    };
+
+    const auto sum = Oasis::Sum::Specialize(add);
+
+    REQUIRE(sum != nullptr);
+    REQUIRE(sum->GetOperandCount() == 4);
+    REQUIRE(&sum->GetOperandAt(0) == &add.GetMostSigOp().GetOperandAt(0));
+    REQUIRE(sum->Generalize()->Equals(add));
+    REQUIRE(Oasis::Sum::Specialize(*sum)->Equals(*sum));
+
+    REQUIRE(Oasis::Sum::Specialize(Oasis::Multiply { Oasis::Real { 1.0 }, Oasis::Real { 2.0 } }) == nullptr);
+}
+
+TEST_CASE("Sum Simplify Combines Like Terms", "[Sum]")
+{
+    const Oasis::Sum sum {
+        Oasis::Multiply { Oasis::Real { 2.0 }, Oasis::Variable { "x" } },
+        Oasis::Real { 1.0 },
+        Oasis::Multiply { Oasis::Real { 3.0 }, Oasis::Variable { "x" } },
+        Oasis::Real { 4.0 },
+        Oasis::Variable { "y" }
+    };
+
+    const auto simplified = sum.Simplify();
+
+    const Oasis::Sum expected {
+        Oasis::Real { 5.0 },
+        Oasis::Multiply { Oasis::Real { 5.0 }, Oasis::Variable { "x" } },
+        Oasis::Variable { "y" }
+    };
+
+    REQUIRE(simplified->GetOperandCount() == 3);
+    REQUIRE(simplified->Equals(expected));
+
+    const auto simplifiedAsync = sum.SimplifyAsync();
+    REQUIRE(simplifiedAsync->Equals(expected));
+
+    const Oasis::Sum reals { Oasis::Real { 1.0 }, Oasis::Real { -1.0 }, Oasis::Real { 0.0 } };
+    REQUIRE(reals.Simplify()->Equals(Oasis::Real { 0.0 }));
+}
@@ -0,0 +1,51 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/SymbolTable.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Names Are Interned Once", "[SymbolTable]")
+{
+    Oasis::SymbolTable table;
+
+    const auto x = table.Intern("x");
+    const auto y = table.Intern("y");
+
+    REQUIRE(x != y);
+    REQUIRE(table.Intern(std::string { "x" }) == x);
+    REQUIRE(table.GetName(x) == "x");
+    REQUIRE(table.GetName(y) == "y");
+    REQUIRE(&table.GetName(x) == &table.GetName(table.Intern("x")));
+
+    // The empty name is always present.
+    REQUIRE(table.Intern("") == 0);
+    REQUIRE(table.GetSize() == 3);
+}
+
+TEST_CASE("Variables Share Symbols", "[SymbolTable]")
+{
+    const Oasis::Variable x1 { "x" };
+    const Oasis::Variable x2 { std::string { "x" } };
+    const Oasis::Variable y { "y" };
+
+    REQUIRE(x1.GetSymbol() == x2.GetSymbol());
+    REQUIRE(x1.GetSymbol() != y.GetSymbol());
+    REQUIRE(&x1.GetName() == &x2.GetName());
+    REQUIRE(x1.Equals(x2));
+    REQUIRE_FALSE(x1.Equals(y));
+    REQUIRE(x1.Hash() == x2.Hash());
+    REQUIRE(x1.ToString() == "x");
+
+    const Oasis::Variable unnamed;
+    REQUIRE(unnamed.GetSymbol() == 0);
+    REQUIRE(unnamed.GetName().empty());
+}
+
+TEST_CASE("Default Variables Have The Empty Name", "[SymbolTable]")
+{
+    const Oasis::Variable unnamed;
+
+    REQUIRE(unnamed.GetSymbol() == Oasis::SymbolTable::EmptyId);
+    REQUIRE(unnamed.GetName().empty());
+    REQUIRE(unnamed.Equals(Oasis::Variable { "" }));
+    REQUIRE(Oasis::SymbolTable {}.Intern("") == Oasis::SymbolTable::EmptyId);
+}
@@ -0,0 +1,212 @@
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Traversal.hpp"
+#include "Oasis/UniqueTable.hpp"
+#include "Oasis/Variable.hpp"
+
+namespace {
+
+// Builds ((((x + 1) + 1) + ...) + 1), which is as deep as it has terms. Copies are shallow, so each
+// level only allocates the new node.
+auto MakeChain(std::size_t depth) -> std::unique_ptr<Oasis::Expression>
+{
+    std::unique_ptr<Oasis::Expression> chain = std::make_unique<Oasis::Variable>("x");
+
+    for (std::size_t i = 0; i < depth; ++i) {
+        chain = std::make_unique<Oasis::Add<Oasis::Expression>>(*chain, Oasis::Real { 1.0 });
+    }
+
+    return chain;
+}
+
+constexpr std::size_t DeepChainDepth = 100'000;
+
+}
+
+TEST_CASE("PreOrder And PostOrder Visit Nodes In Order", "[Traversal]")
+{
+    const Oasis::Add add {
+        Oasis::Multiply { Oasis::Variable { "a" }, Oasis::Variable { "b" } },
+        Oasis::Variable { "x" }
+    };
+
+    std::vector<std::string> preOrder;
+    Oasis::PreOrder(add, [&preOrder](const Oasis::Expression& node) {
+        preOrder.push_back(node.ToString());
+        return true;
+    });
+
+    REQUIRE(preOrder == std::vector<std::string> { "((a * b) + x)", "(a * b)", "a", "b", "x" });
+
+    std::vector<std::string> postOrder;
+    Oasis::PostOrder(
+        add,
+        [](const Oasis::Expression& node) { return !node.Is<Oasis::Multiply>(); },
+        [&postOrder](const Oasis::Expression& node) { postOrder.push_back(node.ToString()); });
+
+    REQUIRE(postOrder == std::vector<std::string> { "x", "((a * b) + x)" });
+}
+
+TEST_CASE("Transform Rebuilds Expressions Bottom Up", "[Traversal]")
+{
+    const Oasis::Add add {
+        Oasis::Multiply { Oasis::Variable { "x" }, Oasis::Real { 2.0 } },
+        Oasis::Variable { "x" }
+    };
+
+    const auto result = Oasis::Transform(
+        add,
+        [](const Oasis::Expression& node, const std::shared_ptr<Oasis::Expression>&) -> std::shared_ptr<Oasis::Expression> {
+            if (node.Is<Oasis::Variable>()) {
+                return std::make_shared<Oasis::Variable>("y");
+            }
+
+            return nullptr;
+        },
+        [](const Oasis::Expression&, const std::shared_ptr<Oasis::Expression>& rebuilt) { return rebuilt; });
+
+    const Oasis::Add expected {
+        Oasis::Multiply { Oasis::Variable { "y" }, Oasis::Real { 2.0 } },
+        Oasis::Variable { "y" }
+    };
+
+    REQUIRE(result->Equals(expected));
+
+    // Nodes whose operands are unchanged are not rebuilt.
+    const auto unchanged = Oasis::Transform(
+        add,
+        [](const Oasis::Expression&, const std::shared_ptr<Oasis::Expression>&) -> std::shared_ptr<Oasis::Expression> { return nullptr; },
+        [](const Oasis::Expression&, const std::shared_ptr<Oasis::Expression>& rebuilt) { return rebuilt; });
+
+    REQUIRE(&unchanged->GetOperandAt(0) == &add.GetOperandAt(0));
+}
+
+TEST_CASE("Shared Operands Are Transformed Once", "[Traversal]")
+{
+    // (((x + x) + (x + x)) + ...), which has 2^64 paths from the root, but only 65 distinct nodes.
+    const Oasis::Add<Oasis::Expression> add;
+    std::shared_ptr<Oasis::Expression> expression = Oasis::Variable { "x" }.Copy();
+
+    for (int i = 0; i < 64; ++i) {
+        const std::array<std::shared_ptr<Oasis::Expression>, 2> operands { expression, expression };
+        expression = add.WithOperands(operands);
+    }
+
+    std::size_t exits = 0;
+
+    const auto renamed = Oasis::Transform(
+        *expression,
+        [](const Oasis::Expression& node, const std::shared_ptr<Oasis::Expression>&) -> std::shared_ptr<Oasis::Expression> {
+            return node.Is<Oasis::Variable>() ? std::make_shared<Oasis::Variable>("y") : nullptr;
+        },
+        [&exits](const Oasis::Expression&, const std::shared_ptr<Oasis::Expression>& rebuilt) {
+            ++exits;
+            return rebuilt;
+        });
+
+    REQUIRE(exits == 64);
+    REQUIRE(&renamed->GetOperandAt(0) == &renamed->GetOperandAt(1));
+
+    const auto simplified = expression->Simplify();
+    REQUIRE(simplified->Equals(Oasis::Multiply { Oasis::Real { std::ldexp(1.0, 64) }, Oasis::Variable { "x" } }));
+}
+
+TEST_CASE("Deep Expressions Do Not Exhaust The Stack", "[Traversal]")
+{
+    auto chain = MakeChain(DeepChainDepth);
+    const auto copy = chain->Copy();
+
+    REQUIRE(chain->Hash() == copy->Hash());
+    REQUIRE(chain->Equals(*copy));
+
+    std::vector<std::unique_ptr<Oasis::Expression>> flattened;
+    Oasis::Add<Oasis::Expression>::Specialize(*chain)->Flatten(flattened);
+    REQUIRE(flattened.size() == DeepChainDepth + 1);
+
+    const auto substituted = chain->Substitute(Oasis::Variable { "x" }, Oasis::Real { 0.0 });
+    auto real = Oasis::Real::Specialize(*substituted);
+    REQUIRE(real != nullptr);
+    REQUIRE(real->GetValue() == static_cast<double>(DeepChainDepth));
+
+    const auto simplified = chain->Simplify();
+    REQUIRE(simplified->IsSimplified());
+
+    chain.reset();
+}
+
+TEST_CASE("Deep Expressions Convert To Strings", "[Traversal]")
+{
+    // Each level copies its operands' strings, so the depth is kept small enough for the quadratic
+    // cost, but still deep enough to overflow a recursive conversion.
+    constexpr std::size_t depth = 20'000;
+    const auto chain = MakeChain(depth);
+
+    const std::string one = Oasis::Real { 1.0 }.ToString();
+    std::string expected = "x";
+
+    for (std::size_t i = 0; i < depth; ++i) {
+        expected = "(" + expected + " + " + one + ")";
+    }
+
+    REQUIRE(chain->ToString() == expected);
+}
+
+TEST_CASE("Deep Expressions Differentiate", "[Traversal][Differentiate]")
+{
+    // ((((x + 1) * y + 1) * y + ...) + 1) * y, which simplification leaves as deep as it is
+    const Oasis::Variable x { "x" };
+    const Oasis::Variable y { "y" };
+    std::unique_ptr<Oasis::Expression> chain = x.Copy();
+
+    for (std::size_t i = 0; i < DeepChainDepth; ++i) {
+        chain = std::make_unique<Oasis::Multiply<Oasis::Expression>>(Oasis::Add { *chain, Oasis::Real { 1.0 } }, y);
+    }
+
+    const auto derivative = chain->Differentiate(x);
+    REQUIRE(derivative->Equals(Oasis::Exponent { y, Oasis::Real { static_cast<double>(DeepChainDepth) } }));
+}
+
+TEST_CASE("Deep Expressions Intern", "[Traversal][UniqueTable]")
+{
+    const auto chain = MakeChain(DeepChainDepth);
+    const auto same = MakeChain(DeepChainDepth);
+
+    Oasis::UniqueTable table;
+    const auto interned = table.Intern(*chain);
+
+    // x, 1, and one sum per level
+    REQUIRE(table.GetSize() == DeepChainDepth + 2);
+    REQUIRE(table.Intern(*same) == interned);
+    REQUIRE(table.GetSize() == DeepChainDepth + 2);
+}
+
+TEST_CASE("Deep Expressions Compare Equal", "[Traversal]")
+{
+    // ((((x - 1) - 1) - ...) - 1), whose operands are compared in order
+    const auto subtractChain = [](double first) {
+        std::unique_ptr<Oasis::Expression> chain = std::make_unique<Oasis::Variable>("x");
+
+        for (std::size_t i = 0; i < DeepChainDepth; ++i) {
+            chain = std::make_unique<Oasis::Subtract<Oasis::Expression>>(*chain, Oasis::Real { i == 0 ? first : 1.0 });
+        }
+
+        return chain;
+    };
+
+    REQUIRE(subtractChain(1.0)->Equals(*subtractChain(1.0)));
+    REQUIRE_FALSE(subtractChain(1.0)->Equals(*subtractChain(2.0)));
+
+    // Sums are compared by their flattened terms.
+    REQUIRE(MakeChain(DeepChainDepth)->Equals(*MakeChain(DeepChainDepth)));
+    REQUIRE_FALSE(MakeChain(DeepChainDepth)->Equals(*MakeChain(DeepChainDepth - 1)));
+}
@@ -0,0 +1,123 @@
+#include <array>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/UniqueTable.hpp"
+#include "Oasis/Variable.hpp"
+
+TEST_CASE("Copies Share Operands", "[UniqueTable]")
+{
+    const Oasis::Add add {
+        Oasis::Multiply {
+            Oasis::Real { 2.0 },
+            Oasis::Variable { "x" } },
+        Oasis::Real { 1.0 }
+    };
+
+    const auto copy = add.Copy();
+
+    REQUIRE(&copy->GetOperandAt(0) == &add.GetOperandAt(0));
+    REQUIRE(&copy->GetOperandAt(1) == &add.GetOperandAt(1));
+    REQUIRE(copy->Equals(add));
+}
+
+TEST_CASE("Identical Subtrees Are Shared", "[UniqueTable]")
+{
+    Oasis::UniqueTable table;
+
+    const Oasis::Add add {
+        Oasis::Multiply {
+            Oasis::Real { 2.0 },
+            Oasis::Variable { "x" } },
+        Oasis::Multiply {
+            Oasis::Real { 2.0 },
+            Oasis::Variable { "x" } }
+    };
+
+    const auto interned = table.Intern(add);
+
+    REQUIRE(interned->Equals(add));
+    REQUIRE(&interned->GetOperandAt(0) == &interned->GetOperandAt(1));
+
+    // 2, x, 2 * x, and (2 * x) + (2 * x)
+    REQUIRE(table.GetSize() == 4);
+}
+
+TEST_CASE("Equal Expressions Intern To The Same Node", "[UniqueTable]")
+{
+    Oasis::UniqueTable table;
+
+    const Oasis::Exponent<Oasis::Variable, Oasis::Real> specialized {
+        Oasis::Variable { "x" },
+        Oasis::Real { 2.0 }
+    };
+
+    const Oasis::Exponent<Oasis::Expression> generalized {
+        Oasis::Variable { "x" },
+        Oasis::Real { 2.0 }
+    };
+
+    const auto first = table.Intern(specialized);
+    const auto second = table.Intern(generalized);
+    const auto different = table.Intern(Oasis::Exponent { Oasis::Variable { "x" }, Oasis::Real { 3.0 } });
+
+    REQUIRE(first == second);
+    REQUIRE(first != different);
+    REQUIRE(table.Contains(*first));
+    REQUIRE_FALSE(table.Contains(specialized));
+
+    REQUIRE(table.Intern(*first) == first);
+
+    table.Clear();
+    REQUIRE(table.GetSize() == 0);
+    REQUIRE(first->Equals(specialized));
+}
+
+TEST_CASE("Shared Subtrees Are Interned Once", "[UniqueTable]")
+{
+    Oasis::UniqueTable table;
+
+    // An expression with 2^64 paths from the root, but only 65 distinct nodes.
+    const Oasis::Add<Oasis::Expression> add;
+    std::shared_ptr<Oasis::Expression> expression = Oasis::Variable { "x" }.Copy();
+
+    for (int i = 0; i < 64; ++i) {
+        const std::array<std::shared_ptr<Oasis::Expression>, 2> operands { expression, expression };
+        expression = add.WithOperands(operands);
+    }
+
+    const auto interned = table.Intern(*expression);
+
+    REQUIRE(table.GetSize() == 65);
+    REQUIRE(&interned->GetOperandAt(0) == &interned->GetOperandAt(1));
+}
+
+TEST_CASE("Shared Operands Are Compared By Address", "[UniqueTable]")
+{
+    // An expression with 2^64 terms, which could not be compared term by term.
+    const Oasis::Add<Oasis::Expression> add;
+    std::shared_ptr<Oasis::Expression> shared = Oasis::Variable { "x" }.Copy();
+
+    for (int i = 0; i < 64; ++i) {
+        const std::array<std::shared_ptr<Oasis::Expression>, 2> operands { shared, shared };
+        shared = add.WithOperands(operands);
+    }
+
+    REQUIRE(shared->Copy()->Equals(*shared));
+
+    const auto sum = [&add](std::shared_ptr<Oasis::Expression> lhs, std::shared_ptr<Oasis::Expression> rhs) -> std::shared_ptr<Oasis::Expression> {
+        const std::array<std::shared_ptr<Oasis::Expression>, 2> operands { std::move(lhs), std::move(rhs) };
+        return add.WithOperands(operands);
+    };
+
+    const std::shared_ptr<Oasis::Expression> y = Oasis::Variable { "y" }.Copy();
+    const std::shared_ptr<Oasis::Expression> z = Oasis::Variable { "z" }.Copy();
+
+    // (shared + y) + z and (shared + z) + y
+    REQUIRE(sum(sum(shared, y), z)->Equals(*sum(sum(shared, z), y)));
+    REQUIRE_FALSE(sum(sum(shared, y), z)->Equals(*sum(sum(shared, z), z)));
+}
@@ -0,0 +1,72 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "Oasis/Add.hpp"
+#include "Oasis/Exponent.hpp"
+#include "Oasis/Multiply.hpp"
+#include "Oasis/Negate.hpp"
+#include "Oasis/Real.hpp"
+#include "Oasis/Subtract.hpp"
+#include "Oasis/Variable.hpp"
+#include "Oasis/View.hpp"
+
+TEST_CASE("View Refers To The Original Expression", "[View]")
+{
+    const Oasis::Multiply<Oasis::Expression> multiply {
+        Oasis::Real { 2.0 },
+        Oasis::Exponent {
+            Oasis::Variable { "x" },
+            Oasis::Real { 3.0 } }
+    };
+
+    const auto view = Oasis::View<Oasis::Multiply<Oasis::Real, Oasis::Exponent<Oasis::Variable, Oasis::Real>>>::Specialize(multiply);
+
+    REQUIRE(view.has_value());
+    REQUIRE(&view->Get() == &multiply);
+    REQUIRE(&view->GetMostSigOp() == &multiply.GetMostSigOp());
+    REQUIRE(&view->GetLeastSigOp().Get() == &multiply.GetLeastSigOp());
+    REQUIRE(view->GetMostSigOp().GetValue() == 2.0);
+    REQUIRE(view->GetLeastSigOp().GetMostSigOp().GetName() == "x");
+    REQUIRE(view->GetLeastSigOp().GetLeastSigOp().GetValue() == 3.0);
+}
+
+TEST_CASE("View Considers Commutative Property", "[View]")
+{
+    const Oasis::Multiply<Oasis::Expression> multiply {
+        Oasis::Multiply {
+            Oasis::Variable { "x" },
+            Oasis::Real { 2.0 } },
+        Oasis::Real { 3.0 }
+    };
+
+    const auto view = Oasis::View<Oasis::Multiply<Oasis::Real, Oasis::Multiply<Oasis::Real, Oasis::Variable>>>::Specialize(multiply);
+
+    REQUIRE(view.has_value());
+    REQUIRE(view->GetMostSigOp().GetValue() == 3.0);
+    REQUIRE(view->GetLeastSigOp().GetMostSigOp().GetValue() == 2.0);
+    REQUIRE(view->GetLeastSigOp().GetLeastSigOp().GetName() == "x");
+
+    const Oasis::Subtract<Oasis::Expression> subtract {
+        Oasis::Variable { "x" },
+        Oasis::Real { 2.0 }
+    };
+
+    REQUIRE_FALSE(Oasis::View<Oasis::Subtract<Oasis::Real, Oasis::Variable>>::Specialize(subtract).has_value());
+    REQUIRE(Oasis::View<Oasis::Subtract<Oasis::Variable, Oasis::Real>>::Specialize(subtract).has_value());
+}
+
+TEST_CASE("View Matches Like Specialize", "[View]")
+{
+    const Oasis::Add<Oasis::Expression> add {
+        Oasis::Negate { Oasis::Variable { "x" } },
+        Oasis::Real { 1.0 }
+    };
+
+    REQUIRE(Oasis::View<Oasis::Add<Oasis::Negate<Oasis::Variable>, Oasis::Real>>::Specialize(add).has_value());
+    REQUIRE(Oasis::View<Oasis::Add<Oasis::Expression>>::Specialize(add).has_value());
+    REQUIRE_FALSE(Oasis::View<Oasis::Add<Oasis::Real>>::Specialize(add).has_value());
+    REQUIRE_FALSE(Oasis::View<Oasis::Multiply<Oasis::Expression>>::Specialize(add).has_value());
+    REQUIRE_FALSE(Oasis::View<Oasis::Add<Oasis::Negate<Oasis::Real>, Oasis::Real>>::Specialize(add).has_value());
+
+    REQUIRE((Oasis::Add<Oasis::Negate<Oasis::Variable>, Oasis::Real>::Specialize(add) != nullptr));
+    REQUIRE((Oasis::Add<Oasis::Real>::Specialize(add) == nullptr));
+}